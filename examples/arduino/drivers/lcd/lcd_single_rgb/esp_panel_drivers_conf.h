@@ -30,6 +30,7 @@
     #define ESP_PANEL_DRIVERS_BUS_USE_QSPI              (0)
     #define ESP_PANEL_DRIVERS_BUS_USE_RGB               (0)
     #define ESP_PANEL_DRIVERS_BUS_USE_I2C               (0)
+    #define ESP_PANEL_DRIVERS_BUS_USE_I80               (0)
     #define ESP_PANEL_DRIVERS_BUS_USE_MIPI_DSI          (0)
 #endif // ESP_PANEL_DRIVERS_BUS_USE_ALL
 
@@ -85,6 +86,7 @@
     #define ESP_PANEL_DRIVERS_LCD_USE_ST77903           (0)
     #define ESP_PANEL_DRIVERS_LCD_USE_ST77916           (0)
     #define ESP_PANEL_DRIVERS_LCD_USE_ST77922           (0)
+    #define ESP_PANEL_DRIVERS_LCD_USE_SIMPLE            (0)
 #endif // ESP_PANEL_DRIVERS_LCD_USE_ALL
 
 /**
@@ -250,6 +252,26 @@
  */
 #define ESP_PANEL_DRIVERS_BACKLIGHT_COMPILE_UNUSED_DRIVERS     (1)
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////// Memory Configurations //////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/**
+ * @brief Fixed-block memory pool for small objects
+ *
+ * When enabled, `utils::make_shared()` and `utils::vector` allocate small objects (interruption structures, semaphores,
+ * host instances, touch point buffers, etc.) from fixed-block arenas instead of the general heap, which avoids heap
+ * fragmentation on long-running devices. Requests larger than a block or exceeding the pool fall back to the general
+ * allocator. Use `esp_panel::utils::MemoryPool::printStats()` to check the high-water marks and tune the block numbers.
+ *
+ * Set to `1` to enable, `0` to disable.
+ */
+#define ESP_PANEL_DRIVERS_MEM_POOL_ENABLE               (0)
+#if ESP_PANEL_DRIVERS_MEM_POOL_ENABLE
+    #define ESP_PANEL_DRIVERS_MEM_POOL_BLOCK_SIZE           (64)    // Size of each block in bytes, multiple of 16
+    #define ESP_PANEL_DRIVERS_MEM_POOL_INTERNAL_BLOCK_NUM   (32)    // Number of blocks in internal RAM
+    #define ESP_PANEL_DRIVERS_MEM_POOL_PSRAM_BLOCK_NUM      (0)     // Number of blocks in PSRAM, 0 to disable
+#endif // ESP_PANEL_DRIVERS_MEM_POOL_ENABLE
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////// File Version ///////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -261,7 +283,7 @@
  * 3. Patch version mismatch: No impact on functionality
  */
 #define ESP_PANEL_DRIVERS_CONF_FILE_VERSION_MAJOR 1
-#define ESP_PANEL_DRIVERS_CONF_FILE_VERSION_MINOR 1
+#define ESP_PANEL_DRIVERS_CONF_FILE_VERSION_MINOR 2
 #define ESP_PANEL_DRIVERS_CONF_FILE_VERSION_PATCH 0
 
 // *INDENT-ON*
@@ -74,6 +74,7 @@
  * - `ESP_PANEL_BUS_TYPE_SPI`
  * - `ESP_PANEL_BUS_TYPE_QSPI`
  * - `ESP_PANEL_BUS_TYPE_RGB` (ESP32-S3 only)
+ * - `ESP_PANEL_BUS_TYPE_I80` (ESP32-S3/ESP32-P4 only)
  * - `ESP_PANEL_BUS_TYPE_MIPI_DSI` (ESP32-P4 only)
  */
 #define ESP_PANEL_BOARD_LCD_BUS_TYPE        (ESP_PANEL_BUS_TYPE_SPI)
@@ -222,6 +223,42 @@
                                                             //                       ┗--------┻--------┻--------┛
 #endif // ESP_PANEL_BOARD_LCD_RGB_DATA_WIDTH
 
+#elif ESP_PANEL_BOARD_LCD_BUS_TYPE == ESP_PANEL_BUS_TYPE_I80
+
+    /**
+     * @brief I80 bus
+     */
+    /* For host */
+    #define ESP_PANEL_BOARD_LCD_I80_IO_DC           (4)
+    #define ESP_PANEL_BOARD_LCD_I80_IO_WR           (6)
+    #define ESP_PANEL_BOARD_LCD_I80_DATA_WIDTH      (8)     // 8 | 16
+    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA0        (9)
+    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA1        (46)
+    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA2        (3)
+    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA3        (8)
+    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA4        (18)
+    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA5        (17)
+    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA6        (16)
+    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA7        (15)
+#if ESP_PANEL_BOARD_LCD_I80_DATA_WIDTH > 8
+    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA8        (14)
+    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA9        (13)
+    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA10       (12)
+    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA11       (11)
+    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA12       (10)
+    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA13       (39)
+    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA14       (38)
+    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA15       (45)
+#endif // ESP_PANEL_BOARD_LCD_I80_DATA_WIDTH
+    /* For panel */
+    #define ESP_PANEL_BOARD_LCD_I80_IO_CS           (5)     // -1 if not used
+    #define ESP_PANEL_BOARD_LCD_I80_CLK_HZ          (20 * 1000 * 1000)
+                                                            // Typically set to 20M, the WR signal can't exceed 40M
+    #define ESP_PANEL_BOARD_LCD_I80_CMD_BITS        (8)     // Typically set to 8
+    #define ESP_PANEL_BOARD_LCD_I80_PARAM_BITS      (8)     // Typically set to 8
+    #define ESP_PANEL_BOARD_LCD_I80_SWAP_COLOR_BYTES (1)    // 0/1. Only valid for the 8-bit data width, typically set
+                                                            // to 1 for the little-endian RGB565 buffers of LVGL
+
 #elif ESP_PANEL_BOARD_LCD_BUS_TYPE == ESP_PANEL_BUS_TYPE_MIPI_DSI
 
     /**
@@ -752,7 +789,7 @@
  * 3. Patch version mismatch: No impact on functionality
  */
 #define ESP_PANEL_BOARD_CUSTOM_FILE_VERSION_MAJOR 1
-#define ESP_PANEL_BOARD_CUSTOM_FILE_VERSION_MINOR 2
+#define ESP_PANEL_BOARD_CUSTOM_FILE_VERSION_MINOR 3
 #define ESP_PANEL_BOARD_CUSTOM_FILE_VERSION_PATCH 0
 
 #endif // ESP_PANEL_BOARD_DEFAULT_USE_CUSTOM
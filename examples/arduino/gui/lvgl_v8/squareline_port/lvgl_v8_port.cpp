@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: CC0-1.0
  */
 
+#include <cstring>
 #include "freertos/FreeRTOS.h"
 
 #include "esp_timer.h"
@@ -15,14 +16,199 @@
 using namespace esp_panel::drivers;
 
 #define LVGL_PORT_ENABLE_ROTATION_OPTIMIZED     (1)
-#define LVGL_PORT_BUFFER_NUM_MAX                (2)
+#if LVGL_PORT_AVOID_TEAR && LVGL_PORT_ROTATION_ENABLE && (portNUM_PROCESSORS > 1)
+#define LVGL_PORT_ENABLE_ROTATION_PARALLEL      (1)     // Split the rotation across both cores
+#else
+#define LVGL_PORT_ENABLE_ROTATION_PARALLEL      (0)
+#endif
+#define LVGL_PORT_ROTATION_PARALLEL_MIN_ROWS    (32)    // Minimum rows of an area to rotate in parallel
+#define LVGL_PORT_ROTATION_WORKER_STACK_SIZE    (2 * 1024)
+#define LVGL_PORT_BUFFER_NUM_MAX                (4)
+#define LVGL_PORT_FLUSH_PIPELINE                (!LVGL_PORT_AVOID_TEAR && (LVGL_PORT_BUFFER_NUM > 2))
 
 static SemaphoreHandle_t lvgl_mux = nullptr;                  // LVGL mutex
+static SemaphoreHandle_t lvgl_event_sem = nullptr;            // Wake up the LVGL task when an event occurs
 static TaskHandle_t lvgl_task_handle = nullptr;
+static lv_indev_t *lvgl_touch_indev = nullptr;
+static volatile bool lvgl_touch_event_pending = false;
 static esp_timer_handle_t lvgl_tick_timer = NULL;
 static void *lvgl_buf[LVGL_PORT_BUFFER_NUM_MAX] = {};
 
-#if LVGL_PORT_ROTATION_DEGREE != 0
+/**
+ * The task notification of the LVGL task is already used to wait for the LCD refresh finish in the avoid tearing
+ * mode, so use a binary semaphore to wake up the task instead.
+ */
+static void lvgl_port_wake_up(void)
+{
+    if (lvgl_event_sem != nullptr) {
+        xSemaphoreGive(lvgl_event_sem);
+    }
+}
+
+IRAM_ATTR static bool lvgl_port_wake_up_from_isr(void)
+{
+    BaseType_t need_yield = pdFALSE;
+
+    if (lvgl_event_sem != nullptr) {
+        xSemaphoreGiveFromISR(lvgl_event_sem, &need_yield);
+    }
+
+    return (need_yield == pdTRUE);
+}
+
+#if LVGL_PORT_HUD_ENABLE
+/**
+ * The statistics only updated in the LVGL task are accessed without lock, since the HUD timer runs in the same task.
+ * The bus and sync statistics are updated in ISRs, so they are protected by a spinlock.
+ */
+typedef struct {
+    uint32_t frame_num;
+    uint32_t refresh_ms;
+    int64_t flush_us;
+    int64_t copy_us;
+    uint32_t touch_num;
+    int64_t bus_busy_us;
+    int64_t bus_busy_start_us;
+    int bus_inflight_num;
+    uint32_t vsync_num;
+} lv_port_hud_stats_t;
+
+static lv_port_hud_stats_t hud_stats = {};
+static portMUX_TYPE hud_stats_lock = portMUX_INITIALIZER_UNLOCKED;
+static int64_t hud_period_start_us = 0;
+static lv_obj_t *hud_label = nullptr;
+static lv_timer_t *hud_timer = nullptr;
+
+#define HUD_TIME_START(name)            int64_t name = esp_timer_get_time()
+#define HUD_TIME_ADD(name, field)       (hud_stats.field += esp_timer_get_time() - name)
+
+static inline void hud_count_touch(void)
+{
+    hud_stats.touch_num++;
+}
+
+static inline void hud_bus_start(void)
+{
+    portENTER_CRITICAL(&hud_stats_lock);
+    if (hud_stats.bus_inflight_num++ == 0) {
+        hud_stats.bus_busy_start_us = esp_timer_get_time();
+    }
+    portEXIT_CRITICAL(&hud_stats_lock);
+}
+
+IRAM_ATTR static void hud_bus_finish(void)
+{
+    portENTER_CRITICAL_SAFE(&hud_stats_lock);
+    if ((hud_stats.bus_inflight_num > 0) && (--hud_stats.bus_inflight_num == 0)) {
+        hud_stats.bus_busy_us += esp_timer_get_time() - hud_stats.bus_busy_start_us;
+    }
+    portEXIT_CRITICAL_SAFE(&hud_stats_lock);
+}
+
+IRAM_ATTR static void hud_count_vsync(void)
+{
+    portENTER_CRITICAL_ISR(&hud_stats_lock);
+    hud_stats.vsync_num++;
+    portEXIT_CRITICAL_ISR(&hud_stats_lock);
+}
+
+static void hud_monitor_callback(lv_disp_drv_t *drv, uint32_t time_ms, uint32_t px)
+{
+    hud_stats.frame_num++;
+    hud_stats.refresh_ms += time_ms;
+}
+
+static void hud_timer_callback(lv_timer_t *timer)
+{
+    int64_t now_us = esp_timer_get_time();
+    int64_t period_us = now_us - hud_period_start_us;
+    hud_period_start_us = now_us;
+    if (period_us <= 0) {
+        return;
+    }
+
+    portENTER_CRITICAL(&hud_stats_lock);
+    lv_port_hud_stats_t stats = hud_stats;
+    // Count the ongoing transmission up to now, and keep it in flight
+    if (hud_stats.bus_inflight_num > 0) {
+        stats.bus_busy_us += now_us - hud_stats.bus_busy_start_us;
+        hud_stats.bus_busy_start_us = now_us;
+    }
+    hud_stats = {};
+    hud_stats.bus_inflight_num = stats.bus_inflight_num;
+    hud_stats.bus_busy_start_us = now_us;
+    portEXIT_CRITICAL(&hud_stats_lock);
+
+    // Average time of a frame in 0.1 ms, the render time is what's left of the refresh time
+    uint32_t frame_num = (stats.frame_num > 0) ? stats.frame_num : 1;
+    int flush_100us = stats.flush_us / 100 / frame_num;
+    int copy_100us = stats.copy_us / 100 / frame_num;
+    int render_100us = (int)((int64_t)stats.refresh_ms * 10 - (stats.flush_us + stats.copy_us) / 100) / (int)frame_num;
+    if (render_100us < 0) {
+        render_100us = 0;
+    }
+
+    lv_label_set_text_fmt(
+        hud_label, "FPS %d  R %d.%d F %d.%d C %d.%d ms\nBus %d%%  VS %d  TP %d",
+        (int)(stats.frame_num * 1000000LL / period_us), render_100us / 10, render_100us % 10, flush_100us / 10,
+        flush_100us % 10, copy_100us / 10, copy_100us % 10, (int)(stats.bus_busy_us * 100 / period_us),
+        (int)(stats.vsync_num * 1000000LL / period_us), (int)(stats.touch_num * 1000000LL / period_us)
+    );
+}
+
+static void hud_flush_callback(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map);
+
+static bool hud_init(lv_disp_t *disp)
+{
+    lv_disp_drv_t *drv = disp->driver;
+    drv->monitor_cb = hud_monitor_callback;
+    drv->flush_cb = hud_flush_callback;
+
+    hud_label = lv_label_create(lv_disp_get_layer_sys(disp));
+    ESP_UTILS_CHECK_NULL_RETURN(hud_label, false, "Create HUD label failed");
+    // Use a fixed size, so the invalidated area doesn't change with the text
+    const lv_font_t *font = lv_obj_get_style_text_font(hud_label, LV_PART_MAIN);
+    lv_obj_set_size(hud_label, LVGL_PORT_HUD_WIDTH, lv_font_get_line_height(font) * 2);
+    lv_label_set_long_mode(hud_label, LV_LABEL_LONG_CLIP);
+    lv_obj_set_style_bg_color(hud_label, lv_color_black(), 0);
+    lv_obj_set_style_bg_opa(hud_label, LV_OPA_COVER, 0);
+    lv_obj_set_style_text_color(hud_label, lv_color_white(), 0);
+    lv_obj_align(hud_label, LVGL_PORT_HUD_ALIGN, 0, 0);
+    lv_label_set_text_static(hud_label, "");
+
+    hud_period_start_us = esp_timer_get_time();
+    hud_timer = lv_timer_create(hud_timer_callback, LVGL_PORT_HUD_PERIOD_MS, nullptr);
+    ESP_UTILS_CHECK_NULL_RETURN(hud_timer, false, "Create HUD timer failed");
+
+    return true;
+}
+
+static void hud_deinit(void)
+{
+    if (hud_timer != nullptr) {
+        lv_timer_del(hud_timer);
+        hud_timer = nullptr;
+    }
+    if (hud_label != nullptr) {
+        lv_obj_del(hud_label);
+        hud_label = nullptr;
+    }
+    hud_stats = {};
+}
+#else
+#define HUD_TIME_START(name)
+#define HUD_TIME_ADD(name, field)
+
+static inline void hud_count_touch(void) {}
+static inline void hud_bus_start(void) {}
+static inline void hud_bus_finish(void) {}
+static inline void hud_count_vsync(void) {}
+#endif /* LVGL_PORT_HUD_ENABLE */
+
+#if LVGL_PORT_ROTATION_ENABLE
+static uint16_t lvgl_port_rotation_degree = LVGL_PORT_ROTATION_DEGREE;  // Can be changed at runtime
+
+#if !LVGL_PORT_DIRECT_MODE_TRIPLE
 static void *get_next_frame_buffer(LCD *lcd)
 {
     static void *next_fb = NULL;
@@ -38,6 +224,7 @@ static void *get_next_frame_buffer(LCD *lcd)
 
     return next_fb;
 }
+#endif
 
 __attribute__((always_inline))
 static inline void copy_pixel_8bpp(uint8_t *to, const uint8_t *from)
@@ -85,8 +272,8 @@ static inline void copy_pixel_24bpp(uint8_t *to, const uint8_t *from)
  */
 #define ROTATE_90_OPTIMIZED_16BPP(block_w, block_h) \
     { \
-        for (int i = 0; i < h; i += block_h) { \
-            max_height = (i + block_h > h) ? h : (i + block_h); \
+        for (int i = y_start; i < y_end + 1; i += block_h) { \
+            max_height = (i + block_h > y_end + 1) ? (y_end + 1) : (i + block_h); \
             for (int j = 0; j < w; j += block_w) { \
                 max_width = (j + block_w > w) ? w : (j + block_w); \
                 start_y = w - 1 - j;   \
@@ -120,8 +307,8 @@ static inline void copy_pixel_24bpp(uint8_t *to, const uint8_t *from)
 
 #define ROTATE_270_OPTIMIZED_16BPP(block_w, block_h) \
     { \
-        for (int i = 0; i < h; i += block_h) { \
-            max_height = i + block_h > h ? h : i + block_h; \
+        for (int i = y_start; i < y_end + 1; i += block_h) { \
+            max_height = (i + block_h > y_end + 1) ? (y_end + 1) : (i + block_h); \
             for (int j = 0; j < w; j += block_w) { \
                 max_width = j + block_w > w ? w : j + block_w; \
                 for (int x = i; x < max_height; x++) { \
@@ -177,6 +364,14 @@ IRAM_ATTR static inline void rotate_copy_pixel(
 
     // uint32_t time = esp_log_timestamp();
     switch (rotate) {
+    case 0:
+        // Only used by the runtime rotation, copy the area line by line
+        from_index = y_start * from_bytes_per_line + x_start * from_bytes_per_piexl;
+        for (int from_y = y_start; from_y < y_end + 1; from_y++) {
+            memcpy(to + from_index, from + from_index, (x_end - x_start + 1) * from_bytes_per_piexl);
+            from_index += from_bytes_per_line;
+        }
+        break;
     case 90:
 #if (LV_COLOR_DEPTH == 16) && LVGL_PORT_ENABLE_ROTATION_OPTIMIZED
         ROTATE_90_OPTIMIZED_16BPP(32, 256);
@@ -200,178 +395,292 @@ IRAM_ATTR static inline void rotate_copy_pixel(
     }
     // ESP_LOGI(TAG, "rotate: end, time used:%d", (int)(esp_log_timestamp() - time));
 }
-#endif /* LVGL_PORT_ROTATION_DEGREE */
 
-#if LVGL_PORT_AVOID_TEAR
-#if LVGL_PORT_DIRECT_MODE
-#if LVGL_PORT_ROTATION_DEGREE != 0
+#if LVGL_PORT_ENABLE_ROTATION_PARALLEL
+/**
+ * Split the rotation into two row bands, one is handled by a worker task on the other core, and the other one is
+ * handled by the LVGL task. Each source row is written to different destination pixels, so the bands don't overlap.
+ */
 typedef struct {
-    uint16_t inv_p;
-    uint8_t inv_area_joined[LV_INV_BUF_SIZE];
-    lv_area_t inv_areas[LV_INV_BUF_SIZE];
-} lv_port_dirty_area_t;
+    const uint8_t *from;
+    uint8_t *to;
+    uint16_t x_start;
+    uint16_t y_start;
+    uint16_t x_end;
+    uint16_t y_end;
+    uint16_t w;
+    uint16_t h;
+    uint16_t rotate;
+} lv_port_rotate_job_t;
+
+static lv_port_rotate_job_t rotate_job;
+static TaskHandle_t rotate_worker_handle = nullptr;
+static SemaphoreHandle_t rotate_done_sem = nullptr;
+
+static void rotate_worker_task(void *arg)
+{
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        rotate_copy_pixel(
+            rotate_job.from, rotate_job.to, rotate_job.x_start, rotate_job.y_start, rotate_job.x_end,
+            rotate_job.y_end, rotate_job.w, rotate_job.h, rotate_job.rotate
+        );
+        xSemaphoreGive(rotate_done_sem);
+    }
+}
+
+static bool rotate_worker_init(void)
+{
+    rotate_done_sem = xSemaphoreCreateBinary();
+    ESP_UTILS_CHECK_NULL_RETURN(rotate_done_sem, false, "Create rotation done semaphore failed");
 
-static lv_port_dirty_area_t dirty_area;
+    // Pin the worker to the core which is not used by the LVGL task
+    BaseType_t core_id = (LVGL_PORT_TASK_CORE < 0) ? tskNO_AFFINITY : ((LVGL_PORT_TASK_CORE == 0) ? 1 : 0);
+    BaseType_t ret = xTaskCreatePinnedToCore(
+                         rotate_worker_task, "lvgl_rotate", LVGL_PORT_ROTATION_WORKER_STACK_SIZE, NULL,
+                         LVGL_PORT_TASK_PRIORITY, &rotate_worker_handle, core_id
+                     );
+    ESP_UTILS_CHECK_FALSE_RETURN(ret == pdPASS, false, "Create rotation worker task failed");
 
-static void flush_dirty_save(lv_port_dirty_area_t *dirty_area)
+    return true;
+}
+
+static void rotate_worker_deinit(void)
+{
+    if (rotate_worker_handle != nullptr) {
+        vTaskDelete(rotate_worker_handle);
+        rotate_worker_handle = nullptr;
+    }
+    if (rotate_done_sem != nullptr) {
+        vSemaphoreDelete(rotate_done_sem);
+        rotate_done_sem = nullptr;
+    }
+}
+#endif
+
+static inline void rotate_copy_pixel_parallel(
+    const uint8_t *from, uint8_t *to, uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end, uint16_t w,
+    uint16_t h, uint16_t rotate
+)
 {
-    lv_disp_t *disp = _lv_refr_get_disp_refreshing();
-    dirty_area->inv_p = disp->inv_p;
-    for (int i = 0; i < disp->inv_p; i++) {
-        dirty_area->inv_area_joined[i] = disp->inv_area_joined[i];
-        dirty_area->inv_areas[i] = disp->inv_areas[i];
+#if LVGL_PORT_ENABLE_ROTATION_PARALLEL
+    if ((rotate_worker_handle != nullptr) && (y_end + 1 - y_start >= LVGL_PORT_ROTATION_PARALLEL_MIN_ROWS)) {
+        uint16_t y_mid = y_start + (y_end + 1 - y_start) / 2;
+
+        // The worker handles the lower band, and the current task handles the upper band
+        rotate_job = {from, to, x_start, y_mid, x_end, y_end, w, h, rotate};
+        xTaskNotifyGive(rotate_worker_handle);
+        rotate_copy_pixel(from, to, x_start, y_start, x_end, y_mid - 1, w, h, rotate);
+
+        // Join before the frame buffer is switched
+        xSemaphoreTake(rotate_done_sem, portMAX_DELAY);
+
+        return;
     }
+#endif
+    rotate_copy_pixel(from, to, x_start, y_start, x_end, y_end, w, h, rotate);
 }
+#endif /* LVGL_PORT_ROTATION_ENABLE */
 
-typedef enum {
-    FLUSH_STATUS_PART,
-    FLUSH_STATUS_FULL
-} lv_port_flush_status_t;
+#if LVGL_PORT_AVOID_TEAR
+#if LVGL_PORT_DIRECT_MODE_TRIPLE || (LVGL_PORT_DIRECT_MODE && LVGL_PORT_ROTATION_ENABLE)
+/**
+ * Each frame buffer keeps the areas that changed since it was last displayed, and only the next frame buffer is
+ * synchronized before switching. The others catch up when they become the next, so a partial refresh after a full
+ * one doesn't need to copy the whole screen.
+ */
+#define LVGL_PORT_DIRTY_HISTORY_SIZE            (LV_INV_BUF_SIZE)
 
-typedef enum {
-    FLUSH_PROBE_PART_COPY,
-    FLUSH_PROBE_SKIP_COPY,
-    FLUSH_PROBE_FULL_COPY,
-} lv_port_flush_probe_t;
+typedef struct {
+    uint16_t num;
+    lv_area_t areas[LVGL_PORT_DIRTY_HISTORY_SIZE];
+} lv_port_dirty_history_t;
 
 /**
- * @brief Probe dirty area to copy
+ * @brief Add an area to the dirty history of a frame buffer
  *
- * @note This function is used to avoid tearing effect, and only work with LVGL direct-mode.
+ * @note If the history is full, the area is merged into the one whose union grows the least.
  */
-static lv_port_flush_probe_t flush_copy_probe(lv_disp_drv_t *drv)
-{
-    static lv_port_flush_status_t prev_status = FLUSH_STATUS_PART;
-    lv_port_flush_status_t cur_status;
-    lv_port_flush_probe_t probe_result;
-    lv_disp_t *disp_refr = _lv_refr_get_disp_refreshing();
-
-    uint32_t flush_ver = 0;
-    uint32_t flush_hor = 0;
-    for (int i = 0; i < disp_refr->inv_p; i++) {
-        if (disp_refr->inv_area_joined[i] == 0) {
-            flush_ver = (disp_refr->inv_areas[i].y2 + 1 - disp_refr->inv_areas[i].y1);
-            flush_hor = (disp_refr->inv_areas[i].x2 + 1 - disp_refr->inv_areas[i].x1);
-            break;
+static void flush_history_add(lv_port_dirty_history_t *history, const lv_area_t *area)
+{
+    /* Skip the area if it is already covered, and drop the ones covered by it */
+    uint16_t num = 0;
+    for (int i = 0; i < history->num; i++) {
+        if (_lv_area_is_in(area, &history->areas[i], 0)) {
+            return;
+        }
+        if (!_lv_area_is_in(&history->areas[i], area, 0)) {
+            history->areas[num++] = history->areas[i];
         }
     }
-    /* Check if the current full screen refreshes */
-    cur_status = ((flush_ver == drv->ver_res) && (flush_hor == drv->hor_res)) ? (FLUSH_STATUS_FULL) : (FLUSH_STATUS_PART);
+    history->num = num;
 
-    if (prev_status == FLUSH_STATUS_FULL) {
-        if ((cur_status == FLUSH_STATUS_PART)) {
-            probe_result = FLUSH_PROBE_FULL_COPY;
-        } else {
-            probe_result = FLUSH_PROBE_SKIP_COPY;
-        }
-    } else {
-        probe_result = FLUSH_PROBE_PART_COPY;
+    if (history->num < LVGL_PORT_DIRTY_HISTORY_SIZE) {
+        history->areas[history->num++] = *area;
+        return;
     }
-    prev_status = cur_status;
 
-    return probe_result;
+    int merge_index = 0;
+    uint32_t merge_growth = UINT32_MAX;
+    lv_area_t merge_area;
+    for (int i = 0; i < history->num; i++) {
+        _lv_area_join(&merge_area, &history->areas[i], area);
+        uint32_t growth = lv_area_get_size(&merge_area) - lv_area_get_size(&history->areas[i]);
+        if (growth < merge_growth) {
+            merge_growth = growth;
+            merge_index = i;
+        }
+    }
+    _lv_area_join(&history->areas[merge_index], &history->areas[merge_index], area);
 }
 
-static inline void *flush_get_next_buf(LCD *lcd)
+/**
+ * @brief Copy the dirty history to a frame buffer and clear it
+ *
+ * @note This function is used to avoid tearing effect, and only work with LVGL direct-mode.
+ */
+static void flush_history_copy(void *dst, void *src, lv_port_dirty_history_t *history)
 {
-    return get_next_frame_buffer(lcd);
+    HUD_TIME_START(start_us);
+    for (int i = 0; i < history->num; i++) {
+        const lv_area_t *area = &history->areas[i];
+#if !LVGL_PORT_ROTATION_ENABLE
+        size_t offset = (area->y1 * LV_HOR_RES + area->x1) * sizeof(lv_color_t);
+        size_t line_bytes = lv_area_get_width(area) * sizeof(lv_color_t);
+        for (int y = area->y1; y <= area->y2; y++) {
+            memcpy((uint8_t *)dst + offset, (uint8_t *)src + offset, line_bytes);
+            offset += LV_HOR_RES * sizeof(lv_color_t);
+        }
+#else
+        rotate_copy_pixel_parallel(
+            (uint8_t *)src, (uint8_t *)dst, area->x1, area->y1, area->x2, area->y2, LV_HOR_RES, LV_VER_RES,
+            lvgl_port_rotation_degree
+        );
+#endif
+    }
+    history->num = 0;
+    HUD_TIME_ADD(start_us, copy_us);
 }
+#endif
 
+#if LVGL_PORT_DIRECT_MODE_TRIPLE
 /**
- * @brief Copy dirty area
- *
- * @note This function is used to avoid tearing effect, and only work with LVGL direct-mode.
+ * With three frame buffers, there is always one which is neither being scanned nor waiting to be scanned by the LCD,
+ * so the next frame can be rendered (or rotated) into it without waiting for the LCD's sync signal.
  */
-static void flush_dirty_copy(void *dst, void *src, lv_port_dirty_area_t *dirty_area)
-{
-    lv_coord_t x_start, x_end, y_start, y_end;
-    for (int i = 0; i < dirty_area->inv_p; i++) {
-        /* Refresh the unjoined areas*/
-        if (dirty_area->inv_area_joined[i] == 0) {
-            x_start = dirty_area->inv_areas[i].x1;
-            x_end = dirty_area->inv_areas[i].x2;
-            y_start = dirty_area->inv_areas[i].y1;
-            y_end = dirty_area->inv_areas[i].y2;
-
-            rotate_copy_pixel(
-                (uint8_t *)src, (uint8_t *)dst, x_start, y_start, x_end, y_end, LV_HOR_RES, LV_VER_RES,
-                LVGL_PORT_ROTATION_DEGREE
-            );
+static void *lvgl_port_lcd_fbs[LVGL_PORT_DISP_BUFFER_NUM] = {};
+static lv_port_dirty_history_t dirty_history[LVGL_PORT_DISP_BUFFER_NUM];
+static void *lvgl_port_lcd_last_buf = NULL;     // The frame buffer being scanned by the LCD
+static void *lvgl_port_lcd_next_buf = NULL;     // The frame buffer to be scanned from the next frame
+static portMUX_TYPE lvgl_port_lcd_buf_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static int flush_get_free_buf_index(void)
+{
+    int index = 0;
+
+    portENTER_CRITICAL(&lvgl_port_lcd_buf_lock);
+    for (int i = 0; i < LVGL_PORT_DISP_BUFFER_NUM; i++) {
+        if ((lvgl_port_lcd_fbs[i] != lvgl_port_lcd_last_buf) && (lvgl_port_lcd_fbs[i] != lvgl_port_lcd_next_buf)) {
+            index = i;
+            break;
         }
     }
+    portEXIT_CRITICAL(&lvgl_port_lcd_buf_lock);
+
+    return index;
 }
 
 static void flush_callback(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
 {
     LCD *lcd = (LCD *)drv->user_data;
-    const int offsetx1 = area->x1;
-    const int offsetx2 = area->x2;
-    const int offsety1 = area->y1;
-    const int offsety2 = area->y2;
-    void *next_fb = NULL;
-    lv_port_flush_probe_t probe_result = FLUSH_PROBE_PART_COPY;
-    lv_disp_t *disp = lv_disp_get_default();
 
     /* Action after last area refresh */
     if (lv_disp_flush_is_last(drv)) {
-        /* Check if the `full_refresh` flag has been triggered */
-        if (drv->full_refresh) {
-            /* Reset flag */
-            drv->full_refresh = 0;
-
-            // Rotate and copy data from the whole screen LVGL's buffer to the next frame buffer
-            next_fb = flush_get_next_buf(lcd);
-            rotate_copy_pixel(
-                (uint8_t *)color_map, (uint8_t *)next_fb, offsetx1, offsety1, offsetx2, offsety2,
-                LV_HOR_RES, LV_VER_RES, LVGL_PORT_ROTATION_DEGREE
-            );
-
-            /* Switch the current LCD frame buffer to `next_fb` */
-            lcd->switchFrameBufferTo(next_fb);
-
-            /* Waiting for the current frame buffer to complete transmission */
-            ulTaskNotifyValueClear(NULL, ULONG_MAX);
-            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
-
-            /* Synchronously update the dirty area for another frame buffer */
-            flush_dirty_copy(flush_get_next_buf(lcd), color_map, &dirty_area);
-            flush_get_next_buf(lcd);
-        } else {
-            /* Probe the copy method for the current dirty area */
-            probe_result = flush_copy_probe(drv);
+        lv_disp_t *disp_refr = _lv_refr_get_disp_refreshing();
 
-            if (probe_result == FLUSH_PROBE_FULL_COPY) {
-                /* Save current dirty area for next frame buffer */
-                flush_dirty_save(&dirty_area);
+        /* Record the unjoined dirty areas of this frame for the frame buffers which don't hold it yet */
+        for (int i = 0; i < disp_refr->inv_p; i++) {
+            if (disp_refr->inv_area_joined[i] != 0) {
+                continue;
+            }
+            for (int j = 0; j < LVGL_PORT_DISP_BUFFER_NUM; j++) {
+                if (lvgl_port_lcd_fbs[j] != color_map) {
+                    flush_history_add(&dirty_history[j], &disp_refr->inv_areas[i]);
+                }
+            }
+        }
 
-                /* Set LVGL full-refresh flag and set flush ready in advance */
-                drv->full_refresh = 1;
-                disp->rendering_in_progress = false;
-                lv_disp_flush_ready(drv);
+#if LVGL_PORT_ROTATION_ENABLE
+        /* Rotate and copy the areas which changed since the free frame buffer was last displayed */
+        int next_index = flush_get_free_buf_index();
+        void *next_fb = lvgl_port_lcd_fbs[next_index];
+        flush_history_copy(next_fb, color_map, &dirty_history[next_index]);
+#else
+        /* LVGL renders into the frame buffer directly */
+        void *next_fb = color_map;
+#endif
 
-                /* Force to refresh whole screen, and will invoke `flush_callback` recursively */
-                lv_refr_now(_lv_refr_get_disp_refreshing());
-            } else {
-                /* Update current dirty area for next frame buffer */
-                next_fb = flush_get_next_buf(lcd);
-                flush_dirty_save(&dirty_area);
-                flush_dirty_copy(next_fb, color_map, &dirty_area);
-
-                /* Switch the current LCD frame buffer to `next_fb` */
-                lcd->switchFrameBufferTo(next_fb);
-
-                /* Waiting for the current frame buffer to complete transmission */
-                ulTaskNotifyValueClear(NULL, ULONG_MAX);
-                ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
-
-                if (probe_result == FLUSH_PROBE_PART_COPY) {
-                    /* Synchronously update the dirty area for another frame buffer */
-                    flush_dirty_save(&dirty_area);
-                    flush_dirty_copy(flush_get_next_buf(lcd), color_map, &dirty_area);
-                    flush_get_next_buf(lcd);
-                }
+        /* Switch the current LCD frame buffer to `next_fb`, and don't wait for the LCD's sync signal */
+        lcd->switchFrameBufferTo(next_fb);
+
+        /* Record `next_fb` after switching, so the sync callback can't mark it as being scanned too early */
+        portENTER_CRITICAL(&lvgl_port_lcd_buf_lock);
+        lvgl_port_lcd_next_buf = next_fb;
+        portEXIT_CRITICAL(&lvgl_port_lcd_buf_lock);
+
+#if !LVGL_PORT_ROTATION_ENABLE
+        /* Bring a free frame buffer up to date and let LVGL render the next frame into it */
+        int free_index = flush_get_free_buf_index();
+        void *free_fb = lvgl_port_lcd_fbs[free_index];
+        flush_history_copy(free_fb, color_map, &dirty_history[free_index]);
+        drv->draw_buf->buf1 = free_fb;
+        drv->draw_buf->buf_act = free_fb;
+#endif
+    }
+
+    lv_disp_flush_ready(drv);
+}
+
+#elif LVGL_PORT_DIRECT_MODE
+#if LVGL_PORT_ROTATION_ENABLE
+static lv_port_dirty_history_t dirty_history[2];
+
+static inline void *flush_get_next_buf(LCD *lcd)
+{
+    return get_next_frame_buffer(lcd);
+}
+
+static inline int flush_get_buf_index(LCD *lcd, void *fb)
+{
+    return (fb == lcd->getFrameBufferByIndex(0)) ? 0 : 1;
+}
+
+static void flush_callback(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
+{
+    LCD *lcd = (LCD *)drv->user_data;
+
+    /* Action after last area refresh */
+    if (lv_disp_flush_is_last(drv)) {
+        lv_disp_t *disp_refr = _lv_refr_get_disp_refreshing();
+
+        /* Record the unjoined dirty areas of this frame for both frame buffers */
+        for (int i = 0; i < disp_refr->inv_p; i++) {
+            if (disp_refr->inv_area_joined[i] == 0) {
+                flush_history_add(&dirty_history[0], &disp_refr->inv_areas[i]);
+                flush_history_add(&dirty_history[1], &disp_refr->inv_areas[i]);
             }
         }
+
+        /* Rotate and copy the areas which changed since `next_fb` was last displayed */
+        void *next_fb = flush_get_next_buf(lcd);
+        flush_history_copy(next_fb, color_map, &dirty_history[flush_get_buf_index(lcd, next_fb)]);
+
+        /* Switch the current LCD frame buffer to `next_fb` */
+        lcd->switchFrameBufferTo(next_fb);
+
+        /* Waiting for the current frame buffer to complete transmission */
+        ulTaskNotifyValueClear(NULL, ULONG_MAX);
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
     }
 
     lv_disp_flush_ready(drv);
@@ -395,7 +704,7 @@ static void flush_callback(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t
 
     lv_disp_flush_ready(drv);
 }
-#endif /* LVGL_PORT_ROTATION_DEGREE */
+#endif /* LVGL_PORT_ROTATION_ENABLE */
 
 #elif LVGL_PORT_FULL_REFRESH && LVGL_PORT_DISP_BUFFER_NUM == 2
 
@@ -415,7 +724,7 @@ static void flush_callback(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t
 
 #elif LVGL_PORT_FULL_REFRESH && LVGL_PORT_DISP_BUFFER_NUM == 3
 
-#if LVGL_PORT_ROTATION_DEGREE == 0
+#if !LVGL_PORT_ROTATION_ENABLE
 static void *lvgl_port_lcd_last_buf = NULL;
 static void *lvgl_port_lcd_next_buf = NULL;
 static void *lvgl_port_flush_next_buf = NULL;
@@ -425,7 +734,7 @@ void flush_callback(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color
 {
     LCD *lcd = (LCD *)drv->user_data;
 
-#if LVGL_PORT_ROTATION_DEGREE != 0
+#if LVGL_PORT_ROTATION_ENABLE
     const int offsetx1 = area->x1;
     const int offsetx2 = area->x2;
     const int offsety1 = area->y1;
@@ -433,10 +742,12 @@ void flush_callback(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color
     void *next_fb = get_next_frame_buffer(lcd);
 
     /* Rotate and copy dirty area from the current LVGL's buffer to the next LCD frame buffer */
-    rotate_copy_pixel(
+    HUD_TIME_START(start_us);
+    rotate_copy_pixel_parallel(
         (uint8_t *)color_map, (uint8_t *)next_fb, offsetx1, offsety1, offsetx2, offsety2, LV_HOR_RES,
-        LV_VER_RES, LVGL_PORT_ROTATION_DEGREE
+        LV_VER_RES, lvgl_port_rotation_degree
     );
+    HUD_TIME_ADD(start_us, copy_us);
 
     /* Switch the current LCD frame buffer to `next_fb` */
     lcd->switchFrameBufferTo(next_fb);
@@ -458,11 +769,17 @@ void flush_callback(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color
 IRAM_ATTR bool onLcdVsyncCallback(void *user_data)
 {
     BaseType_t need_yield = pdFALSE;
-#if LVGL_PORT_FULL_REFRESH && (LVGL_PORT_DISP_BUFFER_NUM == 3) && (LVGL_PORT_ROTATION_DEGREE == 0)
+    hud_count_vsync();
+#if LVGL_PORT_FULL_REFRESH && (LVGL_PORT_DISP_BUFFER_NUM == 3) && !LVGL_PORT_ROTATION_ENABLE
     if (lvgl_port_lcd_next_buf != lvgl_port_lcd_last_buf) {
         lvgl_port_flush_next_buf = lvgl_port_lcd_last_buf;
         lvgl_port_lcd_last_buf = lvgl_port_lcd_next_buf;
     }
+#elif LVGL_PORT_DIRECT_MODE_TRIPLE
+    // The frame buffer waiting to be scanned is being scanned from now on
+    portENTER_CRITICAL_ISR(&lvgl_port_lcd_buf_lock);
+    lvgl_port_lcd_last_buf = lvgl_port_lcd_next_buf;
+    portEXIT_CRITICAL_ISR(&lvgl_port_lcd_buf_lock);
 #else
     TaskHandle_t task_handle = (TaskHandle_t)user_data;
     // Notify that the current LCD frame buffer has been transmitted
@@ -473,6 +790,73 @@ IRAM_ATTR bool onLcdVsyncCallback(void *user_data)
 
 #else
 
+#if LVGL_PORT_FLUSH_PIPELINE
+/**
+ * The buffers beyond the two LVGL draw buffers are kept in a free list. When a stripe is submitted, its buffer is swapped
+ * out of the LVGL draw buffer with a free one, so LVGL can render the next stripe while several stripes are still in
+ * flight. The panel IO transmits in submission order, so the finished buffers are recycled from a FIFO.
+ *
+ * Only the two LVGL draw buffers can be swapped. LVGL flushes a temporary buffer (e.g. `rot_buf` of the software
+ * rotation) in other cases and waits for it, so these flushes are sent synchronously in the same FIFO order.
+ */
+static portMUX_TYPE flush_pipeline_lock = portMUX_INITIALIZER_UNLOCKED;
+static void *flush_inflight_bufs[LVGL_PORT_BUFFER_NUM_MAX] = {};
+static int flush_inflight_head = 0;
+static int flush_inflight_num = 0;
+static void *flush_free_bufs[LVGL_PORT_BUFFER_NUM_MAX] = {};
+static int flush_free_num = 0;
+static void **flush_pending_slot = nullptr;
+
+static void flush_pipeline_reset(void)
+{
+    flush_inflight_head = 0;
+    flush_inflight_num = 0;
+    flush_free_num = 0;
+    flush_pending_slot = nullptr;
+    for (int i = 2; (i < LVGL_PORT_BUFFER_NUM) && (i < LVGL_PORT_BUFFER_NUM_MAX); i++) {
+        if (lvgl_buf[i] != nullptr) {
+            flush_free_bufs[flush_free_num++] = lvgl_buf[i];
+        }
+    }
+}
+
+/* Return `true` if the finished buffer makes LVGL ready to flush again */
+IRAM_ATTR static bool flush_pipeline_on_finish(void)
+{
+    /* No stripe in flight means the synchronous flush has finished */
+    bool is_ready = true;
+
+    portENTER_CRITICAL_ISR(&flush_pipeline_lock);
+    if (flush_inflight_num > 0) {
+        is_ready = false;
+        void *buf = flush_inflight_bufs[flush_inflight_head];
+        flush_inflight_head = (flush_inflight_head + 1) % LVGL_PORT_BUFFER_NUM_MAX;
+        flush_inflight_num--;
+        if (flush_pending_slot != nullptr) {
+            *flush_pending_slot = buf;
+            flush_pending_slot = nullptr;
+            is_ready = true;
+        } else {
+            flush_free_bufs[flush_free_num++] = buf;
+        }
+    }
+    portEXIT_CRITICAL_ISR(&flush_pipeline_lock);
+
+    return is_ready;
+}
+
+static bool flush_pipeline_is_available(lv_disp_drv_t *drv, lv_color_t *color_map)
+{
+    lv_disp_draw_buf_t *draw_buf = drv->draw_buf;
+
+    if ((color_map != draw_buf->buf1) && (color_map != draw_buf->buf2)) {
+        return false;
+    }
+
+    return !drv->sw_rotate || (drv->rotated == LV_DISP_ROT_NONE);
+}
+#endif
+
 void flush_callback(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
 {
     LCD *lcd = (LCD *)drv->user_data;
@@ -481,9 +865,56 @@ void flush_callback(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color
     const int offsety1 = area->y1;
     const int offsety2 = area->y2;
 
+#if LVGL_PORT_FLUSH_PIPELINE
+    if ((lcd->getBus()->getBasicAttributes().type != ESP_PANEL_BUS_TYPE_RGB) &&
+            flush_pipeline_is_available(drv, color_map)) {
+        lv_disp_draw_buf_t *draw_buf = drv->draw_buf;
+        void **slot = (draw_buf->buf1 == color_map) ? &draw_buf->buf1 : &draw_buf->buf2;
+        bool is_ready = false;
+
+        /* Record the buffer before submitting it, since the finish callback may come before `drawBitmap()` returns */
+        portENTER_CRITICAL(&flush_pipeline_lock);
+        flush_inflight_bufs[(flush_inflight_head + flush_inflight_num) % LVGL_PORT_BUFFER_NUM_MAX] = color_map;
+        flush_inflight_num++;
+        if (flush_free_num > 0) {
+            *slot = flush_free_bufs[--flush_free_num];
+            is_ready = true;
+        } else {
+            flush_pending_slot = slot;
+        }
+        portEXIT_CRITICAL(&flush_pipeline_lock);
+
+        hud_bus_start();
+        if (!lcd->drawBitmap(
+                    offsetx1, offsety1, offsetx2 - offsetx1 + 1, offsety2 - offsety1 + 1, (const uint8_t *)color_map
+                )) {
+            /* The finish callback won't come, so take the buffer back */
+            hud_bus_finish();
+            portENTER_CRITICAL(&flush_pipeline_lock);
+            flush_inflight_num--;
+            if (is_ready) {
+                flush_free_bufs[flush_free_num++] = color_map;
+            } else {
+                flush_pending_slot = nullptr;
+                is_ready = true;
+            }
+            portEXIT_CRITICAL(&flush_pipeline_lock);
+        }
+        if (is_ready) {
+            lv_disp_flush_ready(drv);
+        }
+
+        return;
+    }
+#endif
+
+    auto bus_type = lcd->getBus()->getBasicAttributes().type;
+    if (bus_type != ESP_PANEL_BUS_TYPE_RGB) {
+        hud_bus_start();
+    }
     lcd->drawBitmap(offsetx1, offsety1, offsetx2 - offsetx1 + 1, offsety2 - offsety1 + 1, (const uint8_t *)color_map);
     // For RGB LCD, directly notify LVGL that the buffer is ready
-    if (lcd->getBus()->getBasicAttributes().type == ESP_PANEL_BUS_TYPE_RGB) {
+    if (bus_type == ESP_PANEL_BUS_TYPE_RGB) {
         lv_disp_flush_ready(drv);
     }
 }
@@ -532,6 +963,18 @@ static void update_callback(lv_disp_drv_t *drv)
 
 #endif /* LVGL_PORT_AVOID_TEAR */
 
+#if LVGL_PORT_HUD_ENABLE
+/* Measure the whole flush, and the copy time measured inside is subtracted from it */
+static void hud_flush_callback(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map)
+{
+    int64_t copy_us = hud_stats.copy_us;
+    HUD_TIME_START(start_us);
+    flush_callback(drv, area, color_map);
+    HUD_TIME_ADD(start_us, flush_us);
+    hud_stats.flush_us -= hud_stats.copy_us - copy_us;
+}
+#endif
+
 void rounder_callback(lv_disp_drv_t *drv, lv_area_t *area)
 {
     LCD *lcd = (LCD *)drv->user_data;
@@ -575,10 +1018,29 @@ static lv_disp_t *display_init(LCD *lcd)
         assert(lvgl_buf[i]);
         ESP_UTILS_LOGD("Buffer[%d] address: %p, size: %d", i, lvgl_buf[i], buffer_size * sizeof(lv_color_t));
     }
+#if LVGL_PORT_FLUSH_PIPELINE
+    flush_pipeline_reset();
+#endif
 #else
     // To avoid the tearing effect, we should use at least two frame buffers: one for LVGL rendering and another for LCD refresh
     buffer_size = lcd_width * lcd_height;
-#if (LVGL_PORT_DISP_BUFFER_NUM >= 3) && (LVGL_PORT_ROTATION_DEGREE == 0) && LVGL_PORT_FULL_REFRESH
+#if LVGL_PORT_DIRECT_MODE_TRIPLE
+
+    for (int i = 0; i < LVGL_PORT_DISP_BUFFER_NUM; i++) {
+        lvgl_port_lcd_fbs[i] = lcd->getFrameBufferByIndex(i);
+        ESP_UTILS_CHECK_NULL_RETURN(lvgl_port_lcd_fbs[i], nullptr, "Get frame buffer(%d) failed", i);
+    }
+    lvgl_port_lcd_last_buf = lvgl_port_lcd_fbs[0];
+    lvgl_port_lcd_next_buf = lvgl_port_lcd_fbs[0];
+#if !LVGL_PORT_ROTATION_ENABLE
+    lvgl_buf[0] = lvgl_port_lcd_fbs[1];
+#else
+    // All frame buffers are used for display, so LVGL renders into its own buffer and rotates it to them
+    lvgl_buf[0] = heap_caps_malloc(buffer_size * sizeof(lv_color_t), MALLOC_CAP_SPIRAM);
+    ESP_UTILS_CHECK_NULL_RETURN(lvgl_buf[0], nullptr, "Malloc LVGL buffer failed");
+#endif
+
+#elif (LVGL_PORT_DISP_BUFFER_NUM >= 3) && !LVGL_PORT_ROTATION_ENABLE && LVGL_PORT_FULL_REFRESH
 
     // With the usage of three buffers and full-refresh, we always have one buffer available for rendering,
     // eliminating the need to wait for the LCD's sync signal
@@ -588,7 +1050,7 @@ static lv_disp_t *display_init(LCD *lcd)
     lvgl_port_lcd_next_buf = lvgl_port_lcd_last_buf;
     lvgl_port_flush_next_buf = lvgl_buf[1];
 
-#elif (LVGL_PORT_DISP_BUFFER_NUM >= 3) && (LVGL_PORT_ROTATION_DEGREE != 0)
+#elif (LVGL_PORT_DISP_BUFFER_NUM >= 3) && LVGL_PORT_ROTATION_ENABLE
 
     lvgl_buf[0] = lcd->getFrameBufferByIndex(2);
 
@@ -607,13 +1069,16 @@ static lv_disp_t *display_init(LCD *lcd)
     ESP_UTILS_LOGD("Register display driver to LVGL");
     lv_disp_drv_init(&disp_drv);
     disp_drv.flush_cb = flush_callback;
-#if (LVGL_PORT_ROTATION_DEGREE == 90) || (LVGL_PORT_ROTATION_DEGREE == 270)
-    disp_drv.hor_res = lcd_height;
-    disp_drv.ver_res = lcd_width;
-#else
-    disp_drv.hor_res = lcd_width;
-    disp_drv.ver_res = lcd_height;
+#if LVGL_PORT_ROTATION_ENABLE
+    if ((lvgl_port_rotation_degree == 90) || (lvgl_port_rotation_degree == 270)) {
+        disp_drv.hor_res = lcd_height;
+        disp_drv.ver_res = lcd_width;
+    } else
 #endif
+    {
+        disp_drv.hor_res = lcd_width;
+        disp_drv.ver_res = lcd_height;
+    }
 #if LVGL_PORT_AVOID_TEAR    // Only available when the tearing effect is enabled
 #if LVGL_PORT_FULL_REFRESH
     disp_drv.full_refresh = 1;
@@ -659,6 +1124,7 @@ static void touchpad_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data)
         data->point.x = point.x;
         data->point.y = point.y;
         data->state = LV_INDEV_STATE_PRESSED;
+        hud_count_touch();
     }
 }
 
@@ -666,9 +1132,48 @@ static bool onTouchInterruptCallback(void *user_data)
 {
     BaseType_t xHigherPriorityTaskWoken = pdFALSE;
     xSemaphoreGiveFromISR( touch_detected, &xHigherPriorityTaskWoken );
-    portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
-    return false;
+    lvgl_touch_event_pending = true;
+    return lvgl_port_wake_up_from_isr() || (xHigherPriorityTaskWoken == pdTRUE);
+}
+
+#if LVGL_PORT_ROTATION_ENABLE
+static Touch::Transformation touch_init_transformation = {};
+#if LVGL_PORT_ROTATION_DYNAMIC
+/* The initial transformation of the touch matches the unrotated display, so the initial rotation is applied too */
+static constexpr uint16_t TOUCH_INIT_DEGREE = 0;
+#else
+/* The initial transformation of the touch is expected to match `LVGL_PORT_ROTATION_DEGREE` already */
+static constexpr uint16_t TOUCH_INIT_DEGREE = LVGL_PORT_ROTATION_DEGREE;
+#endif
+
+/* Transform the touch relative to its initial transformation, since the display isn't rotated by LVGL */
+static void touch_apply_rotation(Touch *tp, uint16_t degree)
+{
+    bool swap_xy = touch_init_transformation.swap_xy;
+    bool mirror_x = touch_init_transformation.mirror_x;
+    bool mirror_y = touch_init_transformation.mirror_y;
+
+    switch ((degree + 360 - TOUCH_INIT_DEGREE) % 360) {
+    case 90:
+        swap_xy = !swap_xy;
+        mirror_y = !mirror_y;
+        break;
+    case 180:
+        mirror_x = !mirror_x;
+        mirror_y = !mirror_y;
+        break;
+    case 270:
+        swap_xy = !swap_xy;
+        mirror_x = !mirror_x;
+        break;
+    default:
+        break;
+    }
+    tp->swapXY(swap_xy);
+    tp->mirrorX(mirror_x);
+    tp->mirrorY(mirror_y);
 }
+#endif
 
 static lv_indev_t *indev_init(Touch *tp)
 {
@@ -734,6 +1239,11 @@ static void lvgl_port_task(void *arg)
     uint32_t task_delay_ms = LVGL_PORT_TASK_MAX_DELAY_MS;
     while (1) {
         if (lvgl_port_lock(-1)) {
+            /* Read the touch immediately instead of waiting for the next input read period */
+            if (lvgl_touch_event_pending && (lvgl_touch_indev != nullptr)) {
+                lvgl_touch_event_pending = false;
+                lv_timer_ready(lvgl_touch_indev->driver->read_timer);
+            }
             task_delay_ms = lv_timer_handler();
             lvgl_port_unlock();
         }
@@ -742,7 +1252,8 @@ static void lvgl_port_task(void *arg)
         } else if (task_delay_ms < LVGL_PORT_TASK_MIN_DELAY_MS) {
             task_delay_ms = LVGL_PORT_TASK_MIN_DELAY_MS;
         }
-        vTaskDelay(pdMS_TO_TICKS(task_delay_ms));
+        /* Sleep until the next timer deadline, or be woken up earlier by an event */
+        xSemaphoreTake(lvgl_event_sem, pdMS_TO_TICKS(task_delay_ms));
     }
 }
 
@@ -750,9 +1261,16 @@ IRAM_ATTR bool onDrawBitmapFinishCallback(void *user_data)
 {
     lv_disp_drv_t *drv = (lv_disp_drv_t *)user_data;
 
+    hud_bus_finish();
+
+#if LVGL_PORT_FLUSH_PIPELINE
+    if (!flush_pipeline_on_finish()) {
+        return lvgl_port_wake_up_from_isr();
+    }
+#endif
     lv_disp_flush_ready(drv);
 
-    return false;
+    return lvgl_port_wake_up_from_isr();
 }
 
 bool lvgl_port_init(LCD *lcd, Touch *tp)
@@ -774,6 +1292,11 @@ bool lvgl_port_init(LCD *lcd, Touch *tp)
     lv_indev_t *indev = nullptr;
 
     lv_init();
+
+    ESP_UTILS_LOGD("Create event semaphore for LVGL task");
+    lvgl_event_sem = xSemaphoreCreateBinary();
+    ESP_UTILS_CHECK_NULL_RETURN(lvgl_event_sem, false, "Create LVGL event semaphore failed");
+
 #if !LV_TICK_CUSTOM
     ESP_UTILS_CHECK_FALSE_RETURN(tick_init(), false, "Initialize LVGL tick failed");
 #endif
@@ -794,18 +1317,12 @@ bool lvgl_port_init(LCD *lcd, Touch *tp)
         ESP_UTILS_LOGD("Initialize LVGL input driver");
         indev = indev_init(tp);
         ESP_UTILS_CHECK_NULL_RETURN(indev, false, "Initialize LVGL input driver failed");
+        lvgl_touch_indev = indev;
 
-#if LVGL_PORT_ROTATION_DEGREE != 0
-        auto &transformation = tp->getTransformation();
-#if LVGL_PORT_ROTATION_DEGREE == 90
-        tp->swapXY(!transformation.swap_xy);
-        tp->mirrorY(!transformation.mirror_y);
-#elif LVGL_PORT_ROTATION_DEGREE == 180
-        tp->mirrorX(!transformation.mirror_x);
-        tp->mirrorY(!transformation.mirror_y);
-#elif LVGL_PORT_ROTATION_DEGREE == 270
-        tp->swapXY(!transformation.swap_xy);
-        tp->mirrorX(!transformation.mirror_x);
+#if LVGL_PORT_ROTATION_ENABLE
+        touch_init_transformation = tp->getTransformation();
+#if LVGL_PORT_ROTATION_DYNAMIC
+        touch_apply_rotation(tp, lvgl_port_rotation_degree);
 #endif
 #endif
     }
@@ -823,6 +1340,17 @@ bool lvgl_port_init(LCD *lcd, Touch *tp)
 #if LVGL_PORT_AVOID_TEAR
     lcd->attachRefreshFinishCallback(onLcdVsyncCallback, (void *)lvgl_task_handle);
 #endif
+#if LVGL_PORT_ENABLE_ROTATION_PARALLEL
+    ESP_UTILS_LOGD("Create LVGL rotation worker");
+    ESP_UTILS_CHECK_FALSE_RETURN(rotate_worker_init(), false, "Create LVGL rotation worker failed");
+#endif
+#if LVGL_PORT_HUD_ENABLE
+    ESP_UTILS_LOGD("Create LVGL performance HUD");
+    ESP_UTILS_CHECK_FALSE_RETURN(lvgl_port_lock(-1), false, "Lock LVGL failed");
+    bool is_hud_ok = hud_init(disp);
+    lvgl_port_unlock();
+    ESP_UTILS_CHECK_FALSE_RETURN(is_hud_ok, false, "Create LVGL performance HUD failed");
+#endif
 
     return true;
 }
@@ -839,8 +1367,69 @@ bool lvgl_port_unlock(void)
 {
     ESP_UTILS_CHECK_NULL_RETURN(lvgl_mux, false, "LVGL mutex is not initialized");
 
+    /* Wake up the LVGL task if other tasks have invalidated the display */
+    bool need_wake_up = false;
+    if (xTaskGetCurrentTaskHandle() != lvgl_task_handle) {
+        lv_disp_t *disp = lv_disp_get_default();
+        need_wake_up = (disp != nullptr) && (disp->inv_p > 0);
+    }
+
     xSemaphoreGiveRecursive(lvgl_mux);
 
+    if (need_wake_up) {
+        lvgl_port_wake_up();
+    }
+
+    return true;
+}
+
+bool lvgl_port_set_rotation(uint16_t degree)
+{
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        (degree == 0) || (degree == 90) || (degree == 180) || (degree == 270), false, "Invalid rotation degree(%d)",
+        degree
+    );
+
+    lv_disp_t *disp = lv_disp_get_default();
+    ESP_UTILS_CHECK_NULL_RETURN(disp, false, "LVGL display is not initialized");
+
+#if !LVGL_PORT_AVOID_TEAR
+    // LVGL rotates the display by the hardware transformation or software rotation
+    lv_disp_set_rotation(disp, (lv_disp_rot_t)(degree / 90));
+#elif LVGL_PORT_ROTATION_ENABLE
+    if (degree == lvgl_port_rotation_degree) {
+        return true;
+    }
+
+    // The buffers keep the same size, only the resolution of LVGL is swapped
+    lv_disp_drv_t *drv = disp->driver;
+    bool is_swapped = (lvgl_port_rotation_degree == 90) || (lvgl_port_rotation_degree == 270);
+    if (is_swapped != ((degree == 90) || (degree == 270))) {
+        lv_coord_t hor_res = drv->hor_res;
+        drv->hor_res = drv->ver_res;
+        drv->ver_res = hor_res;
+    }
+    lvgl_port_rotation_degree = degree;
+
+#if LVGL_PORT_DIRECT_MODE
+    // The recorded areas are in the old orientation, and the full redraw below is recorded for every frame buffer
+    for (auto &history : dirty_history) {
+        history.num = 0;
+    }
+#endif
+    lv_disp_drv_update(disp, drv);
+    // A 180 degree rotation doesn't change the resolution, so LVGL won't invalidate the screen by itself
+    lv_obj_invalidate(lv_disp_get_scr_act(disp));
+
+    if (lvgl_touch_indev != nullptr) {
+        touch_apply_rotation((Touch *)lvgl_touch_indev->driver->user_data, degree);
+    }
+#else
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        degree == 0, false, "Set `LVGL_PORT_ROTATION_DYNAMIC` to change the rotation when avoid tearing is enabled"
+    );
+#endif
+
     return true;
 }
 
@@ -855,6 +1444,12 @@ bool lvgl_port_deinit(void)
         vTaskDelete(lvgl_task_handle);
         lvgl_task_handle = nullptr;
     }
+#if LVGL_PORT_ENABLE_ROTATION_PARALLEL
+    rotate_worker_deinit();
+#endif
+#if LVGL_PORT_HUD_ENABLE
+    hud_deinit();
+#endif
     ESP_UTILS_CHECK_FALSE_RETURN(lvgl_port_unlock(), false, "Unlock LVGL failed");
 
 #if LV_ENABLE_GC || !LV_MEM_CUSTOM
@@ -869,11 +1464,25 @@ bool lvgl_port_deinit(void)
             lvgl_buf[i] = nullptr;
         }
     }
+#if LVGL_PORT_FLUSH_PIPELINE
+    flush_pipeline_reset();
+#endif
+#elif LVGL_PORT_DIRECT_MODE_TRIPLE && LVGL_PORT_ROTATION_ENABLE
+    if (lvgl_buf[0] != nullptr) {
+        free(lvgl_buf[0]);
+        lvgl_buf[0] = nullptr;
+    }
 #endif
     if (lvgl_mux != nullptr) {
         vSemaphoreDelete(lvgl_mux);
         lvgl_mux = nullptr;
     }
+    if (lvgl_event_sem != nullptr) {
+        vSemaphoreDelete(lvgl_event_sem);
+        lvgl_event_sem = nullptr;
+    }
+    lvgl_touch_indev = nullptr;
+    lvgl_touch_event_pending = false;
 
     return true;
 }
@@ -34,15 +34,23 @@
  *
  *  - The size (in bytes) and number of buffers:
  *      - Lager buffer size can improve FPS, but it will occupy more memory. Maximum buffer size is `width * height`.
- *      - The number of buffers should be 1 or 2.
+ *      - The number of buffers should be 1 to 4. With more than 2 buffers, LCDs which transmit color data
+ *        asynchronously (e.g. SPI, QSPI) keep several stripes in flight while LVGL renders into a free buffer.
  */
 #define LVGL_PORT_BUFFER_MALLOC_CAPS            (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)       // Allocate LVGL buffer in SRAM
 // #define LVGL_PORT_BUFFER_MALLOC_CAPS            (MALLOC_CAP_SPIRAM)      // Allocate LVGL buffer in PSRAM
 #define LVGL_PORT_BUFFER_SIZE_HEIGHT            (20)
-#define LVGL_PORT_BUFFER_NUM                    (2)
+#ifdef CONFIG_LVGL_PORT_BUFFER_NUM
+#define LVGL_PORT_BUFFER_NUM                    (CONFIG_LVGL_PORT_BUFFER_NUM)   // Valid if using ESP-IDF
+#else
+#define LVGL_PORT_BUFFER_NUM                    (2)                             // Valid if using Arduino
+#endif
 
 /**
  * LVGL timer handle task related parameters, can be adjusted by users
+ *
+ * The task sleeps until the next LVGL timer deadline, and is woken up earlier by touch interrupts, LCD draw finish
+ * and `lvgl_port_unlock()` after other tasks invalidate the display.
  */
 #define LVGL_PORT_TASK_MAX_DELAY_MS             (500)       // The maximum delay of the LVGL timer task, in milliseconds
 #define LVGL_PORT_TASK_MIN_DELAY_MS             (2)         // The minimum delay of the LVGL timer task, in milliseconds
@@ -58,6 +66,24 @@
                                                             // This can be set to `1` only if the SoCs support dual-core,
                                                             // otherwise it should be set to `-1` or `0`
 
+/**
+ * Performance HUD related parameters, can be adjusted by users
+ *
+ * The HUD is a small label on the system layer, updated once per period with the statistics of the last period:
+ *  - FPS: Refreshed frames per second
+ *  - R/F/C: Average render, flush (including waiting for the LCD) and copy (rotation and frame buffer
+ *    synchronization) time of a frame, in milliseconds
+ *  - Bus: Busy ratio of the LCD bus, only for non-RGB LCDs
+ *  - VS: LCD refresh rate, only when the avoid tearing function is enabled
+ *  - TP: Touch samples with pressed points per second
+ *
+ * The label has a fixed size and is only redrawn once per period, so it barely affects the measured frames.
+ */
+#define LVGL_PORT_HUD_ENABLE                    (0)         // Set to `1` to show the HUD
+#define LVGL_PORT_HUD_PERIOD_MS                 (1000)      // The update period of the HUD, in milliseconds
+#define LVGL_PORT_HUD_WIDTH                     (240)       // The width of the HUD, in pixels
+#define LVGL_PORT_HUD_ALIGN                     (LV_ALIGN_TOP_LEFT)
+
 /**
  * Avoid tering related configurations, can be adjusted by users.
  *
@@ -69,6 +95,8 @@
  *      - 1: LCD double-buffer & LVGL full-refresh
  *      - 2: LCD triple-buffer & LVGL full-refresh
  *      - 3: LCD double-buffer & LVGL direct-mode (recommended)
+ *      - 4: LCD triple-buffer & LVGL direct-mode, rendering doesn't wait for the LCD's sync signal, but uses one more
+ *           frame buffer (and one more LVGL buffer in PSRAM if rotation is enabled)
  */
 #ifdef CONFIG_LVGL_PORT_AVOID_TEARING_MODE
 #define LVGL_PORT_AVOID_TEARING_MODE            (CONFIG_LVGL_PORT_AVOID_TEARING_MODE)
@@ -95,6 +123,18 @@
 #define LVGL_PORT_ROTATION_DEGREE               (0)     // Valid if using Arduino
 #endif
 
+/**
+ * Set to `1` to allow changing the rotation at runtime by `lvgl_port_set_rotation()`, then `LVGL_PORT_ROTATION_DEGREE`
+ * is the initial rotation. The buffers are the same as a non-zero rotation degree, so the FPS is reduced even at 0
+ * degree, but the rotation can be changed without reallocating any buffer.
+ *
+ * The touch is rotated with the display. When this is `1`, its transformation is expected to match the unrotated
+ * display, and `LVGL_PORT_ROTATION_DEGREE` is applied to it at initialization. When this is `0`, its transformation is
+ * left as configured for `LVGL_PORT_ROTATION_DEGREE`, like before, and only the later changes of
+ * `lvgl_port_set_rotation()` are applied to it.
+ */
+#define LVGL_PORT_ROTATION_DYNAMIC              (0)
+
 /**
  * Here, some important configurations will be set based on different anti-tearing modes and rotation angles.
  * No modification is required here.
@@ -113,6 +153,10 @@
 #elif LVGL_PORT_AVOID_TEARING_MODE == 3
     #define LVGL_PORT_DISP_BUFFER_NUM           (2)
     #define LVGL_PORT_DIRECT_MODE               (1)
+#elif LVGL_PORT_AVOID_TEARING_MODE == 4
+    #define LVGL_PORT_DISP_BUFFER_NUM           (3)
+    #define LVGL_PORT_DIRECT_MODE               (1)
+    #define LVGL_PORT_DIRECT_MODE_TRIPLE        (1)
 #else
     #error "Invalid avoid tearing mode, please set macro `LVGL_PORT_AVOID_TEARING_MODE` to one of `LVGL_PORT_AVOID_TEARING_MODE_*`"
 #endif
@@ -120,7 +164,9 @@
 #if (LVGL_PORT_ROTATION_DEGREE != 0) && (LVGL_PORT_ROTATION_DEGREE != 90) && (LVGL_PORT_ROTATION_DEGREE != 180) && \
     (LVGL_PORT_ROTATION_DEGREE != 270)
     #error "Invalid rotation degree, please set to 0, 90, 180 or 270"
-#elif LVGL_PORT_ROTATION_DEGREE != 0
+#elif (LVGL_PORT_ROTATION_DEGREE != 0) || LVGL_PORT_ROTATION_DYNAMIC
+    // LVGL renders into a separate buffer, which is rotated and copied to the frame buffers
+    #define LVGL_PORT_ROTATION_ENABLE           (1)
     #ifdef LVGL_PORT_DISP_BUFFER_NUM
         #undef LVGL_PORT_DISP_BUFFER_NUM
         #define LVGL_PORT_DISP_BUFFER_NUM           (3)
@@ -169,6 +215,19 @@ bool lvgl_port_lock(int timeout_ms);
  */
 bool lvgl_port_unlock(void);
 
+/**
+ * @brief Set the rotation of the display at runtime. This function should be called between `lvgl_port_lock()` and
+ *        `lvgl_port_unlock()` when not in LVGL task.
+ *
+ * The new rotation takes effect from the next frame, which is fully redrawn. When avoid tearing is enabled,
+ * `LVGL_PORT_ROTATION_DYNAMIC` or a non-zero `LVGL_PORT_ROTATION_DEGREE` is required.
+ *
+ * @param degree The rotation degree, one of 0/90/180/270
+ *
+ * @return true if success, otherwise false
+ */
+bool lvgl_port_set_rotation(uint16_t degree);
+
 #ifdef __cplusplus
 }
 #endif
@@ -630,6 +630,204 @@
             #endif
         #endif /* ESP_PANEL_BOARD_LCD_RGB_DATA_WIDTH > 8 */
 
+    #elif (ESP_PANEL_BOARD_LCD_BUS_TYPE == ESP_PANEL_BUS_TYPE_I80) // I80
+        // Bool type: default to 0 if not defined
+        #ifndef ESP_PANEL_BOARD_LCD_I80_SWAP_COLOR_BYTES
+            #ifdef CONFIG_ESP_PANEL_BOARD_LCD_I80_SWAP_COLOR_BYTES
+                #define ESP_PANEL_BOARD_LCD_I80_SWAP_COLOR_BYTES CONFIG_ESP_PANEL_BOARD_LCD_I80_SWAP_COLOR_BYTES
+            #else
+                #define ESP_PANEL_BOARD_LCD_I80_SWAP_COLOR_BYTES 0
+            #endif
+        #endif
+
+        // Non-bool: error if not defined
+        #ifndef ESP_PANEL_BOARD_LCD_I80_CLK_HZ
+            #ifdef CONFIG_ESP_PANEL_BOARD_LCD_I80_CLK_HZ
+                #define ESP_PANEL_BOARD_LCD_I80_CLK_HZ CONFIG_ESP_PANEL_BOARD_LCD_I80_CLK_HZ
+            #else
+                #error "Missing configuration: ESP_PANEL_BOARD_LCD_I80_CLK_HZ"
+            #endif
+        #endif
+
+        #ifndef ESP_PANEL_BOARD_LCD_I80_CMD_BITS
+            #ifdef CONFIG_ESP_PANEL_BOARD_LCD_I80_CMD_BITS
+                #define ESP_PANEL_BOARD_LCD_I80_CMD_BITS CONFIG_ESP_PANEL_BOARD_LCD_I80_CMD_BITS
+            #else
+                #error "Missing configuration: ESP_PANEL_BOARD_LCD_I80_CMD_BITS"
+            #endif
+        #endif
+
+        #ifndef ESP_PANEL_BOARD_LCD_I80_PARAM_BITS
+            #ifdef CONFIG_ESP_PANEL_BOARD_LCD_I80_PARAM_BITS
+                #define ESP_PANEL_BOARD_LCD_I80_PARAM_BITS CONFIG_ESP_PANEL_BOARD_LCD_I80_PARAM_BITS
+            #else
+                #error "Missing configuration: ESP_PANEL_BOARD_LCD_I80_PARAM_BITS"
+            #endif
+        #endif
+
+        #ifndef ESP_PANEL_BOARD_LCD_I80_DATA_WIDTH
+            #ifdef CONFIG_ESP_PANEL_BOARD_LCD_I80_DATA_WIDTH
+                #define ESP_PANEL_BOARD_LCD_I80_DATA_WIDTH CONFIG_ESP_PANEL_BOARD_LCD_I80_DATA_WIDTH
+            #else
+                #error "Missing configuration: ESP_PANEL_BOARD_LCD_I80_DATA_WIDTH"
+            #endif
+        #endif
+
+        // I80 Pins
+        #ifndef ESP_PANEL_BOARD_LCD_I80_IO_CS
+            #ifdef CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_CS
+                #define ESP_PANEL_BOARD_LCD_I80_IO_CS CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_CS
+            #else
+                #error "Missing configuration: ESP_PANEL_BOARD_LCD_I80_IO_CS"
+            #endif
+        #endif
+
+        #ifndef ESP_PANEL_BOARD_LCD_I80_IO_DC
+            #ifdef CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_DC
+                #define ESP_PANEL_BOARD_LCD_I80_IO_DC CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_DC
+            #else
+                #error "Missing configuration: ESP_PANEL_BOARD_LCD_I80_IO_DC"
+            #endif
+        #endif
+
+        #ifndef ESP_PANEL_BOARD_LCD_I80_IO_WR
+            #ifdef CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_WR
+                #define ESP_PANEL_BOARD_LCD_I80_IO_WR CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_WR
+            #else
+                #error "Missing configuration: ESP_PANEL_BOARD_LCD_I80_IO_WR"
+            #endif
+        #endif
+
+        #ifndef ESP_PANEL_BOARD_LCD_I80_IO_DATA0
+            #ifdef CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_DATA0
+                #define ESP_PANEL_BOARD_LCD_I80_IO_DATA0 CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_DATA0
+            #else
+                #error "Missing configuration: ESP_PANEL_BOARD_LCD_I80_IO_DATA0"
+            #endif
+        #endif
+
+        #ifndef ESP_PANEL_BOARD_LCD_I80_IO_DATA1
+            #ifdef CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_DATA1
+                #define ESP_PANEL_BOARD_LCD_I80_IO_DATA1 CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_DATA1
+            #else
+                #error "Missing configuration: ESP_PANEL_BOARD_LCD_I80_IO_DATA1"
+            #endif
+        #endif
+
+        #ifndef ESP_PANEL_BOARD_LCD_I80_IO_DATA2
+            #ifdef CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_DATA2
+                #define ESP_PANEL_BOARD_LCD_I80_IO_DATA2 CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_DATA2
+            #else
+                #error "Missing configuration: ESP_PANEL_BOARD_LCD_I80_IO_DATA2"
+            #endif
+        #endif
+
+        #ifndef ESP_PANEL_BOARD_LCD_I80_IO_DATA3
+            #ifdef CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_DATA3
+                #define ESP_PANEL_BOARD_LCD_I80_IO_DATA3 CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_DATA3
+            #else
+                #error "Missing configuration: ESP_PANEL_BOARD_LCD_I80_IO_DATA3"
+            #endif
+        #endif
+
+        #ifndef ESP_PANEL_BOARD_LCD_I80_IO_DATA4
+            #ifdef CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_DATA4
+                #define ESP_PANEL_BOARD_LCD_I80_IO_DATA4 CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_DATA4
+            #else
+                #error "Missing configuration: ESP_PANEL_BOARD_LCD_I80_IO_DATA4"
+            #endif
+        #endif
+
+        #ifndef ESP_PANEL_BOARD_LCD_I80_IO_DATA5
+            #ifdef CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_DATA5
+                #define ESP_PANEL_BOARD_LCD_I80_IO_DATA5 CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_DATA5
+            #else
+                #error "Missing configuration: ESP_PANEL_BOARD_LCD_I80_IO_DATA5"
+            #endif
+        #endif
+
+        #ifndef ESP_PANEL_BOARD_LCD_I80_IO_DATA6
+            #ifdef CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_DATA6
+                #define ESP_PANEL_BOARD_LCD_I80_IO_DATA6 CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_DATA6
+            #else
+                #error "Missing configuration: ESP_PANEL_BOARD_LCD_I80_IO_DATA6"
+            #endif
+        #endif
+
+        #ifndef ESP_PANEL_BOARD_LCD_I80_IO_DATA7
+            #ifdef CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_DATA7
+                #define ESP_PANEL_BOARD_LCD_I80_IO_DATA7 CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_DATA7
+            #else
+                #error "Missing configuration: ESP_PANEL_BOARD_LCD_I80_IO_DATA7"
+            #endif
+        #endif
+
+        #if ESP_PANEL_BOARD_LCD_I80_DATA_WIDTH > 8
+            #ifndef ESP_PANEL_BOARD_LCD_I80_IO_DATA8
+                #ifdef CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_DATA8
+                    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA8 CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_DATA8
+                #else
+                    #error "Missing configuration: ESP_PANEL_BOARD_LCD_I80_IO_DATA8"
+                #endif
+            #endif
+
+            #ifndef ESP_PANEL_BOARD_LCD_I80_IO_DATA9
+                #ifdef CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_DATA9
+                    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA9 CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_DATA9
+                #else
+                    #error "Missing configuration: ESP_PANEL_BOARD_LCD_I80_IO_DATA9"
+                #endif
+            #endif
+
+            #ifndef ESP_PANEL_BOARD_LCD_I80_IO_DATA10
+                #ifdef CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_DATA10
+                    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA10 CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_DATA10
+                #else
+                    #error "Missing configuration: ESP_PANEL_BOARD_LCD_I80_IO_DATA10"
+                #endif
+            #endif
+
+            #ifndef ESP_PANEL_BOARD_LCD_I80_IO_DATA11
+                #ifdef CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_DATA11
+                    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA11 CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_DATA11
+                #else
+                    #error "Missing configuration: ESP_PANEL_BOARD_LCD_I80_IO_DATA11"
+                #endif
+            #endif
+
+            #ifndef ESP_PANEL_BOARD_LCD_I80_IO_DATA12
+                #ifdef CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_DATA12
+                    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA12 CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_DATA12
+                #else
+                    #error "Missing configuration: ESP_PANEL_BOARD_LCD_I80_IO_DATA12"
+                #endif
+            #endif
+
+            #ifndef ESP_PANEL_BOARD_LCD_I80_IO_DATA13
+                #ifdef CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_DATA13
+                    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA13 CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_DATA13
+                #else
+                    #error "Missing configuration: ESP_PANEL_BOARD_LCD_I80_IO_DATA13"
+                #endif
+            #endif
+
+            #ifndef ESP_PANEL_BOARD_LCD_I80_IO_DATA14
+                #ifdef CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_DATA14
+                    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA14 CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_DATA14
+                #else
+                    #error "Missing configuration: ESP_PANEL_BOARD_LCD_I80_IO_DATA14"
+                #endif
+            #endif
+
+            #ifndef ESP_PANEL_BOARD_LCD_I80_IO_DATA15
+                #ifdef CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_DATA15
+                    #define ESP_PANEL_BOARD_LCD_I80_IO_DATA15 CONFIG_ESP_PANEL_BOARD_LCD_I80_IO_DATA15
+                #else
+                    #error "Missing configuration: ESP_PANEL_BOARD_LCD_I80_IO_DATA15"
+                #endif
+            #endif
+        #endif /* ESP_PANEL_BOARD_LCD_I80_DATA_WIDTH > 8 */
+
     #elif (ESP_PANEL_BOARD_LCD_BUS_TYPE == ESP_PANEL_BUS_TYPE_MIPI_DSI) // MIPI DSI
         // DSI settings
         #ifndef ESP_PANEL_BOARD_LCD_MIPI_DSI_LANE_NUM
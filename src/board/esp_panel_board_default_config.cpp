@@ -32,7 +32,12 @@ static const esp_panel_backlight_i2c_cmd_t i2c_backlight_init_sequence[] = ESP_P
 static const esp_panel_lcd_vendor_init_cmd_t lcd_vendor_init_cmds[] = ESP_PANEL_BOARD_LCD_VENDOR_INIT_CMD();
 #endif // ESP_PANEL_BOARD_LCD_VENDOR_INIT_CMD
 
-const BoardConfig ESP_PANEL_BOARD_DEFAULT_CONFIG = {
+/**
+ * `constexpr` resolves the partial configurations at build time and constant-initializes the object, so no constructor
+ * runs at startup and the checks below can read it. `Board` still keeps its own copy, since its callbacks can be
+ * changed at runtime.
+ */
+constexpr BoardConfig ESP_PANEL_BOARD_DEFAULT_CONFIG = {
 
     /* General */
 #ifdef ESP_PANEL_BOARD_NAME
@@ -51,7 +56,7 @@ const BoardConfig ESP_PANEL_BOARD_DEFAULT_CONFIG = {
                 .mosi_io_num = ESP_PANEL_BOARD_LCD_SPI_IO_MOSI,
                 .miso_io_num = ESP_PANEL_BOARD_LCD_SPI_IO_MISO,
                 .sclk_io_num = ESP_PANEL_BOARD_LCD_SPI_IO_SCK,
-            },
+            }.toFull(),
         #endif // ESP_PANEL_BOARD_LCD_BUS_SKIP_INIT_HOST
             // Control Panel
             .control_panel = BusSPI::ControlPanelPartialConfig{
@@ -61,7 +66,7 @@ const BoardConfig ESP_PANEL_BOARD_DEFAULT_CONFIG = {
                 .pclk_hz = ESP_PANEL_BOARD_LCD_SPI_CLK_HZ,
                 .lcd_cmd_bits = ESP_PANEL_BOARD_LCD_SPI_CMD_BITS,
                 .lcd_param_bits = ESP_PANEL_BOARD_LCD_SPI_PARAM_BITS,
-            },
+            }.toFull(),
         },
     #elif ESP_PANEL_BOARD_LCD_BUS_TYPE == ESP_PANEL_BUS_TYPE_QSPI
         .bus_config = BusQSPI::Config{
@@ -74,7 +79,7 @@ const BoardConfig ESP_PANEL_BOARD_DEFAULT_CONFIG = {
                 .data1_io_num = ESP_PANEL_BOARD_LCD_QSPI_IO_DATA1,
                 .data2_io_num = ESP_PANEL_BOARD_LCD_QSPI_IO_DATA2,
                 .data3_io_num = ESP_PANEL_BOARD_LCD_QSPI_IO_DATA3,
-            },
+            }.toFull(),
         #endif // ESP_PANEL_BOARD_LCD_BUS_SKIP_INIT_HOST
             // Control Panel
             .control_panel = BusQSPI::ControlPanelPartialConfig{
@@ -83,7 +88,7 @@ const BoardConfig ESP_PANEL_BOARD_DEFAULT_CONFIG = {
                 .pclk_hz = ESP_PANEL_BOARD_LCD_QSPI_CLK_HZ,
                 .lcd_cmd_bits = ESP_PANEL_BOARD_LCD_QSPI_CMD_BITS,
                 .lcd_param_bits = ESP_PANEL_BOARD_LCD_QSPI_PARAM_BITS,
-            },
+            }.toFull(),
         },
     #elif (ESP_PANEL_BOARD_LCD_BUS_TYPE == ESP_PANEL_BUS_TYPE_RGB) && ESP_PANEL_DRIVERS_BUS_ENABLE_RGB
         .bus_config = BusRGB::Config{
@@ -140,6 +145,37 @@ const BoardConfig ESP_PANEL_BOARD_DEFAULT_CONFIG = {
                 .flags_pclk_active_neg = ESP_PANEL_BOARD_LCD_RGB_PCLK_ACTIVE_NEG,
             },
         },
+    #elif (ESP_PANEL_BOARD_LCD_BUS_TYPE == ESP_PANEL_BUS_TYPE_I80) && ESP_PANEL_DRIVERS_BUS_ENABLE_I80
+        .bus_config = BusI80::Config{
+            // Host
+            .host = BusI80::HostPartialConfig{
+                .dc_gpio_num = ESP_PANEL_BOARD_LCD_I80_IO_DC,
+                .wr_gpio_num = ESP_PANEL_BOARD_LCD_I80_IO_WR,
+                .data_gpio_nums = {
+                    ESP_PANEL_BOARD_LCD_I80_IO_DATA0, ESP_PANEL_BOARD_LCD_I80_IO_DATA1,
+                    ESP_PANEL_BOARD_LCD_I80_IO_DATA2, ESP_PANEL_BOARD_LCD_I80_IO_DATA3,
+                    ESP_PANEL_BOARD_LCD_I80_IO_DATA4, ESP_PANEL_BOARD_LCD_I80_IO_DATA5,
+                    ESP_PANEL_BOARD_LCD_I80_IO_DATA6, ESP_PANEL_BOARD_LCD_I80_IO_DATA7,
+        #if ESP_PANEL_BOARD_LCD_I80_DATA_WIDTH > 8
+                    ESP_PANEL_BOARD_LCD_I80_IO_DATA8, ESP_PANEL_BOARD_LCD_I80_IO_DATA9,
+                    ESP_PANEL_BOARD_LCD_I80_IO_DATA10, ESP_PANEL_BOARD_LCD_I80_IO_DATA11,
+                    ESP_PANEL_BOARD_LCD_I80_IO_DATA12, ESP_PANEL_BOARD_LCD_I80_IO_DATA13,
+                    ESP_PANEL_BOARD_LCD_I80_IO_DATA14, ESP_PANEL_BOARD_LCD_I80_IO_DATA15,
+        #else
+                    -1, -1, -1, -1, -1, -1, -1, -1,
+        #endif // ESP_PANEL_BOARD_LCD_I80_DATA_WIDTH
+                },
+                .data_width = ESP_PANEL_BOARD_LCD_I80_DATA_WIDTH,
+            },
+            // Control Panel
+            .control_panel = BusI80::ControlPanelPartialConfig{
+                .cs_gpio_num = ESP_PANEL_BOARD_LCD_I80_IO_CS,
+                .pclk_hz = ESP_PANEL_BOARD_LCD_I80_CLK_HZ,
+                .lcd_cmd_bits = ESP_PANEL_BOARD_LCD_I80_CMD_BITS,
+                .lcd_param_bits = ESP_PANEL_BOARD_LCD_I80_PARAM_BITS,
+                .flags_swap_color_bytes = ESP_PANEL_BOARD_LCD_I80_SWAP_COLOR_BYTES,
+            },
+        },
     #elif (ESP_PANEL_BOARD_LCD_BUS_TYPE == ESP_PANEL_BUS_TYPE_MIPI_DSI) && ESP_PANEL_DRIVERS_BUS_ENABLE_MIPI_DSI
         .bus_config = BusDSI::Config{
             // Host
@@ -174,7 +210,7 @@ const BoardConfig ESP_PANEL_BOARD_DEFAULT_CONFIG = {
                 .rgb_ele_order = ESP_PANEL_BOARD_LCD_COLOR_BGR_ORDER,
                 .bits_per_pixel = ESP_PANEL_BOARD_LCD_COLOR_BITS,
                 .flags_reset_active_high = ESP_PANEL_BOARD_LCD_RST_LEVEL,
-            },
+            }.toFull(),
             // Vendor
             .vendor = LCD::VendorPartialConfig{
                 .hor_res = ESP_PANEL_BOARD_WIDTH,
@@ -189,7 +225,7 @@ const BoardConfig ESP_PANEL_BOARD_DEFAULT_CONFIG = {
     #ifdef ESP_PANEL_BOARD_LCD_FLAGS_ENABLE_IO_MULTIPLEX
                 .flags_enable_io_multiplex = ESP_PANEL_BOARD_LCD_FLAGS_ENABLE_IO_MULTIPLEX,
     #endif // ESP_PANEL_BOARD_LCD_FLAGS_ENABLE_IO_MULTIPLEX
-            },
+            }.toFull(),
         },
         .pre_process = {
             .invert_color = ESP_PANEL_BOARD_LCD_COLOR_INEVRT_BIT,
@@ -225,7 +261,7 @@ const BoardConfig ESP_PANEL_BOARD_DEFAULT_CONFIG = {
                 .sda_io_num = ESP_PANEL_BOARD_TOUCH_I2C_IO_SDA,
                 .scl_io_num = ESP_PANEL_BOARD_TOUCH_I2C_IO_SCL,
                 .enable_internal_pullup = ESP_PANEL_BOARD_TOUCH_I2C_INTERNAL_PULLUP,
-            },
+            }.toFull(ESP_PANEL_BOARD_TOUCH_I2C_HOST_ID),
         #endif // ESP_PANEL_BOARD_TOUCH_BUS_SKIP_INIT_HOST
             // Control Panel
         #if ESP_PANEL_BOARD_TOUCH_I2C_ADDRESS == 0
@@ -247,7 +283,7 @@ const BoardConfig ESP_PANEL_BOARD_DEFAULT_CONFIG = {
                 .mosi_io_num = ESP_PANEL_BOARD_TOUCH_SPI_IO_MOSI,
                 .miso_io_num = ESP_PANEL_BOARD_TOUCH_SPI_IO_MISO,
                 .sclk_io_num = ESP_PANEL_BOARD_TOUCH_SPI_IO_SCK,
-            },
+            }.toFull(),
         #endif // ESP_PANEL_BOARD_TOUCH_BUS_SKIP_INIT_HOST
             // Control Panel
             .control_panel = BusSPI::ControlPanelFullConfig
@@ -265,7 +301,7 @@ const BoardConfig ESP_PANEL_BOARD_DEFAULT_CONFIG = {
                 .int_gpio_num = ESP_PANEL_BOARD_TOUCH_INT_IO,
                 .levels_reset = ESP_PANEL_BOARD_TOUCH_RST_LEVEL,
                 .levels_interrupt = ESP_PANEL_BOARD_TOUCH_INT_LEVEL,
-            },
+            }.toFull(),
         },
         .pre_process = {
     #ifdef ESP_PANEL_BOARD_TOUCH_SWAP_XY
@@ -423,4 +459,79 @@ const BoardConfig ESP_PANEL_BOARD_DEFAULT_CONFIG = {
     },
 };
 
+/* Compile-time checks on the values which are narrowed by the conversions or limited by the drivers */
+#if ESP_PANEL_BOARD_USE_LCD
+#define _LCD_CONFIG         (*ESP_PANEL_BOARD_DEFAULT_CONFIG.lcd)
+#define _LCD_DEVICE_CONFIG  std::get<LCD::DeviceFullConfig>(_LCD_CONFIG.device_config.device)
+#define _LCD_VENDOR_CONFIG  std::get<LCD::VendorFullConfig>(_LCD_CONFIG.device_config.vendor)
+static_assert(
+    (_LCD_VENDOR_CONFIG.hor_res > 0) && (_LCD_VENDOR_CONFIG.ver_res > 0),
+    "Invalid LCD resolution, please check `ESP_PANEL_BOARD_WIDTH` and `ESP_PANEL_BOARD_HEIGHT`"
+);
+static_assert(
+    (_LCD_DEVICE_CONFIG.bits_per_pixel == 16) || (_LCD_DEVICE_CONFIG.bits_per_pixel == 18) ||
+    (_LCD_DEVICE_CONFIG.bits_per_pixel == 24),
+    "Invalid LCD color bits, please check `ESP_PANEL_BOARD_LCD_COLOR_BITS`"
+);
+static_assert(
+    (_LCD_CONFIG.pre_process.gap_x >= 0) && (_LCD_CONFIG.pre_process.gap_y >= 0),
+    "Invalid LCD gap, please check `ESP_PANEL_BOARD_LCD_GAP_X` and `ESP_PANEL_BOARD_LCD_GAP_Y`"
+);
+    #if ESP_PANEL_BOARD_LCD_BUS_TYPE == ESP_PANEL_BUS_TYPE_SPI
+#define _LCD_SPI_CONFIG std::get<BusSPI::ControlPanelFullConfig>( \
+    std::get<BusSPI::Config>(_LCD_CONFIG.bus_config).control_panel \
+)
+static_assert(
+    (_LCD_SPI_CONFIG.spi_mode >= 0) && (_LCD_SPI_CONFIG.spi_mode <= 3),
+    "Invalid LCD SPI mode, please check `ESP_PANEL_BOARD_LCD_SPI_MODE`"
+);
+// The clock is converted to `unsigned int`, so a negative value becomes a huge one
+static_assert(
+    (_LCD_SPI_CONFIG.pclk_hz > 0) && (_LCD_SPI_CONFIG.pclk_hz <= 80 * 1000 * 1000),
+    "Invalid LCD SPI clock (should be in (0, 80 MHz]), please check `ESP_PANEL_BOARD_LCD_SPI_CLK_HZ`"
+);
+#undef _LCD_SPI_CONFIG
+    #elif ESP_PANEL_BOARD_LCD_BUS_TYPE == ESP_PANEL_BUS_TYPE_QSPI
+#define _LCD_QSPI_CONFIG std::get<BusQSPI::ControlPanelFullConfig>( \
+    std::get<BusQSPI::Config>(_LCD_CONFIG.bus_config).control_panel \
+)
+static_assert(
+    (_LCD_QSPI_CONFIG.spi_mode >= 0) && (_LCD_QSPI_CONFIG.spi_mode <= 3),
+    "Invalid LCD QSPI mode, please check `ESP_PANEL_BOARD_LCD_QSPI_MODE`"
+);
+// The clock is converted to `unsigned int`, so a negative value becomes a huge one
+static_assert(
+    (_LCD_QSPI_CONFIG.pclk_hz > 0) && (_LCD_QSPI_CONFIG.pclk_hz <= 80 * 1000 * 1000),
+    "Invalid LCD QSPI clock (should be in (0, 80 MHz]), please check `ESP_PANEL_BOARD_LCD_QSPI_CLK_HZ`"
+);
+#undef _LCD_QSPI_CONFIG
+    #elif (ESP_PANEL_BOARD_LCD_BUS_TYPE == ESP_PANEL_BUS_TYPE_I80) && ESP_PANEL_DRIVERS_BUS_ENABLE_I80
+#define _LCD_I80_CONFIG std::get<BusI80::Config>(_LCD_CONFIG.bus_config)
+static_assert(
+    (std::get<BusI80::HostPartialConfig>(_LCD_I80_CONFIG.host).data_width == 8) ||
+    (std::get<BusI80::HostPartialConfig>(_LCD_I80_CONFIG.host).data_width == 16),
+    "Invalid LCD I80 data width, please check `ESP_PANEL_BOARD_LCD_I80_DATA_WIDTH`"
+);
+static_assert(
+    std::get<BusI80::ControlPanelPartialConfig>(_LCD_I80_CONFIG.control_panel).pclk_hz > 0,
+    "Invalid LCD I80 clock, please check `ESP_PANEL_BOARD_LCD_I80_CLK_HZ`"
+);
+#undef _LCD_I80_CONFIG
+    #endif // ESP_PANEL_BOARD_LCD_BUS_TYPE
+#undef _LCD_VENDOR_CONFIG
+#undef _LCD_DEVICE_CONFIG
+#undef _LCD_CONFIG
+#endif // ESP_PANEL_BOARD_USE_LCD
+
+#if ESP_PANEL_BOARD_USE_TOUCH
+#define _TOUCH_DEVICE_CONFIG std::get<Touch::DeviceFullConfig>(ESP_PANEL_BOARD_DEFAULT_CONFIG.touch->device_config.device)
+// The range is converted to `uint16_t`, so check that it is not truncated
+static_assert(
+    (ESP_PANEL_BOARD_WIDTH > 0) && (ESP_PANEL_BOARD_HEIGHT > 0) &&
+    (_TOUCH_DEVICE_CONFIG.x_max == ESP_PANEL_BOARD_WIDTH) && (_TOUCH_DEVICE_CONFIG.y_max == ESP_PANEL_BOARD_HEIGHT),
+    "Invalid touch resolution, please check `ESP_PANEL_BOARD_WIDTH` and `ESP_PANEL_BOARD_HEIGHT`"
+);
+#undef _TOUCH_DEVICE_CONFIG
+#endif // ESP_PANEL_BOARD_USE_TOUCH
+
 // *INDENT-ON*
@@ -0,0 +1,185 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <vector>
+#include "driver/i2c_master.h"
+#include "utils/esp_panel_utils_log.h"
+#include "esp_panel_board_probe.hpp"
+
+namespace esp_panel::board {
+
+namespace {
+
+struct ProbeBus {
+    bool isSame(const BoardProbe::ProbeConfig &probe) const
+    {
+        return (handle != nullptr) && (host_id == probe.host_id) && (scl_io_num == probe.scl_io_num) &&
+               (sda_io_num == probe.sda_io_num);
+    }
+
+    int host_id = -1;
+    int scl_io_num = -1;
+    int sda_io_num = -1;
+    i2c_master_bus_handle_t handle = nullptr;
+};
+
+struct ProbeResult {
+    int host_id;
+    int scl_io_num;
+    int sda_io_num;
+    uint16_t address;
+    bool is_ack;
+};
+
+bool openBus(ProbeBus &bus, const BoardProbe::ProbeConfig &probe)
+{
+    if (bus.isSame(probe)) {
+        return true;
+    }
+
+    if (bus.handle != nullptr) {
+        ESP_UTILS_CHECK_ERROR_RETURN(i2c_del_master_bus(bus.handle), false, "Delete I2C bus failed");
+        bus.handle = nullptr;
+    }
+
+    i2c_master_bus_config_t config = {
+        .i2c_port = static_cast<i2c_port_num_t>(probe.host_id),
+        .sda_io_num = static_cast<gpio_num_t>(probe.sda_io_num),
+        .scl_io_num = static_cast<gpio_num_t>(probe.scl_io_num),
+        .clk_source = I2C_CLK_SRC_DEFAULT,
+        .glitch_ignore_cnt = 7,
+        .intr_priority = 0,
+        .trans_queue_depth = 0,
+        .flags = {
+            .enable_internal_pullup = 1,
+        },
+    };
+    ESP_UTILS_CHECK_ERROR_RETURN(
+        i2c_new_master_bus(&config, &bus.handle), false, "Create I2C bus(%d) failed, is it already in use?",
+        probe.host_id
+    );
+    bus.host_id = probe.host_id;
+    bus.scl_io_num = probe.scl_io_num;
+    bus.sda_io_num = probe.sda_io_num;
+
+    return true;
+}
+
+bool checkID(i2c_master_bus_handle_t bus, const BoardProbe::ProbeConfig &probe, uint16_t address, int timeout_ms)
+{
+    i2c_device_config_t config = {
+        .dev_addr_length = I2C_ADDR_BIT_LEN_7,
+        .device_address = address,
+        .scl_speed_hz = probe.clk_hz,
+    };
+    i2c_master_dev_handle_t device = nullptr;
+    ESP_UTILS_CHECK_ERROR_RETURN(i2c_master_bus_add_device(bus, &config, &device), false, "Add I2C device failed");
+
+    uint8_t reg[2] = {};
+    size_t reg_len = 0;
+    if (probe.id_reg_bits == 16) {
+        reg[reg_len++] = static_cast<uint8_t>(probe.id_reg >> 8);
+    }
+    reg[reg_len++] = static_cast<uint8_t>(probe.id_reg);
+
+    std::array<uint8_t, BoardProbe::ID_LEN_MAX> id = {};
+    esp_err_t ret = i2c_master_transmit_receive(device, reg, reg_len, id.data(), probe.id_len, timeout_ms);
+    i2c_master_bus_rm_device(device);
+
+    bool is_match = (ret == ESP_OK) && (memcmp(id.data(), probe.id.data(), probe.id_len) == 0);
+    ESP_UTILS_LOGD(
+        "Read ID(0x%04x) from 0x%02x: %s", probe.id_reg, address,
+        (ret != ESP_OK) ? esp_err_to_name(ret) : (is_match ? "match" : "mismatch")
+    );
+
+    return is_match;
+}
+
+bool probeAddress(
+    ProbeBus &bus, std::vector<ProbeResult> &results, const BoardProbe::ProbeConfig &probe, uint16_t address,
+    int timeout_ms
+)
+{
+    // Reuse the ACK result if the address has already been probed on the same bus
+    auto result_it = std::find_if(results.begin(), results.end(), [&](const ProbeResult & result) {
+        return (result.host_id == probe.host_id) && (result.scl_io_num == probe.scl_io_num) &&
+               (result.sda_io_num == probe.sda_io_num) && (result.address == address);
+    });
+    if ((result_it != results.end()) && !result_it->is_ack) {
+        return false;
+    }
+
+    ESP_UTILS_CHECK_FALSE_RETURN(openBus(bus, probe), false, "Open I2C(%d) bus failed", probe.host_id);
+
+    if (result_it == results.end()) {
+        bool is_ack = (i2c_master_probe(bus.handle, address, timeout_ms) == ESP_OK);
+        results.push_back({probe.host_id, probe.scl_io_num, probe.sda_io_num, address, is_ack});
+        ESP_UTILS_LOGD("Probe address 0x%02x on I2C(%d): %s", address, probe.host_id, is_ack ? "ACK" : "NACK");
+        if (!is_ack) {
+            return false;
+        }
+    }
+
+    return (probe.id_len == 0) || checkID(bus.handle, probe, address, timeout_ms);
+}
+
+} // namespace
+
+const BoardConfig *BoardProbe::detect(const Entry *entries, size_t num, int timeout_ms)
+{
+    ESP_UTILS_LOG_TRACE_ENTER();
+
+    ESP_UTILS_CHECK_NULL_RETURN(entries, nullptr, "Invalid entries");
+    ESP_UTILS_LOGD("Param: entries(@%p), num(%d), timeout_ms(%d)", entries, static_cast<int>(num), timeout_ms);
+
+    ProbeBus bus;
+    std::vector<ProbeResult> results;
+    const BoardConfig *detected_config = nullptr;
+    uint16_t detected_address = 0;
+
+    for (size_t i = 0; (i < num) && (detected_config == nullptr); i++) {
+        auto &entry = entries[i];
+        auto &probe = entry.probe;
+        if ((entry.config == nullptr) || (probe.id_len > ID_LEN_MAX)) {
+            ESP_UTILS_LOGW("Skip invalid entry(%d)", static_cast<int>(i));
+            continue;
+        }
+
+        if (probeAddress(bus, results, probe, probe.address, timeout_ms)) {
+            detected_config = entry.config;
+            detected_address = probe.address;
+        } else if ((probe.address_alt != 0) && (probe.address_alt != probe.address) &&
+                   probeAddress(bus, results, probe, probe.address_alt, timeout_ms)) {
+            detected_config = entry.config;
+            detected_address = probe.address_alt;
+        }
+    }
+
+    if (bus.handle != nullptr) {
+        esp_err_t ret = i2c_del_master_bus(bus.handle);
+        if (ret != ESP_OK) {
+            ESP_UTILS_LOGE("Delete I2C bus failed: %s", esp_err_to_name(ret));
+        }
+    }
+
+    if (detected_config != nullptr) {
+        ESP_UTILS_LOGI(
+            "Detected board: %s (0x%02x)", (detected_config->name != nullptr) ? detected_config->name : "unnamed",
+            detected_address
+        );
+    } else {
+        ESP_UTILS_LOGW("No board detected");
+    }
+
+    ESP_UTILS_LOG_TRACE_EXIT();
+
+    return detected_config;
+}
+
+} // namespace esp_panel::board
@@ -0,0 +1,130 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <array>
+#include "esp_panel_types.h"
+#include "esp_panel_board_config.hpp"
+
+namespace esp_panel::board {
+
+/**
+ * @brief Runtime board detection by probing I2C devices
+ *
+ * This class is used to select a board configuration from a compiled-in table when one firmware image is shipped to
+ * several board variants. Each table entry describes an I2C device (usually the touch controller or IO expander) that
+ * only exists on its board, and optionally an ID register whose content identifies the device.
+ *
+ * Entries sharing the same I2C port and pins are probed on a single temporary bus, and each address is only probed
+ * once, so a table of several variants costs a few bus transactions instead of a full board initialization per try.
+ *
+ * @note The probe creates and deletes its own I2C master bus, so it should be called before `Board::init()`
+ */
+class BoardProbe {
+public:
+    static constexpr int ID_LEN_MAX = 8;
+    static constexpr uint32_t I2C_CLK_SPEED_DEFAULT = 100 * 1000;
+    static constexpr int I2C_TIMEOUT_MS_DEFAULT = 20;
+
+    /**
+     * @brief The I2C probe configuration structure
+     */
+    struct ProbeConfig {
+        int host_id = 0;                            /*!< I2C port number */
+        int scl_io_num = -1;                        /*!< I2C SCL pin number */
+        int sda_io_num = -1;                        /*!< I2C SDA pin number */
+        uint32_t clk_hz = I2C_CLK_SPEED_DEFAULT;    /*!< I2C clock frequency */
+        uint16_t address = 0;                       /*!< 7-bit device address */
+        uint16_t address_alt = 0;                   /*!< Alternative 7-bit device address, probed if the first one
+                                                         doesn't match. If 0, not used */
+        uint16_t id_reg = 0;                        /*!< ID register address */
+        uint8_t id_reg_bits = 8;                    /*!< ID register address width, 8 or 16 */
+        uint8_t id_len = 0;                         /*!< Length of the expected ID. If 0, only check the address ACK */
+        std::array<uint8_t, ID_LEN_MAX> id = {};    /*!< Expected content of the ID register */
+    };
+
+    /**
+     * @brief The detection table entry structure
+     */
+    struct Entry {
+        const BoardConfig *config = nullptr;        /*!< Board configuration selected when the probe matches */
+        ProbeConfig probe;                          /*!< Probe configuration */
+    };
+
+    /**
+     * @brief Probe configuration of GT911 touch controller
+     *
+     * @param[in] host_id I2C port number
+     * @param[in] scl_io_num I2C SCL pin number
+     * @param[in] sda_io_num I2C SDA pin number
+     * @param[in] address 7-bit device address, 0x5D or 0x14 (depends on the INT level during reset)
+     * @param[in] address_alt Alternative 7-bit device address, probed if `address` doesn't match. Set to 0 to only
+     *                        probe `address`
+     * @return Probe configuration matching the product ID register (`"911"`)
+     */
+    static constexpr ProbeConfig GT911(
+        int host_id, int scl_io_num, int sda_io_num, uint16_t address = 0x5D, uint16_t address_alt = 0x14
+    )
+    {
+        return ProbeConfig{
+            .host_id = host_id,
+            .scl_io_num = scl_io_num,
+            .sda_io_num = sda_io_num,
+            .clk_hz = I2C_CLK_SPEED_DEFAULT,
+            .address = address,
+            .address_alt = address_alt,
+            .id_reg = 0x8140,
+            .id_reg_bits = 16,
+            .id_len = 3,
+            .id = {'9', '1', '1'},
+        };
+    }
+
+    /**
+     * @brief Probe configuration that only checks whether an address acknowledges, such as an IO expander
+     *
+     * @param[in] host_id I2C port number
+     * @param[in] scl_io_num I2C SCL pin number
+     * @param[in] sda_io_num I2C SDA pin number
+     * @param[in] address 7-bit device address
+     * @return Probe configuration
+     */
+    static constexpr ProbeConfig Address(int host_id, int scl_io_num, int sda_io_num, uint16_t address)
+    {
+        return ProbeConfig{
+            .host_id = host_id,
+            .scl_io_num = scl_io_num,
+            .sda_io_num = sda_io_num,
+            .clk_hz = I2C_CLK_SPEED_DEFAULT,
+            .address = address,
+        };
+    }
+
+    /**
+     * @brief Detect the board by probing the entries of the table in order
+     *
+     * @param[in] entries Detection table, the first matching entry wins
+     * @param[in] num Number of entries
+     * @param[in] timeout_ms Timeout of each I2C transaction in milliseconds
+     * @return Pointer to the configuration of the matched entry, or `nullptr` if no entry matches or failed
+     */
+    static const BoardConfig *detect(const Entry *entries, size_t num, int timeout_ms = I2C_TIMEOUT_MS_DEFAULT);
+
+    /**
+     * @brief Detect the board by probing the entries of the table in order
+     *
+     * @param[in] entries Detection table, the first matching entry wins
+     * @param[in] timeout_ms Timeout of each I2C transaction in milliseconds
+     * @return Pointer to the configuration of the matched entry, or `nullptr` if no entry matches or failed
+     */
+    template <size_t N>
+    static const BoardConfig *detect(const Entry (&entries)[N], int timeout_ms = I2C_TIMEOUT_MS_DEFAULT)
+    {
+        return detect(entries, N, timeout_ms);
+    }
+};
+
+} // namespace esp_panel::board
@@ -4,11 +4,18 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include "drivers/host/esp_panel_host_i2c.hpp"
 #include "esp_panel_backlight_i2c.hpp"
 #include "utils/esp_panel_utils_log.h"
 
 namespace esp_panel::drivers {
 
+static void on_brightness_done(esp_err_t ret, void * /* user_ctx */)
+{
+    if (ret != ESP_OK) {
+        ESP_UTILS_LOGE("Failed to set brightness: %s", esp_err_to_name(ret));
+    }
+}
 
 
 BacklightI2C::BacklightI2C(const Config &config)
@@ -60,6 +67,9 @@ bool BacklightI2C::del()
         return true;
     }
 
+    // Make sure no queued brightness update uses the device after it is removed
+    flushBrightnessUpdates();
+
     esp_err_t ret = esp_panel_backlight_i2c_deinit();
     if (ret == ESP_OK) {
         _initialized = false;
@@ -85,6 +95,25 @@ bool BacklightI2C::setBrightness(int percent)
         return false;
     }
 
+    // If the bus is shared with the touch or other devices through the host, update the brightness asynchronously, so
+    // the caller and the other devices don't wait for it, and the pending updates are merged into the latest one
+    auto host = HostI2C::getInstance(_config.i2c_config.i2c_port);
+    uint8_t command[2] = {};
+    if ((host != nullptr) && host->isOverState(HostI2C::State::BEGIN) &&
+            (esp_panel_backlight_i2c_get_brightness_command(percent, command) == ESP_OK)) {
+        HostI2C::Transaction trans;
+        trans.device = esp_panel_backlight_i2c_get_device_handle();
+        trans.write_data.assign(command, command + sizeof(command));
+        trans.replaceable = true;
+        trans.on_done = on_brightness_done;
+        if (host->submitTransaction(std::move(trans))) {
+            setBrightnessValue(percent);
+            ESP_UTILS_LOG_TRACE_EXIT();
+            return true;
+        }
+        ESP_UTILS_LOGW("Submit brightness update failed, fallback to the synchronous way");
+    }
+
     esp_err_t ret = esp_panel_backlight_i2c_set_brightness(percent);
     if (ret == ESP_OK) {
         setBrightnessValue(percent);
@@ -107,6 +136,10 @@ bool BacklightI2C::on()
         return false;
     }
 
+    // Some devices share the register of the power and brightness, so a queued brightness update must not overwrite
+    // the power state written below
+    ESP_UTILS_CHECK_FALSE_RETURN(flushBrightnessUpdates(), false, "Flush brightness updates failed");
+
     esp_err_t ret = esp_panel_backlight_i2c_set_power(true);
     if (ret == ESP_OK) {
         setBrightnessValue(100);
@@ -130,6 +163,10 @@ bool BacklightI2C::off()
         return false;
     }
 
+    // Some devices share the register of the power and brightness, so a queued brightness update must not overwrite
+    // the power state written below
+    ESP_UTILS_CHECK_FALSE_RETURN(flushBrightnessUpdates(), false, "Flush brightness updates failed");
+
     esp_err_t ret = esp_panel_backlight_i2c_set_power(false);
     if (ret == ESP_OK) {
         setBrightnessValue(0);
@@ -143,4 +180,14 @@ bool BacklightI2C::off()
     }
 }
 
+bool BacklightI2C::flushBrightnessUpdates()
+{
+    auto host = HostI2C::getInstance(_config.i2c_config.i2c_port);
+    if (host == nullptr) {
+        return true;
+    }
+
+    return host->flushTransactions(HostI2C::SCHEDULER_TIMEOUT_MS);
+}
+
 } // namespace esp_panel::drivers
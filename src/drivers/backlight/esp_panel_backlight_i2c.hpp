@@ -66,6 +66,9 @@ public:
      * @param[in] percent The brightness percentage (0-100)
      *
      * @return `true` if successful, `false` otherwise
+     * @note If the I2C port is owned by a begun `HostI2C`, the update is submitted to its transaction scheduler, and
+     *       this function returns `true` before the write happens. A failure of the write is only logged. Otherwise
+     *       the write is blocking and its result is returned.
      */
     bool setBrightness(int percent) override;
 
@@ -84,6 +87,13 @@ public:
     bool off();
 
 private:
+    /**
+     * @brief Wait for the brightness updates submitted to the scheduler of the host
+     *
+     * @return `true` if all finished or no host, `false` if timeout
+     */
+    bool flushBrightnessUpdates();
+
     Config _config;  ///< The I2C backlight configuration
     bool _initialized;  ///< Initialization status
 };
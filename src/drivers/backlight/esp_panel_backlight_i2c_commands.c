@@ -140,6 +140,23 @@ esp_err_t esp_panel_backlight_i2c_set_brightness(int percent)
     return ESP_OK;
 }
 
+esp_err_t esp_panel_backlight_i2c_get_brightness_command(int percent, uint8_t command[2])
+{
+    ESP_RETURN_ON_FALSE(g_i2c_initialized, ESP_ERR_INVALID_STATE, TAG, "I2C backlight not initialized");
+    ESP_RETURN_ON_FALSE(percent >= 0 && percent <= 100, ESP_ERR_INVALID_ARG, TAG, "Invalid brightness percent");
+    ESP_RETURN_ON_FALSE(command, ESP_ERR_INVALID_ARG, TAG, "Invalid command buffer");
+
+    command[0] = g_i2c_config.brightness_cmd;
+    command[1] = (uint8_t)((percent * g_i2c_config.max_brightness) / 100);
+
+    return ESP_OK;
+}
+
+i2c_master_dev_handle_t esp_panel_backlight_i2c_get_device_handle(void)
+{
+    return g_i2c_dev_handle;
+}
+
 esp_err_t esp_panel_backlight_i2c_set_power(bool on)
 {
     ESP_RETURN_ON_FALSE(g_i2c_initialized, ESP_ERR_INVALID_STATE, TAG, "I2C backlight not initialized");
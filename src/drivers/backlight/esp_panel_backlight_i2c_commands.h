@@ -61,6 +61,22 @@ esp_err_t esp_panel_backlight_i2c_deinit(void);
  */
 esp_err_t esp_panel_backlight_i2c_set_brightness(int percent);
 
+/**
+ * @brief Get the command bytes to set the backlight brightness, without sending them
+ *
+ * @param[in]  percent Brightness percentage (0-100)
+ * @param[out] command Command bytes, `{brightness_cmd, value}`
+ * @return ESP_OK on success, otherwise error code
+ */
+esp_err_t esp_panel_backlight_i2c_get_brightness_command(int percent, uint8_t command[2]);
+
+/**
+ * @brief Get the I2C device handle of the backlight
+ *
+ * @return Device handle, or NULL if not initialized
+ */
+i2c_master_dev_handle_t esp_panel_backlight_i2c_get_device_handle(void);
+
 /**
  * @brief Set backlight power state
  *
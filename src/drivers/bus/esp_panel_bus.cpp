@@ -5,11 +5,146 @@
  */
 
 #include <inttypes.h>
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_lcd_panel_io_interface.h"
 #include "utils/esp_panel_utils_log.h"
 #include "esp_panel_bus.hpp"
 
 namespace esp_panel::drivers {
 
+/**
+ * The panel IO which keeps the data of the shadowed registers and forwards the transactions to the original one
+ */
+struct RegisterShadowPanelIO {
+    struct Entry {
+        uint32_t address;
+        bool is_valid;
+        uint8_t size;
+        uint8_t data[Bus::REGISTER_SHADOW_DATA_SIZE_MAX];
+    };
+
+    /* The QSPI commands are encoded as `(opcode << 24) | (command << 8)`, and the read and write opcodes differ */
+    uint32_t getKey(uint32_t address) const
+    {
+        return (is_qspi && ((address & ~0xFFU) != 0)) ? ((address >> 8) & 0xFF) : address;
+    }
+
+    Entry *findEntry(int address)
+    {
+        uint32_t key = getKey(static_cast<uint32_t>(address));
+        auto it = std::find_if(entries.begin(), entries.end(), [key](const Entry & entry) {
+            return entry.address == key;
+        });
+        return (it != entries.end()) ? &(*it) : nullptr;
+    }
+
+    void updateEntry(Entry *entry, const void *data, size_t size)
+    {
+        entry->is_valid = true;
+        entry->size = size;
+        memcpy(entry->data, data, size);
+    }
+
+    void invalidate()
+    {
+        for (auto &entry : entries) {
+            entry.is_valid = false;
+        }
+        stats->invalidations++;
+    }
+
+    esp_lcd_panel_io_t base;        // Must be the first member
+    esp_lcd_panel_io_handle_t io;
+    Bus::RegisterShadowStats *stats;
+    bool is_qspi;
+    utils::vector<Entry> entries;
+};
+
+namespace {
+
+esp_err_t register_shadow_rx_param(esp_lcd_panel_io_t *io, int lcd_cmd, void *param, size_t param_size)
+{
+    auto shadow = __containerof(io, RegisterShadowPanelIO, base);
+    auto entry = shadow->findEntry(lcd_cmd);
+
+    if ((entry != nullptr) && entry->is_valid && (entry->size == param_size)) {
+        memcpy(param, entry->data, param_size);
+        shadow->stats->cached_reads++;
+        return ESP_OK;
+    }
+    if (entry != nullptr) {
+        shadow->stats->missed_reads++;
+    }
+
+    esp_err_t ret = esp_lcd_panel_io_rx_param(shadow->io, lcd_cmd, param, param_size);
+    if ((entry != nullptr) && (ret == ESP_OK) && (param_size <= Bus::REGISTER_SHADOW_DATA_SIZE_MAX)) {
+        shadow->updateEntry(entry, param, param_size);
+    }
+
+    return ret;
+}
+
+esp_err_t register_shadow_tx_param(esp_lcd_panel_io_t *io, int lcd_cmd, const void *param, size_t param_size)
+{
+    auto shadow = __containerof(io, RegisterShadowPanelIO, base);
+
+    // A command without parameters (e.g. `SWRESET` or `SLPOUT`) may change the registers, so drop all the data
+    if ((param == nullptr) || (param_size == 0)) {
+        shadow->invalidate();
+        return esp_lcd_panel_io_tx_param(shadow->io, lcd_cmd, param, param_size);
+    }
+
+    auto entry = shadow->findEntry(lcd_cmd);
+    if ((entry != nullptr) && entry->is_valid && (entry->size == param_size) &&
+            (memcmp(entry->data, param, param_size) == 0)) {
+        shadow->stats->skipped_writes++;
+        return ESP_OK;
+    }
+
+    esp_err_t ret = esp_lcd_panel_io_tx_param(shadow->io, lcd_cmd, param, param_size);
+    if (entry != nullptr) {
+        shadow->stats->missed_writes++;
+        if ((ret == ESP_OK) && (param_size <= Bus::REGISTER_SHADOW_DATA_SIZE_MAX)) {
+            shadow->updateEntry(entry, param, param_size);
+        } else {
+            entry->is_valid = false;
+        }
+    }
+
+    return ret;
+}
+
+esp_err_t register_shadow_tx_color(esp_lcd_panel_io_t *io, int lcd_cmd, const void *color, size_t color_size)
+{
+    auto shadow = __containerof(io, RegisterShadowPanelIO, base);
+
+    return esp_lcd_panel_io_tx_color(shadow->io, lcd_cmd, color, color_size);
+}
+
+esp_err_t register_shadow_register_event_callbacks(
+    esp_lcd_panel_io_t *io, const esp_lcd_panel_io_callbacks_t *cbs, void *user_ctx
+)
+{
+    auto shadow = __containerof(io, RegisterShadowPanelIO, base);
+
+    return esp_lcd_panel_io_register_event_callbacks(shadow->io, cbs, user_ctx);
+}
+
+esp_err_t register_shadow_del(esp_lcd_panel_io_t *io)
+{
+    auto shadow = __containerof(io, RegisterShadowPanelIO, base);
+    esp_err_t ret = esp_lcd_panel_io_del(shadow->io);
+    delete shadow;
+
+    return ret;
+}
+
+} // namespace
+
 bool Bus::readRegisterData(uint32_t address, void *data, uint32_t data_size) const
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
@@ -64,6 +199,89 @@ bool Bus::writeColorData(uint32_t address, const void *color, uint32_t color_siz
     return true;
 }
 
+bool Bus::writeRegisterBatch(const RegisterCommand *commands, size_t num) const
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(isControlPanelValid(), false, "Invalid control panel");
+    ESP_UTILS_CHECK_FALSE_RETURN((commands != nullptr) || (num == 0), false, "Invalid commands");
+
+    ESP_UTILS_LOGD("Param: commands(%p), num(%d)", commands, static_cast<int>(num));
+    size_t start = 0;
+    for (size_t i = 0; i < num; i++) {
+        // A run ends with a command with delay or the last command
+        if ((commands[i].delay_ms == 0) && (i + 1 < num)) {
+            continue;
+        }
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            writeRegisterRun(commands + start, i + 1 - start), false, "Write commands[%d, %d] failed",
+            static_cast<int>(start), static_cast<int>(i)
+        );
+        if (commands[i].delay_ms > 0) {
+            vTaskDelay(pdMS_TO_TICKS(commands[i].delay_ms));
+        }
+        start = i + 1;
+    }
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool Bus::enableRegisterShadow(const utils::vector<uint32_t> &addresses)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(isControlPanelValid(), false, "Invalid control panel");
+    ESP_UTILS_CHECK_FALSE_RETURN(_register_shadow == nullptr, false, "Already enabled");
+
+    ESP_UTILS_LOGD("Param: addresses(%d)", static_cast<int>(addresses.size()));
+    auto shadow = new (std::nothrow) RegisterShadowPanelIO{};
+    ESP_UTILS_CHECK_NULL_RETURN(shadow, false, "Allocate register shadow failed");
+    shadow->is_qspi = (getBasicAttributes().type == ESP_PANEL_BUS_TYPE_QSPI);
+    for (auto address : addresses) {
+        RegisterShadowPanelIO::Entry entry = {};
+        entry.address = shadow->getKey(address);
+        shadow->entries.push_back(entry);
+    }
+    shadow->io = control_panel;
+    shadow->stats = &_register_shadow_stats;
+    shadow->base.rx_param = register_shadow_rx_param;
+    shadow->base.tx_param = register_shadow_tx_param;
+    shadow->base.tx_color = register_shadow_tx_color;
+    shadow->base.del = register_shadow_del;
+    shadow->base.register_event_callbacks = register_shadow_register_event_callbacks;
+
+    _register_shadow_stats = {};
+    _register_shadow = shadow;
+    control_panel = &shadow->base;
+    ESP_UTILS_LOGD("Enable register shadow @%p", control_panel);
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+void Bus::invalidateRegisterShadow()
+{
+    if (_register_shadow != nullptr) {
+        _register_shadow->invalidate();
+    }
+}
+
+bool Bus::writeRegisterRun(const RegisterCommand *commands, size_t num) const
+{
+    for (size_t i = 0; i < num; i++) {
+        auto &command = commands[i];
+        ESP_UTILS_CHECK_ERROR_RETURN(
+            esp_lcd_panel_io_tx_param(control_panel, command.address, command.data, command.data_size), false,
+            "Write command(0x%02x) failed", command.address
+        );
+    }
+
+    return true;
+}
+
 bool Bus::delControlPanel()
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
@@ -73,6 +291,8 @@ bool Bus::delControlPanel()
     ESP_UTILS_CHECK_ERROR_RETURN(esp_lcd_panel_io_del(control_panel), false, "Delete control panel failed");
     ESP_UTILS_LOGD("Delete control panel @%p", control_panel);
     control_panel = nullptr;
+    // The register shadow is deleted with the control panel
+    _register_shadow = nullptr;
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 
@@ -10,10 +10,14 @@
 #include <string>
 #include "esp_lcd_types.h"
 #include "esp_lcd_panel_io.h"
+#include "utils/esp_panel_utils_cxx.hpp"
 #include "esp_panel_bus_conf_internal.h"
 
 namespace esp_panel::drivers {
 
+// Forward declaration
+struct RegisterShadowPanelIO;
+
 /**
  * @brief Base class for all bus types
  *
@@ -23,6 +27,8 @@ class Bus {
 public:
     using ControlPanelHandle = esp_lcd_panel_io_handle_t;
 
+    static constexpr int REGISTER_SHADOW_DATA_SIZE_MAX = 4;
+
     /**
      * @brief Basic attributes structure for bus configuration
      */
@@ -31,6 +37,27 @@ public:
         const char *name = "";  /*!< Bus name string, defaults to `""` */
     };
 
+    /**
+     * @brief Statistics of the register shadow, see `enableRegisterShadow()`
+     */
+    struct RegisterShadowStats {
+        uint32_t skipped_writes = 0;    /*!< Number of writes skipped since the data is unchanged (hits) */
+        uint32_t missed_writes = 0;     /*!< Number of writes of the shadowed registers sent to the device */
+        uint32_t cached_reads = 0;      /*!< Number of reads served from the shadow (hits) */
+        uint32_t missed_reads = 0;      /*!< Number of reads of the shadowed registers sent to the device */
+        uint32_t invalidations = 0;     /*!< Number of times the whole shadow is invalidated */
+    };
+
+    /**
+     * @brief Register command structure for `writeRegisterBatch()`, same as `esp_panel_lcd_vendor_init_cmd_t`
+     */
+    struct RegisterCommand {
+        int address;                /*!< Register address (command) to write to */
+        const void *data;           /*!< Data buffer to write, set to `nullptr` if no data */
+        size_t data_size;           /*!< Size of data to write in bytes */
+        unsigned int delay_ms;      /*!< Delay in milliseconds after this command */
+    };
+
     /**
      * @brief Driver state enumeration
      */
@@ -115,6 +142,63 @@ public:
      */
     bool writeColorData(uint32_t address, const void *color, uint32_t color_size) const;
 
+    /**
+     * @brief Write a sequence of register commands, such as a vendor initialization sequence
+     *
+     * The sequence is split into runs at the commands with a non-zero delay. Each run is written back to back by the
+     * batching path of the bus, without logging or yielding between the commands, and the task only sleeps after the
+     * commands with a delay. The buses which can't batch write the commands one by one through the control panel.
+     *
+     * @param[in] commands Array of register commands
+     * @param[in] num      Number of commands in the array
+     *
+     * @return `true` if all commands are written, `false` otherwise
+     * @note The layout of `RegisterCommand` is the same as `esp_panel_lcd_vendor_init_cmd_t`, so the vendor
+     *       initialization commands can be passed by casting the pointer
+     * @note The QSPI bus takes the plain commands (e.g. `0x36`) and adds the write opcode itself, the commands which
+     *       are already encoded (larger than `0xFF`) are written as is
+     */
+    bool writeRegisterBatch(const RegisterCommand *commands, size_t num) const;
+
+    /**
+     * @brief Enable the register shadow of the control panel
+     *
+     * For the given registers, the last written or read data is kept in the shadow. Writing the same data again is
+     * skipped and reading is served from the shadow, whether by this class or by the device driver through the
+     * control panel handle. This saves the transactions of the paths which rewrite the same registers, such as
+     * `MADCTL (0x36)` and `COLMOD (0x3A)` in the mirror and swap functions of the LCDs.
+     *
+     * @param[in] addresses Addresses of the non-volatile registers to shadow, their data size should be no more than
+     *                      `REGISTER_SHADOW_DATA_SIZE_MAX` bytes. For the "QSPI" bus, both the plain command (e.g.
+     *                      `0x36`) and the encoded one (see `BusQSPI::encodeQSPI_Command()`) are accepted, the
+     *                      transactions are matched by the command byte whatever their read or write opcode is
+     * @return `true` if successful, `false` otherwise
+     * @note This function should be called after `begin()` and before initializing the device, since the control
+     *       panel handle is replaced
+     * @note Do not include the registers which are changed by the device itself (e.g. status registers), or the
+     *       registers which share the address between different pages
+     * @note The shadow is invalidated automatically when a command without parameters (e.g. `SWRESET (0x01)`) is
+     *       sent, call `invalidateRegisterShadow()` after resetting the device in other ways
+     */
+    bool enableRegisterShadow(const utils::vector<uint32_t> &addresses);
+
+    /**
+     * @brief Invalidate all the data in the register shadow, so the next reads and writes hit the device
+     *
+     * @note This function does nothing if the register shadow is not enabled
+     */
+    void invalidateRegisterShadow();
+
+    /**
+     * @brief Get the statistics of the register shadow
+     *
+     * @return Reference to the statistics, all fields are `0` if the register shadow is not enabled
+     */
+    const RegisterShadowStats &getRegisterShadowStats() const
+    {
+        return _register_shadow_stats;
+    }
+
     /**
      * @brief Disable the LCD control panel handle
      *
@@ -123,6 +207,7 @@ public:
     void disableControlPanelHandle()
     {
         control_panel = nullptr;
+        _register_shadow = nullptr;
     }
 
     /**
@@ -179,6 +264,19 @@ protected:
         _state = state;
     }
 
+    /**
+     * @brief Write a run of register commands without delay, called by `writeRegisterBatch()`
+     *
+     * The default implementation writes the commands one by one through the control panel. The derived classes
+     * override it when the bus can write them with less overhead.
+     *
+     * @param[in] commands Array of register commands
+     * @param[in] num      Number of commands in the array
+     *
+     * @return `true` if all commands are written, `false` otherwise
+     */
+    virtual bool writeRegisterRun(const RegisterCommand *commands, size_t num) const;
+
     /**
      * @brief Check if control panel handle is valid
      *
@@ -194,6 +292,8 @@ protected:
 private:
     State _state = State::DEINIT;              /*!< Current driver state */
     BasicAttributes _basic_attributes = {};     /*!< Bus basic attributes */
+    RegisterShadowPanelIO *_register_shadow = nullptr;  /*!< Register shadow, owned by the control panel handle */
+    RegisterShadowStats _register_shadow_stats = {};    /*!< Statistics of the register shadow */
 };
 
 } // namespace esp_panel::drivers
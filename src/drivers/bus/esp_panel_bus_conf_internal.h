@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "sdkconfig.h"
 #include "drivers/esp_panel_drivers_conf_internal.h"
 
 // *INDENT-OFF*
@@ -27,6 +28,7 @@
         #define ESP_PANEL_DRIVERS_BUS_USE_QSPI     (1)
         #define ESP_PANEL_DRIVERS_BUS_USE_RGB      (1)
         #define ESP_PANEL_DRIVERS_BUS_USE_I2C      (1)
+        #define ESP_PANEL_DRIVERS_BUS_USE_I80      (1)
         #define ESP_PANEL_DRIVERS_BUS_USE_MIPI_DSI (1)
     #else
         #ifndef ESP_PANEL_DRIVERS_BUS_USE_SPI
@@ -66,6 +68,19 @@
             #endif
         #endif
 
+        #if SOC_LCD_I80_SUPPORTED
+            #ifndef ESP_PANEL_DRIVERS_BUS_USE_I80
+                #ifdef CONFIG_ESP_PANEL_DRIVERS_BUS_USE_I80
+                    #define ESP_PANEL_DRIVERS_BUS_USE_I80 CONFIG_ESP_PANEL_DRIVERS_BUS_USE_I80
+                #else
+                    #define ESP_PANEL_DRIVERS_BUS_USE_I80 (0)
+                #endif
+            #endif
+        #else
+            #undef ESP_PANEL_DRIVERS_BUS_USE_I80
+            #define ESP_PANEL_DRIVERS_BUS_USE_I80 (0)
+        #endif
+
         #if SOC_MIPI_DSI_SUPPORTED
             #ifndef ESP_PANEL_DRIVERS_BUS_USE_MIPI_DSI
                 #ifdef CONFIG_ESP_PANEL_DRIVERS_BUS_USE_MIPI_DSI
@@ -131,6 +146,21 @@
     #endif
 #endif
 
+#if SOC_LCD_I80_SUPPORTED
+    #ifndef ESP_PANEL_DRIVERS_BUS_ENABLE_I80
+        #if ESP_PANEL_DRIVERS_BUS_COMPILE_UNUSED_DRIVERS || ESP_PANEL_DRIVERS_BUS_USE_I80
+            #define ESP_PANEL_DRIVERS_BUS_ENABLE_I80  (1)
+        #else
+            #define ESP_PANEL_DRIVERS_BUS_ENABLE_I80  (0)
+        #endif
+    #endif
+#else
+    #undef ESP_PANEL_DRIVERS_BUS_ENABLE_I80
+    #define ESP_PANEL_DRIVERS_BUS_ENABLE_I80  (0)
+    #undef ESP_PANEL_DRIVERS_BUS_USE_I80
+    #define ESP_PANEL_DRIVERS_BUS_USE_I80  (0)
+#endif
+
 #if SOC_MIPI_DSI_SUPPORTED
     #ifndef ESP_PANEL_DRIVERS_BUS_ENABLE_MIPI_DSI
         #if ESP_PANEL_DRIVERS_BUS_COMPILE_UNUSED_DRIVERS || ESP_PANEL_DRIVERS_BUS_USE_MIPI_DSI
@@ -146,4 +176,31 @@
     #define ESP_PANEL_DRIVERS_BUS_USE_MIPI_DSI  (0)
 #endif
 
+/*
+ * SPI & QSPI host default configuration
+ */
+/* Refer to `hal/spi_ll.h` in SDK (ESP-IDF) */
+#ifndef ESP_PANEL_HOST_SPI_MAX_TRANSFER_SIZE
+    #ifdef CONFIG_IDF_TARGET_ESP32
+        // ESP32
+        #define ESP_PANEL_HOST_SPI_MAX_TRANSFER_SIZE   ((1U << 24) >> 3)
+    #elif CONFIG_IDF_TARGET_ESP32S2
+        // ESP32-S2
+        #define ESP_PANEL_HOST_SPI_MAX_TRANSFER_SIZE   ((1U << 23) >> 3)
+    #else
+        // ESP32-C2, ESP32-C3, ESP32-C5, ESP32-C6, ESP32-C61
+        // ESP32-S3
+        // ESP32-P4
+        #define ESP_PANEL_HOST_SPI_MAX_TRANSFER_SIZE   ((1U << 18) >> 3)
+    #endif
+#endif
+
+/*
+ * I80 host default configuration
+ */
+/* Only the DMA descriptors are allocated for the transfer size, so a large value costs little memory */
+#ifndef ESP_PANEL_HOST_I80_MAX_TRANSFER_SIZE
+    #define ESP_PANEL_HOST_I80_MAX_TRANSFER_SIZE   (480 * 320 * 2)
+#endif
+
 // *INDENT-ON*
@@ -254,6 +254,33 @@ bool BusDSI::configDPI_FrameBufferNumber(uint8_t num)
     return true;
 }
 
+bool BusDSI::configDSI_RefreshRate(uint32_t refresh_rate_hz, const BusDSICalculator::Limits &limits)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isOverState(State::INIT), false, "Should be called before `init()`");
+
+    ESP_UTILS_LOGD("Param: refresh_rate_hz(%d)", static_cast<int>(refresh_rate_hz));
+    auto &host_config = getHostFullConfig();
+    auto plan = BusDSICalculator::calculate(getCalculatorTiming(), host_config.num_data_lanes, refresh_rate_hz, limits);
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        plan.is_valid, false, "Refresh rate(%d) is not supported by %d lane(s)", static_cast<int>(refresh_rate_hz),
+        static_cast<int>(host_config.num_data_lanes)
+    );
+
+    host_config.lane_bit_rate_mbps = plan.lane_bit_rate_mbps;
+    getRefreshPanelFullConfig().dpi_clock_freq_mhz = plan.dpi_clock_freq_mhz;
+    ESP_UTILS_LOGI(
+        "DPI clock: %d MHz, lane bit rate: %d Mbps, refresh rate: %d.%02d Hz",
+        static_cast<int>(plan.dpi_clock_freq_mhz), static_cast<int>(plan.lane_bit_rate_mbps),
+        static_cast<int>(plan.refresh_rate_x100 / 100), static_cast<int>(plan.refresh_rate_x100 % 100)
+    );
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
 bool BusDSI::init()
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
@@ -269,8 +296,21 @@ bool BusDSI::init()
     _config.printPHY_LDO_Config();
 #endif // ESP_UTILS_LOG_LEVEL_DEBUG
 
-    // Get the host instance if not skipped
+    // Check if the lanes can carry the DPI clock, otherwise the screen will be black
     auto &host_config = getHostFullConfig();
+    auto link_error = BusDSICalculator::validate(
+                          getCalculatorTiming(), host_config.num_data_lanes, host_config.lane_bit_rate_mbps,
+                          getRefreshPanelFullConfig().dpi_clock_freq_mhz, BusDSICalculator::Limits{}
+                      );
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        link_error != BusDSICalculator::Error::BANDWIDTH_NOT_ENOUGH, false, "Invalid link: %s",
+        BusDSICalculator::getErrorString(link_error)
+    );
+    if (link_error != BusDSICalculator::Error::NONE) {
+        ESP_UTILS_LOGW("Check link: %s", BusDSICalculator::getErrorString(link_error));
+    }
+
+    // Get the host instance if not skipped
     auto host_id = host_config.bus_id;
     _host = HostDSI::getInstance(host_id, host_config);
     ESP_UTILS_CHECK_NULL_RETURN(_host, false, "Get DSI host(%d) instance failed", host_id);
@@ -366,6 +406,34 @@ BusDSI::HostHandle BusDSI::getHostHandle()
     return (_host == nullptr) ? nullptr : static_cast<esp_lcd_dsi_bus_handle_t>(_host->getNativeHandle());
 }
 
+BusDSICalculator::Timing BusDSI::getCalculatorTiming()
+{
+    auto &config = getRefreshPanelFullConfig();
+    uint32_t bits_per_pixel = 24;
+    switch (config.pixel_format) {
+    case LCD_COLOR_PIXEL_FORMAT_RGB565:
+        bits_per_pixel = 16;
+        break;
+    case LCD_COLOR_PIXEL_FORMAT_RGB666:
+        bits_per_pixel = 18;
+        break;
+    default:
+        break;
+    }
+
+    return BusDSICalculator::Timing{
+        .h_size = config.video_timing.h_size,
+        .v_size = config.video_timing.v_size,
+        .hsync_pulse_width = config.video_timing.hsync_pulse_width,
+        .hsync_back_porch = config.video_timing.hsync_back_porch,
+        .hsync_front_porch = config.video_timing.hsync_front_porch,
+        .vsync_pulse_width = config.video_timing.vsync_pulse_width,
+        .vsync_back_porch = config.video_timing.vsync_back_porch,
+        .vsync_front_porch = config.video_timing.vsync_front_porch,
+        .bits_per_pixel = bits_per_pixel,
+    };
+}
+
 BusDSI::HostFullConfig &BusDSI::getHostFullConfig()
 {
     if (std::holds_alternative<HostPartialConfig>(_config.host)) {
@@ -15,6 +15,7 @@
 #include "esp_panel_types.h"
 #include "utils/esp_panel_utils_cxx.hpp"
 #include "esp_panel_bus.hpp"
+#include "esp_panel_bus_dsi_calculator.hpp"
 
 namespace esp_panel::drivers {
 
@@ -201,6 +202,21 @@ public:
      */
     bool configDPI_FrameBufferNumber(uint8_t num);
 
+    /**
+     * @brief Configure the DPI clock and the lane bit rate for a target refresh rate
+     *
+     * The values are derived from the timing, the bits per pixel and the number of data lanes by
+     * `BusDSICalculator::calculate()`, instead of being hand-entered.
+     *
+     * @param[in] refresh_rate_hz Target refresh rate in Hz, 0 means the highest one supported by the link
+     * @param[in] limits          Limits of the link
+     * @return `true` if configuration succeeds, `false` otherwise
+     * @note This function should be called before `init()` and after the timing is configured
+     */
+    bool configDSI_RefreshRate(
+        uint32_t refresh_rate_hz, const BusDSICalculator::Limits &limits = BusDSICalculator::Limits{}
+    );
+
     /**
      * @brief Initialize the MIPI-DSI bus
      *
@@ -306,6 +322,13 @@ private:
      */
     PHY_LDO_FullConfig &getPHY_LDO_FullConfig();
 
+    /**
+     * @brief Convert the refresh panel configuration to the timing of the calculator
+     *
+     * @return Timing of the calculator
+     */
+    BusDSICalculator::Timing getCalculatorTiming();
+
     Config _config = {};                              ///< MIPI-DSI bus configuration
     std::shared_ptr<HostDSI> _host = nullptr;         ///< MIPI-DSI host instance
     esp_ldo_channel_handle_t _phy_ldo_handle = nullptr; ///< PHY LDO handle
@@ -0,0 +1,244 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace esp_panel::drivers {
+
+/**
+ * @brief The link and timing calculator of the MIPI-DSI bus
+ *
+ * The DPI clock sends one pixel per cycle (including the porches), and the data lanes should carry all the bits of
+ * these pixels plus the packet overhead of the DSI protocol. This class derives the DPI clock and the minimum lane bit
+ * rate for a target refresh rate, and validates a hand-entered configuration, which otherwise only shows up as a black
+ * screen or a low FPS.
+ *
+ * It only depends on the C++ standard library, so it can also be used by the host tools.
+ */
+class BusDSICalculator {
+public:
+    /**
+     * @brief Default values of the limits, from the MIPI-DSI PHY of ESP32-P4
+     */
+    static constexpr uint32_t LANE_BIT_RATE_MBPS_MAX_DEFAULT = 1500;
+    static constexpr uint32_t DPI_CLOCK_FREQ_MHZ_MAX_DEFAULT = 250;
+    static constexpr uint8_t OVERHEAD_PERCENT_DEFAULT = 10;
+
+    /**
+     * @brief Timing of the panel, same as the fields of `esp_lcd_video_timing_t`
+     */
+    struct Timing {
+        uint32_t h_size = 0;                ///< Horizontal resolution
+        uint32_t v_size = 0;                ///< Vertical resolution
+        uint32_t hsync_pulse_width = 0;     ///< Horizontal sync pulse width
+        uint32_t hsync_back_porch = 0;      ///< Horizontal back porch
+        uint32_t hsync_front_porch = 0;     ///< Horizontal front porch
+        uint32_t vsync_pulse_width = 0;     ///< Vertical sync pulse width
+        uint32_t vsync_back_porch = 0;      ///< Vertical back porch
+        uint32_t vsync_front_porch = 0;     ///< Vertical front porch
+        uint32_t bits_per_pixel = 16;       ///< Bits per pixel (16/18/24)
+    };
+
+    /**
+     * @brief Limits of the link
+     */
+    struct Limits {
+        uint32_t lane_bit_rate_mbps_max = LANE_BIT_RATE_MBPS_MAX_DEFAULT;  ///< Maximum bit rate of each lane
+        uint32_t dpi_clock_freq_mhz_max = DPI_CLOCK_FREQ_MHZ_MAX_DEFAULT;  ///< Maximum DPI clock frequency
+        uint8_t overhead_percent = OVERHEAD_PERCENT_DEFAULT;               ///< Protocol overhead on the lanes
+    };
+
+    /**
+     * @brief Result of the validation
+     */
+    enum class Error : uint8_t {
+        NONE = 0,                   ///< The configuration is valid
+        INVALID_ARGUMENT,           ///< The timing, lanes or clocks are zero
+        LANE_RATE_OVER_LIMIT,       ///< The lane bit rate exceeds the limit
+        DPI_CLOCK_OVER_LIMIT,       ///< The DPI clock exceeds the limit
+        BANDWIDTH_NOT_ENOUGH,       ///< The lanes can't carry the pixel bits, the screen will be black or broken
+        BANDWIDTH_NO_MARGIN,        ///< The lanes can carry the pixel bits but not the protocol overhead
+    };
+
+    /**
+     * @brief Result of the calculation, which can be filled into `BusDSI::Config`
+     */
+    struct Plan {
+        bool is_valid = false;              ///< Whether the link can reach the refresh rate
+        uint32_t dpi_clock_freq_mhz = 0;    ///< DPI clock frequency in MHz
+        uint32_t lane_bit_rate_mbps = 0;    ///< Minimum bit rate of each lane in Mbps
+        uint32_t refresh_rate_x100 = 0;     ///< Actual refresh rate with the DPI clock, in 0.01 Hz
+    };
+
+    /**
+     * @brief Get the total pixels of a line, including the porches
+     */
+    static constexpr uint64_t getLineTotal(const Timing &timing)
+    {
+        return static_cast<uint64_t>(timing.h_size) + timing.hsync_pulse_width + timing.hsync_back_porch +
+               timing.hsync_front_porch;
+    }
+
+    /**
+     * @brief Get the total lines of a frame, including the porches
+     */
+    static constexpr uint64_t getFrameLines(const Timing &timing)
+    {
+        return static_cast<uint64_t>(timing.v_size) + timing.vsync_pulse_width + timing.vsync_back_porch +
+               timing.vsync_front_porch;
+    }
+
+    /**
+     * @brief Get the refresh rate with the DPI clock, in 0.01 Hz
+     */
+    static constexpr uint32_t getRefreshRateX100(const Timing &timing, uint32_t dpi_clock_freq_mhz)
+    {
+        uint64_t frame_pixels = getLineTotal(timing) * getFrameLines(timing);
+
+        return (frame_pixels == 0) ? 0 :
+               static_cast<uint32_t>(static_cast<uint64_t>(dpi_clock_freq_mhz) * 1000000 * 100 / frame_pixels);
+    }
+
+    /**
+     * @brief Get the minimum lane bit rate in Mbps (rounded up) to carry the DPI clock with the protocol overhead
+     */
+    static constexpr uint32_t getMinLaneBitRateMbps(
+        const Timing &timing, uint32_t num_data_lanes, uint32_t dpi_clock_freq_mhz, uint8_t overhead_percent
+    )
+    {
+        uint64_t bits = static_cast<uint64_t>(dpi_clock_freq_mhz) * timing.bits_per_pixel * (100 + overhead_percent);
+        uint64_t divisor = static_cast<uint64_t>(num_data_lanes) * 100;
+
+        return (divisor == 0) ? 0 : static_cast<uint32_t>((bits + divisor - 1) / divisor);
+    }
+
+    /**
+     * @brief Get the maximum DPI clock in MHz (rounded down) that the lanes and the limits can support
+     */
+    static constexpr uint32_t getMaxDpiClockFreqMhz(
+        const Timing &timing, uint32_t num_data_lanes, uint32_t lane_bit_rate_mbps, const Limits &limits
+    )
+    {
+        if (timing.bits_per_pixel == 0) {
+            return 0;
+        }
+        uint32_t lane_rate = (lane_bit_rate_mbps < limits.lane_bit_rate_mbps_max) ? lane_bit_rate_mbps :
+                             limits.lane_bit_rate_mbps_max;
+        uint64_t freq_mhz = static_cast<uint64_t>(num_data_lanes) * lane_rate * 100 /
+                            (static_cast<uint64_t>(timing.bits_per_pixel) * (100 + limits.overhead_percent));
+
+        return (freq_mhz < limits.dpi_clock_freq_mhz_max) ? static_cast<uint32_t>(freq_mhz) :
+               limits.dpi_clock_freq_mhz_max;
+    }
+
+    /**
+     * @brief Calculate the DPI clock and the minimum lane bit rate for the target refresh rate
+     *
+     * The DPI clock is the smallest integer MHz reaching the target refresh rate. If `refresh_rate_hz` is 0, the
+     * highest refresh rate supported by the limits is used.
+     *
+     * @param[in] timing          Timing of the panel
+     * @param[in] num_data_lanes  Number of data lanes
+     * @param[in] refresh_rate_hz Target refresh rate in Hz, 0 means the highest one
+     * @param[in] limits          Limits of the link
+     * @return The plan, `is_valid` is `false` if the inputs are invalid or the target is over the limits
+     */
+    static constexpr Plan calculate(
+        const Timing &timing, uint32_t num_data_lanes, uint32_t refresh_rate_hz, const Limits &limits
+    )
+    {
+        Plan result = {};
+        uint64_t frame_pixels = getLineTotal(timing) * getFrameLines(timing);
+        if ((timing.h_size == 0) || (timing.v_size == 0) || (timing.bits_per_pixel == 0) || (num_data_lanes == 0)) {
+            return result;
+        }
+
+        uint32_t max_freq_mhz = getMaxDpiClockFreqMhz(
+                                    timing, num_data_lanes, limits.lane_bit_rate_mbps_max, limits
+                                );
+        uint64_t freq_mhz = max_freq_mhz;
+        if (refresh_rate_hz > 0) {
+            freq_mhz = (frame_pixels * refresh_rate_hz + 1000000 - 1) / 1000000;
+        }
+        if ((freq_mhz == 0) || (freq_mhz > max_freq_mhz)) {
+            return result;
+        }
+        result.is_valid = true;
+        result.dpi_clock_freq_mhz = static_cast<uint32_t>(freq_mhz);
+        result.lane_bit_rate_mbps = getMinLaneBitRateMbps(
+                                        timing, num_data_lanes, result.dpi_clock_freq_mhz, limits.overhead_percent
+                                    );
+        result.refresh_rate_x100 = getRefreshRateX100(timing, result.dpi_clock_freq_mhz);
+
+        return result;
+    }
+
+    /**
+     * @brief Validate a hand-entered link configuration
+     *
+     * @param[in] timing             Timing of the panel
+     * @param[in] num_data_lanes     Number of data lanes
+     * @param[in] lane_bit_rate_mbps Bit rate of each lane in Mbps
+     * @param[in] dpi_clock_freq_mhz DPI clock frequency in MHz
+     * @param[in] limits             Limits of the link
+     * @return `Error::NONE` if valid, otherwise the first problem found. `Error::BANDWIDTH_NOT_ENOUGH` is reported
+     *         before the limits, so a link which can't carry the pixel bits is always rejected
+     */
+    static constexpr Error validate(
+        const Timing &timing, uint32_t num_data_lanes, uint32_t lane_bit_rate_mbps, uint32_t dpi_clock_freq_mhz,
+        const Limits &limits
+    )
+    {
+        if ((timing.h_size == 0) || (timing.v_size == 0) || (timing.bits_per_pixel == 0) || (num_data_lanes == 0) ||
+                (lane_bit_rate_mbps == 0) || (dpi_clock_freq_mhz == 0)) {
+            return Error::INVALID_ARGUMENT;
+        }
+        // Checked first, since it is the only fatal problem and must not be hidden by the others
+        if (lane_bit_rate_mbps < getMinLaneBitRateMbps(timing, num_data_lanes, dpi_clock_freq_mhz, 0)) {
+            return Error::BANDWIDTH_NOT_ENOUGH;
+        }
+        if (lane_bit_rate_mbps > limits.lane_bit_rate_mbps_max) {
+            return Error::LANE_RATE_OVER_LIMIT;
+        }
+        if (dpi_clock_freq_mhz > limits.dpi_clock_freq_mhz_max) {
+            return Error::DPI_CLOCK_OVER_LIMIT;
+        }
+        if (lane_bit_rate_mbps < getMinLaneBitRateMbps(
+                    timing, num_data_lanes, dpi_clock_freq_mhz, limits.overhead_percent
+                )) {
+            return Error::BANDWIDTH_NO_MARGIN;
+        }
+
+        return Error::NONE;
+    }
+
+    /**
+     * @brief Get the description of the validation result
+     */
+    static constexpr const char *getErrorString(Error error)
+    {
+        switch (error) {
+        case Error::NONE:
+            return "none";
+        case Error::INVALID_ARGUMENT:
+            return "invalid argument";
+        case Error::LANE_RATE_OVER_LIMIT:
+            return "lane bit rate over limit";
+        case Error::DPI_CLOCK_OVER_LIMIT:
+            return "DPI clock over limit";
+        case Error::BANDWIDTH_NOT_ENOUGH:
+            return "lane bandwidth not enough for DPI clock";
+        case Error::BANDWIDTH_NO_MARGIN:
+            return "lane bandwidth has no margin for protocol overhead";
+        default:
+            return "unknown";
+        }
+    }
+};
+
+} // namespace esp_panel::drivers
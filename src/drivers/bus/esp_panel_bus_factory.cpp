@@ -49,6 +49,9 @@ const utils::unordered_map<int, utils::string> BusFactory::_type_name_map = {
 #if ESP_PANEL_DRIVERS_BUS_ENABLE_RGB
     TYPE_NAME_MAP_ITEM(RGB),
 #endif
+#if ESP_PANEL_DRIVERS_BUS_ENABLE_I80
+    TYPE_NAME_MAP_ITEM(I80),
+#endif
 #if ESP_PANEL_DRIVERS_BUS_ENABLE_MIPI_DSI
     TYPE_NAME_MAP_ITEM(DSI),
 #endif
@@ -67,6 +70,9 @@ const utils::unordered_map<int, BusFactory::FunctionDeviceConstructor> BusFactor
 #if ESP_PANEL_DRIVERS_BUS_USE_RGB
     TYPE_CREATOR_MAP_ITEM(RGB),
 #endif
+#if ESP_PANEL_DRIVERS_BUS_USE_I80
+    TYPE_CREATOR_MAP_ITEM(I80),
+#endif
 #if ESP_PANEL_DRIVERS_BUS_USE_MIPI_DSI
     TYPE_CREATOR_MAP_ITEM(DSI),
 #endif
@@ -118,6 +124,11 @@ int BusFactory::getConfigType(const Config &config)
         return BusRGB::BASIC_ATTRIBUTES_DEFAULT.type;
     }
 #endif // ESP_PANEL_DRIVERS_BUS_ENABLE_RGB
+#if ESP_PANEL_DRIVERS_BUS_ENABLE_I80
+    if (std::holds_alternative<BusI80::Config>(config)) {
+        return BusI80::BASIC_ATTRIBUTES_DEFAULT.type;
+    }
+#endif // ESP_PANEL_DRIVERS_BUS_ENABLE_I80
 #if ESP_PANEL_DRIVERS_BUS_ENABLE_MIPI_DSI
     if (std::holds_alternative<BusDSI::Config>(config)) {
         return BusDSI::BASIC_ATTRIBUTES_DEFAULT.type;
@@ -22,17 +22,7 @@ void BusI2C::Config::convertPartialToFull()
 #if ESP_UTILS_CONF_LOG_LEVEL == ESP_UTILS_LOG_LEVEL_DEBUG
         printHostConfig();
 #endif // ESP_UTILS_LOG_LEVEL_DEBUG
-        auto &config = std::get<HostPartialConfig>(host.value());
-        host = HostFullConfig{
-            .i2c_port = static_cast<i2c_port_t>(host_id),
-            .sda_io_num = static_cast<gpio_num_t>(config.sda_io_num),
-            .scl_io_num = static_cast<gpio_num_t>(config.scl_io_num),
-            .clk_source = I2C_CLK_SRC_DEFAULT,
-            .glitch_ignore_cnt = 7,
-            .flags = {
-                .enable_internal_pullup = config.enable_internal_pullup,
-            }
-        };
+        host = std::get<HostPartialConfig>(host.value()).toFull(host_id);
     }
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
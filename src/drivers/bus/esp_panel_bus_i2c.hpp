@@ -39,12 +39,34 @@ public:
     static constexpr int I2C_CLK_SPEED_DEFAULT = 400 * 1000;
     static constexpr bool I2C_ENABLE_INTERNAL_PULLUP_DEFAULT = true;
 
+    using HostFullConfig = i2c_master_bus_config_t;
+
     struct HostPartialConfig {
+        /**
+         * @brief Convert to the full configuration
+         *
+         * @param[in] host_id I2C host ID
+         * @return Full host configuration
+         * @note This function can be evaluated at compile time
+         */
+        constexpr HostFullConfig toFull(int host_id) const
+        {
+            return HostFullConfig{
+                .i2c_port = static_cast<i2c_port_t>(host_id),
+                .sda_io_num = static_cast<gpio_num_t>(sda_io_num),
+                .scl_io_num = static_cast<gpio_num_t>(scl_io_num),
+                .clk_source = I2C_CLK_SRC_DEFAULT,
+                .glitch_ignore_cnt = 7,
+                .flags = {
+                    .enable_internal_pullup = enable_internal_pullup,
+                }
+            };
+        }
+
         int sda_io_num = -1;    /*!< GPIO number of I2C SDA signal */
         int scl_io_num = -1;    /*!< GPIO number of I2C SCL signal */
         bool enable_internal_pullup = I2C_ENABLE_INTERNAL_PULLUP_DEFAULT;   /*!< Enable internal pullups */
     };
-    using HostFullConfig = i2c_master_bus_config_t;
     using HostConfig = std::variant<HostPartialConfig, HostFullConfig>;
 
     using ControlPanelFullConfig = esp_lcd_panel_io_i2c_config_t;
@@ -0,0 +1,396 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "esp_panel_bus_conf_internal.h"
+#if ESP_PANEL_DRIVERS_BUS_ENABLE_I80
+
+#include "utils/esp_panel_utils_log.h"
+#include "esp_panel_bus_i80.hpp"
+
+namespace esp_panel::drivers {
+
+void BusI80::Config::convertPartialToFull()
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    if (std::holds_alternative<HostPartialConfig>(host)) {
+#if ESP_UTILS_CONF_LOG_LEVEL == ESP_UTILS_LOG_LEVEL_DEBUG
+        printHostConfig();
+#endif // ESP_UTILS_LOG_LEVEL_DEBUG
+        auto &config = std::get<HostPartialConfig>(host);
+        HostFullConfig full_config = {
+            .dc_gpio_num = config.dc_gpio_num,
+            .wr_gpio_num = config.wr_gpio_num,
+            .clk_src = LCD_CLK_SRC_DEFAULT,
+            .data_gpio_nums = {},
+            .bus_width = static_cast<size_t>(config.data_width),
+            .max_transfer_bytes = static_cast<size_t>(config.max_transfer_bytes),
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
+            // A non-zero burst size allows the DMA to fetch the color data from PSRAM directly
+            .dma_burst_size = 64,
+#else
+            .psram_trans_align = 64,
+            .sram_trans_align = 4,
+#endif // ESP_IDF_VERSION
+        };
+        int data_width_max = sizeof(full_config.data_gpio_nums) / sizeof(full_config.data_gpio_nums[0]);
+        for (int i = 0; i < data_width_max; i++) {
+            full_config.data_gpio_nums[i] = (i < I80_DATA_WIDTH_MAX) ? config.data_gpio_nums[i] : -1;
+        }
+        host = full_config;
+    }
+
+    if (std::holds_alternative<ControlPanelPartialConfig>(control_panel)) {
+#if ESP_UTILS_CONF_LOG_LEVEL == ESP_UTILS_LOG_LEVEL_DEBUG
+        printControlPanelConfig();
+#endif // ESP_UTILS_LOG_LEVEL_DEBUG
+        auto &config = std::get<ControlPanelPartialConfig>(control_panel);
+        // The 16-bit data width transfers a whole RGB565 pixel at once, so the bytes never need to be swapped
+        bool is_8bit = (std::get<HostFullConfig>(host).bus_width == 8);
+        control_panel = ControlPanelFullConfig{
+            .cs_gpio_num = config.cs_gpio_num,
+            .pclk_hz = static_cast<uint32_t>(config.pclk_hz),
+            .trans_queue_depth = static_cast<size_t>(config.trans_queue_depth),
+            .on_color_trans_done = nullptr,
+            .user_ctx = nullptr,
+            .lcd_cmd_bits = config.lcd_cmd_bits,
+            .lcd_param_bits = config.lcd_param_bits,
+            .dc_levels = {
+                .dc_idle_level = 0,
+                .dc_cmd_level = 0,
+                .dc_dummy_level = 0,
+                .dc_data_level = 1,
+            },
+            .flags = {
+                .cs_active_high = 0,
+                .reverse_color_bits = 0,
+                .swap_color_bytes = static_cast<unsigned int>(config.flags_swap_color_bytes && is_8bit),
+                .pclk_active_neg = config.flags_pclk_active_neg,
+                .pclk_idle_low = 0,
+            },
+        };
+    }
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+}
+
+void BusI80::Config::printHostConfig() const
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    if (std::holds_alternative<HostFullConfig>(host)) {
+        auto &config = std::get<HostFullConfig>(host);
+        ESP_UTILS_LOGI(
+            "\n\t{Host config}[full]"
+            "\n\t\t-> [dc_gpio_num]: %d"
+            "\n\t\t-> [wr_gpio_num]: %d"
+            "\n\t\t-> [clk_src]: %d"
+            "\n\t\t-> [bus_width]: %d"
+            "\n\t\t-> [max_transfer_bytes]: %d"
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
+            "\n\t\t-> [dma_burst_size]: %d"
+#else
+            "\n\t\t-> [psram_trans_align]: %d"
+#endif // ESP_IDF_VERSION
+            "\n\t\t-> [data_gpio_nums]: [%d, %d, %d, %d, %d, %d, %d, %d, "
+            "%d, %d, %d, %d, %d, %d, %d, %d]"
+            , static_cast<int>(config.dc_gpio_num)
+            , static_cast<int>(config.wr_gpio_num)
+            , static_cast<int>(config.clk_src)
+            , static_cast<int>(config.bus_width)
+            , static_cast<int>(config.max_transfer_bytes)
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
+            , static_cast<int>(config.dma_burst_size)
+#else
+            , static_cast<int>(config.psram_trans_align)
+#endif // ESP_IDF_VERSION
+            , config.data_gpio_nums[0], config.data_gpio_nums[1], config.data_gpio_nums[2]
+            , config.data_gpio_nums[3], config.data_gpio_nums[4], config.data_gpio_nums[5]
+            , config.data_gpio_nums[6], config.data_gpio_nums[7], config.data_gpio_nums[8]
+            , config.data_gpio_nums[9], config.data_gpio_nums[10], config.data_gpio_nums[11]
+            , config.data_gpio_nums[12], config.data_gpio_nums[13], config.data_gpio_nums[14]
+            , config.data_gpio_nums[15]
+        );
+    } else {
+        auto &config = std::get<HostPartialConfig>(host);
+        ESP_UTILS_LOGI(
+            "\n\t{Host config}[partial]"
+            "\n\t\t-> [dc_gpio_num]: %d"
+            "\n\t\t-> [wr_gpio_num]: %d"
+            "\n\t\t-> [data_width]: %d"
+            "\n\t\t-> [max_transfer_bytes]: %d"
+            "\n\t\t-> [data_gpio_nums]: [%d, %d, %d, %d, %d, %d, %d, %d, "
+            "%d, %d, %d, %d, %d, %d, %d, %d]"
+            , config.dc_gpio_num
+            , config.wr_gpio_num
+            , config.data_width
+            , config.max_transfer_bytes
+            , config.data_gpio_nums[0], config.data_gpio_nums[1], config.data_gpio_nums[2]
+            , config.data_gpio_nums[3], config.data_gpio_nums[4], config.data_gpio_nums[5]
+            , config.data_gpio_nums[6], config.data_gpio_nums[7], config.data_gpio_nums[8]
+            , config.data_gpio_nums[9], config.data_gpio_nums[10], config.data_gpio_nums[11]
+            , config.data_gpio_nums[12], config.data_gpio_nums[13], config.data_gpio_nums[14]
+            , config.data_gpio_nums[15]
+        );
+    }
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+}
+
+void BusI80::Config::printControlPanelConfig() const
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    if (std::holds_alternative<ControlPanelFullConfig>(control_panel)) {
+        auto &config = std::get<ControlPanelFullConfig>(control_panel);
+        ESP_UTILS_LOGI(
+            "\n\t{Control panel config}[full]"
+            "\n\t\t-> [cs_gpio_num]: %d"
+            "\n\t\t-> [pclk_hz]: %d"
+            "\n\t\t-> [trans_queue_depth]: %d"
+            "\n\t\t-> [lcd_cmd_bits]: %d"
+            "\n\t\t-> [lcd_param_bits]: %d"
+            "\n\t\t-> {flags}"
+            "\n\t\t\t-> [swap_color_bytes]: %d"
+            "\n\t\t\t-> [pclk_active_neg]: %d"
+            , static_cast<int>(config.cs_gpio_num)
+            , static_cast<int>(config.pclk_hz)
+            , static_cast<int>(config.trans_queue_depth)
+            , static_cast<int>(config.lcd_cmd_bits)
+            , static_cast<int>(config.lcd_param_bits)
+            , static_cast<int>(config.flags.swap_color_bytes)
+            , static_cast<int>(config.flags.pclk_active_neg)
+        );
+    } else {
+        auto &config = std::get<ControlPanelPartialConfig>(control_panel);
+        ESP_UTILS_LOGI(
+            "\n\t{Control panel config}[partial]"
+            "\n\t\t-> [cs_gpio_num]: %d"
+            "\n\t\t-> [pclk_hz]: %d"
+            "\n\t\t-> [trans_queue_depth]: %d"
+            "\n\t\t-> [lcd_cmd_bits]: %d"
+            "\n\t\t-> [lcd_param_bits]: %d"
+            "\n\t\t-> [flags_swap_color_bytes]: %d"
+            "\n\t\t-> [flags_pclk_active_neg]: %d"
+            , config.cs_gpio_num
+            , config.pclk_hz
+            , config.trans_queue_depth
+            , config.lcd_cmd_bits
+            , config.lcd_param_bits
+            , static_cast<int>(config.flags_swap_color_bytes)
+            , static_cast<int>(config.flags_pclk_active_neg)
+        );
+    }
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+}
+
+BusI80::~BusI80()
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_EXIT(del(), "Delete failed");
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+}
+
+bool BusI80::configI80_FreqHz(uint32_t hz)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isOverState(State::INIT), false, "Should be called before `init()`");
+
+    ESP_UTILS_LOGD("Param: hz(%d)", (int)hz);
+    getControlPanelFullConfig().pclk_hz = hz;
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool BusI80::configI80_CommandBits(uint32_t num)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isOverState(State::INIT), false, "Should be called before `init()`");
+
+    ESP_UTILS_LOGD("Param: num(%d)", (int)num);
+    getControlPanelFullConfig().lcd_cmd_bits = num;
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool BusI80::configI80_ParamBits(uint32_t num)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isOverState(State::INIT), false, "Should be called before `init()`");
+
+    ESP_UTILS_LOGD("Param: num(%d)", (int)num);
+    getControlPanelFullConfig().lcd_param_bits = num;
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool BusI80::configI80_TransQueueDepth(uint8_t depth)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isOverState(State::INIT), false, "Should be called before `init()`");
+
+    ESP_UTILS_LOGD("Param: depth(%d)", (int)depth);
+    getControlPanelFullConfig().trans_queue_depth = depth;
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool BusI80::configI80_MaxTransferBytes(uint32_t bytes)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isOverState(State::INIT), false, "Should be called before `init()`");
+
+    ESP_UTILS_LOGD("Param: bytes(%d)", (int)bytes);
+    getHostFullConfig().max_transfer_bytes = bytes;
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool BusI80::configI80_SwapColorBytes(bool en)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isOverState(State::INIT), false, "Should be called before `init()`");
+
+    ESP_UTILS_LOGD("Param: en(%d)", en);
+    getControlPanelFullConfig().flags.swap_color_bytes = en;
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool BusI80::configI80_PclkActiveNeg(bool en)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isOverState(State::INIT), false, "Should be called before `init()`");
+
+    ESP_UTILS_LOGD("Param: en(%d)", en);
+    getControlPanelFullConfig().flags.pclk_active_neg = en;
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool BusI80::init()
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isOverState(State::INIT), false, "Already initialized");
+
+    // Convert the partial configuration to full configuration
+    _config.convertPartialToFull();
+#if ESP_UTILS_CONF_LOG_LEVEL == ESP_UTILS_LOG_LEVEL_DEBUG
+    _config.printHostConfig();
+    _config.printControlPanelConfig();
+#endif // ESP_UTILS_LOG_LEVEL_DEBUG
+
+    auto data_width = getHostFullConfig().bus_width;
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        (data_width == 8) || (data_width == 16), false, "Invalid data width(%d), should be 8 or 16", (int)data_width
+    );
+
+    setState(State::INIT);
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool BusI80::begin()
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isOverState(State::BEGIN), false, "Already begun");
+
+    // Initialize the bus if not initialized
+    if (!isOverState(State::INIT)) {
+        ESP_UTILS_CHECK_FALSE_RETURN(init(), false, "Init failed");
+    }
+
+    // Create the host
+    ESP_UTILS_CHECK_ERROR_RETURN(
+        esp_lcd_new_i80_bus(&getHostFullConfig(), &_host_handle), false, "Create I80 host failed"
+    );
+    ESP_UTILS_LOGD("Create I80 host @%p", _host_handle);
+
+    // Create the control panel
+    ESP_UTILS_CHECK_ERROR_RETURN(
+        esp_lcd_new_panel_io_i80(_host_handle, &getControlPanelFullConfig(), &control_panel), false,
+        "Create control panel failed"
+    );
+    ESP_UTILS_LOGD("Create control panel @%p", control_panel);
+
+    setState(State::BEGIN);
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool BusI80::del()
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    // Delete the control panel if valid
+    if (isControlPanelValid()) {
+        ESP_UTILS_CHECK_FALSE_RETURN(delControlPanel(), false, "Delete control panel failed");
+    }
+
+    // The host can only be deleted after all the control panels on it are deleted
+    if (_host_handle != nullptr) {
+        ESP_UTILS_CHECK_ERROR_RETURN(esp_lcd_del_i80_bus(_host_handle), false, "Delete I80 host failed");
+        _host_handle = nullptr;
+    }
+
+    setState(State::DEINIT);
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+BusI80::HostFullConfig &BusI80::getHostFullConfig()
+{
+    if (std::holds_alternative<HostPartialConfig>(_config.host)) {
+        _config.convertPartialToFull();
+    }
+
+    return std::get<HostFullConfig>(_config.host);
+}
+
+BusI80::ControlPanelFullConfig &BusI80::getControlPanelFullConfig()
+{
+    if (std::holds_alternative<ControlPanelPartialConfig>(_config.control_panel)) {
+        _config.convertPartialToFull();
+    }
+
+    return std::get<ControlPanelFullConfig>(_config.control_panel);
+}
+
+} // namespace esp_panel::drivers
+
+#endif // ESP_PANEL_DRIVERS_BUS_ENABLE_I80
@@ -0,0 +1,332 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include "soc/soc_caps.h"
+#include "esp_panel_bus_conf_internal.h"
+#if ESP_PANEL_DRIVERS_BUS_ENABLE_I80
+
+#include <optional>
+#include <variant>
+#include "esp_lcd_panel_io.h"
+#include "esp_panel_bus.hpp"
+
+namespace esp_panel::drivers {
+
+/**
+ * @brief The I80 (Intel 8080 parallel) bus class for ESP Panel
+ *
+ * This class is derived from `Bus` class and provides I80 bus implementation for ESP Panel. The bus supports 8-bit and
+ * 16-bit data width, and the color data can be transferred from PSRAM by DMA directly.
+ *
+ * For the 8-bit data width, the bytes of color data are swapped by the hardware by default, so the color data should
+ * be in the native (little-endian) order.
+ */
+class BusI80: public Bus {
+public:
+    /**
+     * @brief Default values for I80 bus configuration
+     */
+    static constexpr BasicAttributes BASIC_ATTRIBUTES_DEFAULT = {
+        .type = ESP_PANEL_BUS_TYPE_I80,
+        .name = "I80",
+    };
+    static constexpr int I80_PCLK_HZ_DEFAULT = 20 * 1000 * 1000;
+    static constexpr int I80_DATA_WIDTH_DEFAULT = 8;
+    static constexpr int I80_DATA_WIDTH_MAX = 16;
+
+    using HostHandle = esp_lcd_i80_bus_handle_t;
+    using HostFullConfig = esp_lcd_i80_bus_config_t;
+    using ControlPanelFullConfig = esp_lcd_panel_io_i80_config_t;
+
+// *INDENT-OFF*
+    /**
+     * @brief Partial host configuration structure
+     */
+    struct HostPartialConfig {
+        int dc_gpio_num = -1;                                ///< GPIO number for DC signal
+        int wr_gpio_num = -1;                                ///< GPIO number for WR (PCLK) signal
+        int data_gpio_nums[I80_DATA_WIDTH_MAX] = {           ///< GPIO numbers for data signals
+            -1, -1, -1, -1, -1, -1, -1, -1,
+            -1, -1, -1, -1, -1, -1, -1, -1
+        };
+        int data_width = I80_DATA_WIDTH_DEFAULT;             ///< Data width in bits (8 or 16)
+        int max_transfer_bytes = ESP_PANEL_HOST_I80_MAX_TRANSFER_SIZE; ///< Maximum bytes of a single transfer
+    };
+// *INDENT-ON*
+
+    /**
+     * @brief Partial control panel configuration structure
+     */
+    struct ControlPanelPartialConfig {
+        int cs_gpio_num = -1;                ///< GPIO number for CS signal, set to -1 if not used
+        int pclk_hz = I80_PCLK_HZ_DEFAULT;   ///< Pixel clock frequency in Hz
+        int trans_queue_depth = 10;          ///< Transaction queue depth
+        int lcd_cmd_bits = 8;                ///< Bits for LCD commands
+        int lcd_param_bits = 8;              ///< Bits for LCD parameters
+        bool flags_swap_color_bytes = true;  ///< Swap the bytes of color data, only valid for the 8-bit data width
+        bool flags_pclk_active_neg = false;  ///< Latch data on the falling edge of PCLK if true
+    };
+
+    using HostConfig = std::variant<HostPartialConfig, HostFullConfig>;
+    using ControlPanelConfig = std::variant<ControlPanelPartialConfig, ControlPanelFullConfig>;
+
+    /**
+     * @brief The I80 bus configuration structure
+     */
+    struct Config {
+        /**
+         * @brief Convert partial configurations to full configurations
+         */
+        void convertPartialToFull();
+
+        /**
+         * @brief Print host configuration for debugging
+         */
+        void printHostConfig() const;
+
+        /**
+         * @brief Print control panel configuration for debugging
+         */
+        void printControlPanelConfig() const;
+
+        HostConfig host = HostPartialConfig{};                            ///< Host configuration
+        ControlPanelConfig control_panel = ControlPanelPartialConfig{};  ///< Control panel configuration
+    };
+
+// *INDENT-OFF*
+    /**
+     * @brief Construct the 8-bit I80 bus with separate parameters
+     *
+     * @param[in] dc_io   GPIO number for DC signal
+     * @param[in] wr_io   GPIO number for WR (PCLK) signal
+     * @param[in] cs_io   GPIO number for CS signal, set to -1 if not used
+     * @param[in] d[N]_io GPIO numbers for data signals, N is [0, 7]
+     *
+     * @note This function uses some default values to config the bus, use `config*()` functions to change them
+     */
+    BusI80(
+        int dc_io, int wr_io, int cs_io,
+        int d0_io, int d1_io, int d2_io, int d3_io, int d4_io, int d5_io, int d6_io, int d7_io
+    ):
+        Bus(BASIC_ATTRIBUTES_DEFAULT),
+        _config{
+            // Host
+            .host = HostPartialConfig{
+                .dc_gpio_num = dc_io,
+                .wr_gpio_num = wr_io,
+                .data_gpio_nums = {
+                    d0_io, d1_io, d2_io, d3_io, d4_io, d5_io, d6_io, d7_io,
+                    -1, -1, -1, -1, -1, -1, -1, -1
+                },
+                .data_width = 8,
+            },
+            // Control Panel
+            .control_panel = ControlPanelPartialConfig{
+                .cs_gpio_num = cs_io,
+            },
+        }
+    {
+    }
+
+    /**
+     * @brief Construct the 16-bit I80 bus with separate parameters
+     *
+     * @param[in] dc_io   GPIO number for DC signal
+     * @param[in] wr_io   GPIO number for WR (PCLK) signal
+     * @param[in] cs_io   GPIO number for CS signal, set to -1 if not used
+     * @param[in] d[N]_io GPIO numbers for data signals, N is [0, 15]
+     *
+     * @note This function uses some default values to config the bus, use `config*()` functions to change them
+     */
+    BusI80(
+        int dc_io, int wr_io, int cs_io,
+        int d0_io, int d1_io, int d2_io, int d3_io, int d4_io, int d5_io, int d6_io, int d7_io,
+        int d8_io, int d9_io, int d10_io, int d11_io, int d12_io, int d13_io, int d14_io, int d15_io
+    ):
+        Bus(BASIC_ATTRIBUTES_DEFAULT),
+        _config{
+            // Host
+            .host = HostPartialConfig{
+                .dc_gpio_num = dc_io,
+                .wr_gpio_num = wr_io,
+                .data_gpio_nums = {
+                    d0_io, d1_io, d2_io, d3_io, d4_io, d5_io, d6_io, d7_io,
+                    d8_io, d9_io, d10_io, d11_io, d12_io, d13_io, d14_io, d15_io
+                },
+                .data_width = 16,
+            },
+            // Control Panel
+            .control_panel = ControlPanelPartialConfig{
+                .cs_gpio_num = cs_io,
+                .flags_swap_color_bytes = false,
+            },
+        }
+    {
+    }
+
+    /**
+     * @brief Construct the I80 bus with full configurations
+     *
+     * @param[in] host_config          Full host configuration
+     * @param[in] control_panel_config Full control panel configuration
+     */
+    BusI80(const HostFullConfig &host_config, const ControlPanelFullConfig &control_panel_config):
+        Bus(BASIC_ATTRIBUTES_DEFAULT),
+        _config{
+            .host = host_config,
+            .control_panel = control_panel_config,
+        }
+    {
+    }
+
+    /**
+     * @brief Construct the I80 bus with complete configuration
+     *
+     * @param[in] config Complete I80 bus configuration
+     */
+    BusI80(const Config &config):
+        Bus(BASIC_ATTRIBUTES_DEFAULT),
+        _config(config)
+    {
+    }
+// *INDENT-ON*
+
+    /**
+     * @brief Destroy the I80 bus instance
+     */
+    ~BusI80() override;
+
+    /**
+     * @brief Configure I80 clock frequency
+     *
+     * @param[in] hz Clock frequency in Hz
+     * @return `true` if configuration succeeds, `false` otherwise
+     * @note This function should be called before `init()`
+     */
+    bool configI80_FreqHz(uint32_t hz);
+
+    /**
+     * @brief Configure number of bits for I80 commands
+     *
+     * @param[in] num Number of bits for commands
+     * @return `true` if configuration succeeds, `false` otherwise
+     * @note This function should be called before `init()`
+     */
+    bool configI80_CommandBits(uint32_t num);
+
+    /**
+     * @brief Configure number of bits for I80 parameters
+     *
+     * @param[in] num Number of bits for parameters
+     * @return `true` if configuration succeeds, `false` otherwise
+     * @note This function should be called before `init()`
+     */
+    bool configI80_ParamBits(uint32_t num);
+
+    /**
+     * @brief Configure I80 transaction queue depth
+     *
+     * @param[in] depth Queue depth for I80 transactions
+     * @return `true` if configuration succeeds, `false` otherwise
+     * @note This function should be called before `init()`
+     */
+    bool configI80_TransQueueDepth(uint8_t depth);
+
+    /**
+     * @brief Configure the maximum bytes of a single I80 transfer
+     *
+     * @param[in] bytes Maximum bytes, usually set to the size of the largest bitmap to draw
+     * @return `true` if configuration succeeds, `false` otherwise
+     * @note This function should be called before `init()`
+     */
+    bool configI80_MaxTransferBytes(uint32_t bytes);
+
+    /**
+     * @brief Configure whether to swap the bytes of color data
+     *
+     * @param[in] en Whether to swap, should be `false` for the 16-bit data width
+     * @return `true` if configuration succeeds, `false` otherwise
+     * @note This function should be called before `init()`
+     */
+    bool configI80_SwapColorBytes(bool en);
+
+    /**
+     * @brief Configure whether to latch data on the falling edge of PCLK
+     *
+     * @param[in] en Whether to latch on the falling edge
+     * @return `true` if configuration succeeds, `false` otherwise
+     * @note This function should be called before `init()`
+     */
+    bool configI80_PclkActiveNeg(bool en);
+
+    /**
+     * @brief Initialize the I80 bus
+     *
+     * @return `true` if initialization succeeds, `false` otherwise
+     */
+    bool init() override;
+
+    /**
+     * @brief Start the I80 bus operation
+     *
+     * @return `true` if startup succeeds, `false` otherwise
+     */
+    bool begin() override;
+
+    /**
+     * @brief Delete the I80 bus instance and release resources
+     *
+     * @return `true` if deletion succeeds, `false` otherwise
+     */
+    bool del() override;
+
+    /**
+     * @brief Get the current bus configuration
+     *
+     * @return Reference to the current bus configuration
+     */
+    const Config &getConfig() const
+    {
+        return _config;
+    }
+
+    /**
+     * @brief Get the I80 host handle
+     *
+     * @return I80 host handle if the bus has begun, `nullptr` otherwise
+     */
+    HostHandle getHostHandle() const
+    {
+        return _host_handle;
+    }
+
+private:
+    /**
+     * @brief Get mutable reference to host full configuration
+     *
+     * Converts partial configuration to full configuration if necessary
+     *
+     * @return Reference to host full configuration
+     */
+    HostFullConfig &getHostFullConfig();
+
+    /**
+     * @brief Get mutable reference to control panel full configuration
+     *
+     * Converts partial configuration to full configuration if necessary
+     *
+     * @return Reference to control panel full configuration
+     */
+    ControlPanelFullConfig &getControlPanelFullConfig();
+
+    Config _config = {};                  ///< I80 bus configuration
+    HostHandle _host_handle = nullptr;    ///< I80 host handle
+};
+
+} // namespace esp_panel::drivers
+
+#endif // ESP_PANEL_DRIVERS_BUS_ENABLE_I80
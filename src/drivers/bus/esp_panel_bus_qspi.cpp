@@ -21,47 +21,14 @@ void BusQSPI::Config::convertPartialToFull()
 #if ESP_UTILS_CONF_LOG_LEVEL == ESP_UTILS_LOG_LEVEL_DEBUG
         printHostConfig();
 #endif // ESP_UTILS_LOG_LEVEL_DEBUG
-        auto &config = std::get<HostPartialConfig>(host.value());
-        host = HostFullConfig{
-            .data0_io_num = config.data0_io_num,
-            .data1_io_num = config.data1_io_num,
-            .sclk_io_num = config.sclk_io_num,
-            .data2_io_num = config.data2_io_num,
-            .data3_io_num = config.data3_io_num,
-            .data4_io_num = -1,
-            .data5_io_num = -1,
-            .data6_io_num = -1,
-            .data7_io_num = -1,
-            .max_transfer_sz = ESP_PANEL_HOST_SPI_MAX_TRANSFER_SIZE,
-            .flags = SPICOMMON_BUSFLAG_MASTER,
-            .intr_flags = 0,
-        };
+        host = std::get<HostPartialConfig>(host.value()).toFull();
     }
 
     if (std::holds_alternative<ControlPanelPartialConfig>(control_panel)) {
 #if ESP_UTILS_CONF_LOG_LEVEL == ESP_UTILS_LOG_LEVEL_DEBUG
         printControlPanelConfig();
 #endif // ESP_UTILS_LOG_LEVEL_DEBUG
-        auto &config = std::get<ControlPanelPartialConfig>(control_panel);
-        control_panel = ControlPanelFullConfig{
-            .cs_gpio_num = config.cs_gpio_num,
-            .dc_gpio_num = -1,
-            .spi_mode = config.spi_mode,
-            .pclk_hz = static_cast<unsigned int>(config.pclk_hz),
-            .trans_queue_depth = 10,
-            .on_color_trans_done = nullptr,
-            .user_ctx = nullptr,
-            .lcd_cmd_bits = config.lcd_cmd_bits,
-            .lcd_param_bits = config.lcd_param_bits,
-            .flags = {
-                .dc_low_on_data = 0,
-                .octal_mode = 0,
-                .quad_mode = 1,
-                .sio_mode = 0,
-                .lsb_first = 0,
-                .cs_high_active = 0,
-            },
-        };
+        control_panel = std::get<ControlPanelPartialConfig>(control_panel).toFull();
     }
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
@@ -338,6 +305,20 @@ bool BusQSPI::del()
     return true;
 }
 
+bool BusQSPI::writeRegisterRun(const RegisterCommand *commands, size_t num) const
+{
+    for (size_t i = 0; i < num; i++) {
+        auto &command = commands[i];
+        ESP_UTILS_CHECK_ERROR_RETURN(
+            esp_lcd_panel_io_tx_param(
+                control_panel, encodeQSPI_Command(command.address), command.data, command.data_size
+            ), false, "Write command(0x%02x) failed", command.address
+        );
+    }
+
+    return true;
+}
+
 BusQSPI::ControlPanelFullConfig &BusQSPI::getControlPanelFullConfig()
 {
     if (std::holds_alternative<ControlPanelPartialConfig>(_config.control_panel)) {
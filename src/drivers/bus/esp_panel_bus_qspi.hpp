@@ -35,30 +35,85 @@ public:
     };
     static constexpr int QSPI_HOST_ID_DEFAULT = static_cast<int>(SPI2_HOST);
     static constexpr int QSPI_PCLK_HZ_DEFAULT = SPI_MASTER_FREQ_40M;
+    static constexpr int QSPI_OPCODE_WRITE_CMD = 0x02;
+
+    using HostFullConfig = spi_bus_config_t;
+    using ControlPanelFullConfig = esp_lcd_panel_io_spi_config_t;
 
     /**
      * @brief Partial host configuration structure
      */
     struct HostPartialConfig {
+        /**
+         * @brief Convert to the full configuration
+         *
+         * @return Full host configuration
+         * @note This function can be evaluated at compile time
+         */
+        constexpr HostFullConfig toFull() const
+        {
+            return HostFullConfig{
+                .data0_io_num = data0_io_num,
+                .data1_io_num = data1_io_num,
+                .sclk_io_num = sclk_io_num,
+                .data2_io_num = data2_io_num,
+                .data3_io_num = data3_io_num,
+                .data4_io_num = -1,
+                .data5_io_num = -1,
+                .data6_io_num = -1,
+                .data7_io_num = -1,
+                .max_transfer_sz = ESP_PANEL_HOST_SPI_MAX_TRANSFER_SIZE,
+                .flags = SPICOMMON_BUSFLAG_MASTER,
+                .intr_flags = 0,
+            };
+        }
+
         int sclk_io_num = -1;    ///< GPIO number for SCLK signal
         int data0_io_num = -1;   ///< GPIO number for DATA0 signal
         int data1_io_num = -1;   ///< GPIO number for DATA1 signal
         int data2_io_num = -1;   ///< GPIO number for DATA2 signal
         int data3_io_num = -1;   ///< GPIO number for DATA3 signal
     };
-    using HostFullConfig = spi_bus_config_t;
 
     /**
      * @brief Partial control panel configuration structure
      */
     struct ControlPanelPartialConfig {
+        /**
+         * @brief Convert to the full configuration
+         *
+         * @return Full control panel configuration
+         * @note This function can be evaluated at compile time
+         */
+        constexpr ControlPanelFullConfig toFull() const
+        {
+            return ControlPanelFullConfig{
+                .cs_gpio_num = cs_gpio_num,
+                .dc_gpio_num = -1,
+                .spi_mode = spi_mode,
+                .pclk_hz = static_cast<unsigned int>(pclk_hz),
+                .trans_queue_depth = 10,
+                .on_color_trans_done = nullptr,
+                .user_ctx = nullptr,
+                .lcd_cmd_bits = lcd_cmd_bits,
+                .lcd_param_bits = lcd_param_bits,
+                .flags = {
+                    .dc_low_on_data = 0,
+                    .octal_mode = 0,
+                    .quad_mode = 1,
+                    .sio_mode = 0,
+                    .lsb_first = 0,
+                    .cs_high_active = 0,
+                },
+            };
+        }
+
         int cs_gpio_num = -1;        ///< GPIO number for CS signal
         int spi_mode = 0;            ///< QSPI mode (0-3)
         int pclk_hz = QSPI_PCLK_HZ_DEFAULT;  ///< QSPI clock frequency in Hz
         int lcd_cmd_bits = 32;       ///< Bits for LCD commands
         int lcd_param_bits = 8;      ///< Bits for LCD parameters
     };
-    using ControlPanelFullConfig = esp_lcd_panel_io_spi_config_t;
 
     using HostConfig = std::variant<HostPartialConfig, HostFullConfig>;
     using ControlPanelConfig = std::variant<ControlPanelPartialConfig, ControlPanelFullConfig>;
@@ -227,6 +282,19 @@ public:
         return _config;
     }
 
+    /**
+     * @brief Encode a plain LCD command into the command of the QSPI control panel
+     *
+     * @param[in] command Plain LCD command (e.g. `0x36`), the commands larger than `0xFF` are regarded as encoded and
+     *                    returned as is
+     *
+     * @return Command with the write opcode and the command in the address phase (e.g. `0x02003600`)
+     */
+    static constexpr int encodeQSPI_Command(int command)
+    {
+        return ((command & ~0xFF) != 0) ? command : ((QSPI_OPCODE_WRITE_CMD << 24) | (command << 8));
+    }
+
     /**
      * @brief Alias for backward compatibility
      * @deprecated Use `configQSPI_Mode()` instead
@@ -257,6 +325,20 @@ public:
         configQSPI_TransQueueDepth(depth);
     }
 
+protected:
+    /**
+     * @brief Write a run of register commands without delay, called by `writeRegisterBatch()`
+     *
+     * The plain commands are encoded by `encodeQSPI_Command()`, so the vendor initialization commands can be written
+     * without copying them.
+     *
+     * @param[in] commands Array of register commands
+     * @param[in] num      Number of commands in the array
+     *
+     * @return `true` if all commands are written, `false` otherwise
+     */
+    bool writeRegisterRun(const RegisterCommand *commands, size_t num) const override;
+
 private:
     /**
      * @brief Check if host is skipped initialization
@@ -10,6 +10,7 @@
 #include <cstdlib>
 #include <cstring>
 #include "esp_lcd_panel_io.h"
+#include "esp_timer.h"
 #include "utils/esp_panel_utils_log.h"
 #include "esp_panel_bus_rgb.hpp"
 
@@ -525,6 +526,61 @@ bool BusRGB::configRGB_BounceBufferSize(uint32_t size_in_pixel)
     return true;
 }
 
+bool BusRGB::planRGB_BounceBuffer(BusRGBPlanner::Plan &plan, const BusRGBPlanner::Budget &budget)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_LOGD(
+        "Param: psram_bandwidth(%d), fill_overhead_ns(%d), sram_budget_bytes(%d), margin_percent(%d)",
+        static_cast<int>(budget.psram_bandwidth), static_cast<int>(budget.fill_overhead_ns),
+        static_cast<int>(budget.sram_budget_bytes), budget.margin_percent
+    );
+    plan = BusRGBPlanner::plan(getPlannerTiming(), budget);
+    ESP_UTILS_CHECK_FALSE_RETURN(plan.is_valid, false, "No valid bounce buffer size within the budget");
+
+    ESP_UTILS_LOGD(
+        "Plan: bounce_buffer_size_px(%d), max_pclk_hz(%d), fill_time_ns(%d), send_time_ns(%d), is_stable(%d)",
+        static_cast<int>(plan.bounce_buffer_size_px), static_cast<int>(plan.max_pclk_hz),
+        static_cast<int>(plan.fill_time_ns), static_cast<int>(plan.send_time_ns), plan.is_stable
+    );
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool BusRGB::configRGB_BounceBufferAuto(const BusRGBPlanner::Budget &budget, bool limit_pclk)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isOverState(State::INIT), false, "Should be called before `init()`");
+
+    BusRGBPlanner::Plan plan = {};
+    ESP_UTILS_CHECK_FALSE_RETURN(planRGB_BounceBuffer(plan, budget), false, "Plan bounce buffer failed");
+
+    auto &config = getRefreshPanelFullConfig();
+    if (!plan.is_stable) {
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            limit_pclk, false, "PCLK(%d) is not stable, the maximum stable one is %d",
+            static_cast<int>(config.timings.pclk_hz), static_cast<int>(plan.max_pclk_hz)
+        );
+        ESP_UTILS_LOGW(
+            "Lowered PCLK from %d to %d Hz to avoid underrun", static_cast<int>(config.timings.pclk_hz),
+            static_cast<int>(plan.max_pclk_hz)
+        );
+        config.timings.pclk_hz = plan.max_pclk_hz;
+    }
+    config.bounce_buffer_size_px = plan.bounce_buffer_size_px;
+    ESP_UTILS_LOGI(
+        "Bounce buffer size: %d pixels, refresh rate: %d.%02d Hz", static_cast<int>(plan.bounce_buffer_size_px),
+        static_cast<int>(plan.refresh_rate_x100 / 100), static_cast<int>(plan.refresh_rate_x100 % 100)
+    );
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
 bool BusRGB::configRGB_TimingFlags(
     bool hsync_idle_low, bool vsync_idle_low, bool de_idle_high, bool pclk_active_neg, bool pclk_idle_high
 )
@@ -695,6 +751,117 @@ bool BusRGB::del()
     return true;
 }
 
+bool BusRGB::attachRGB_UnderrunMonitor(esp_lcd_panel_handle_t refresh_panel)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_NULL_RETURN(refresh_panel, false, "Invalid refresh panel");
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        getRefreshPanelFullConfig().bounce_buffer_size_px > 0, false, "Bounce buffer is not used"
+    );
+
+    ESP_UTILS_LOGD("Param: refresh_panel(@%p)", refresh_panel);
+    auto timing = getPlannerTiming();
+    _underrun_monitor.required_slack_us = static_cast<int32_t>(BusRGBPlanner::getMinFillSlackNs(
+                                              timing, timing.pclk_hz, getRefreshPanelFullConfig().bounce_buffer_size_px
+                                          ) / 1000);
+    ESP_UTILS_LOGD("Required slack: %d us", static_cast<int>(_underrun_monitor.required_slack_us));
+    resetRGB_UnderrunStats();
+    esp_lcd_rgb_panel_event_callbacks_t callbacks = {};
+    callbacks.on_vsync = onUnderrunMonitorVsync;
+    callbacks.on_bounce_frame_finish = onUnderrunMonitorBounceFrameFinish;
+    ESP_UTILS_CHECK_ERROR_RETURN(
+        esp_lcd_rgb_panel_register_event_callbacks(refresh_panel, &callbacks, this), false,
+        "Register event callbacks failed"
+    );
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+BusRGB::UnderrunStats BusRGB::getRGB_UnderrunStats() const
+{
+    return UnderrunStats{
+        .frames = _underrun_monitor.frames.load(),
+        .underruns = _underrun_monitor.underruns.load(),
+        .min_slack_us = _underrun_monitor.min_slack_us.load(),
+        .required_slack_us = _underrun_monitor.required_slack_us,
+    };
+}
+
+void BusRGB::resetRGB_UnderrunStats()
+{
+    // The ISR only counts after the next VSYNC, so the fill state is reset along with the counters
+    _underrun_monitor.is_started = false;
+    _underrun_monitor.is_filled = false;
+    _underrun_monitor.frames = 0;
+    _underrun_monitor.underruns = 0;
+    _underrun_monitor.min_slack_us = -1;
+}
+
+BusRGBPlanner::Timing BusRGB::getPlannerTiming()
+{
+    auto &config = getRefreshPanelFullConfig();
+
+    return BusRGBPlanner::Timing{
+        .pclk_hz = config.timings.pclk_hz,
+        .h_res = config.timings.h_res,
+        .v_res = config.timings.v_res,
+        .hsync_pulse_width = config.timings.hsync_pulse_width,
+        .hsync_back_porch = config.timings.hsync_back_porch,
+        .hsync_front_porch = config.timings.hsync_front_porch,
+        .vsync_pulse_width = config.timings.vsync_pulse_width,
+        .vsync_back_porch = config.timings.vsync_back_porch,
+        .vsync_front_porch = config.timings.vsync_front_porch,
+        .bits_per_pixel = static_cast<uint32_t>(config.bits_per_pixel),
+    };
+}
+
+IRAM_ATTR bool BusRGB::onUnderrunMonitorVsync(
+    esp_lcd_panel_handle_t panel, const esp_lcd_rgb_panel_event_data_t *edata, void *user_ctx
+)
+{
+    auto bus = static_cast<BusRGB *>(user_ctx);
+    auto &monitor = bus->_underrun_monitor;
+
+    // Each VSYNC period should contain exactly one end of filling, no matter where the VSYNC is in the blanking
+    if (monitor.is_started) {
+        monitor.frames++;
+        if (!monitor.is_filled) {
+            monitor.underruns++;
+        } else {
+            int32_t slack_us = static_cast<int32_t>(esp_timer_get_time() - monitor.fill_finish_us);
+            int32_t min_slack_us = monitor.min_slack_us.load();
+            if ((min_slack_us < 0) || (slack_us < min_slack_us)) {
+                monitor.min_slack_us = slack_us;
+            }
+            // The last bounce buffer should be filled while the previous one is sent, so a shorter slack means the
+            // DMA has read a bounce buffer before it was filled
+            if (slack_us < monitor.required_slack_us) {
+                monitor.underruns++;
+            }
+        }
+    }
+    monitor.is_started = true;
+    monitor.is_filled = false;
+
+    return false;
+}
+
+IRAM_ATTR bool BusRGB::onUnderrunMonitorBounceFrameFinish(
+    esp_lcd_panel_handle_t panel, const esp_lcd_rgb_panel_event_data_t *edata, void *user_ctx
+)
+{
+    auto bus = static_cast<BusRGB *>(user_ctx);
+    auto &monitor = bus->_underrun_monitor;
+
+    monitor.fill_finish_us = esp_timer_get_time();
+    monitor.is_filled = true;
+
+    return false;
+}
+
 BusRGB::ControlPanelFullConfig &BusRGB::getControlPanelFullConfig()
 {
     if (std::holds_alternative<ControlPanelPartialConfig>(_config.control_panel.value())) {
@@ -9,13 +9,16 @@
 #include "esp_panel_bus_conf_internal.h"
 #if ESP_PANEL_DRIVERS_BUS_ENABLE_RGB
 
+#include <atomic>
 #include <memory>
 #include <optional>
 #include <variant>
+#include "esp_attr.h"
 #include "esp_lcd_panel_rgb.h"
 #include "esp_io_expander.hpp"
 #include "port/esp_lcd_panel_io_additions.h"
 #include "esp_panel_bus.hpp"
+#include "esp_panel_bus_rgb_planner.hpp"
 
 /**
  * @brief Define RGB data width based on SOC capabilities
@@ -54,6 +57,21 @@ public:
     static constexpr int RGB_PCLK_HZ_DEFAULT = 16 * 1000 * 1000;
     static constexpr int RGB_DATA_WIDTH_DEFAULT = 16;
 
+    /**
+     * @brief Statistics of the bounce buffer underrun monitor
+     */
+    struct UnderrunStats {
+        uint32_t frames = 0;        ///< Number of the monitored frames
+        uint32_t underruns = 0;     ///< Number of the frames whose bounce buffers were filled too late
+        /**
+         * Minimum time from the end of filling the last bounce buffer of a frame (`on_bounce_frame_finish`) to the
+         * next VSYNC, -1 if not measured. It includes sending the last bounce buffer and the vertical blanking, so
+         * it is never below `required_slack_us` without an underrun
+         */
+        int32_t min_slack_us = -1;
+        int32_t required_slack_us = 0;  ///< Time of sending one bounce buffer plus the vertical blanking
+    };
+
     /**
      * @brief Partial control panel configuration structure
      */
@@ -472,6 +490,30 @@ public:
      */
     bool configRGB_BounceBufferSize(uint32_t size_in_pixel);
 
+    /**
+     * @brief Plan the bounce buffer size and the maximum stable PCLK for the current timing
+     *
+     * @param[out] plan   Result of the planning, see `BusRGBPlanner::plan()`
+     * @param[in]  budget Budget of the bounce buffers, including the PSRAM throughput
+     *
+     * @return `true` if a bounce buffer size within the budget is found, `false` otherwise
+     * @note This function only suggests the configuration, use `configRGB_BounceBufferAuto()` to apply it
+     */
+    bool planRGB_BounceBuffer(BusRGBPlanner::Plan &plan, const BusRGBPlanner::Budget &budget = BusRGBPlanner::Budget{});
+
+    /**
+     * @brief Configure the bounce buffer size by the planner
+     *
+     * @param[in] budget     Budget of the bounce buffers, including the PSRAM throughput
+     * @param[in] limit_pclk Whether to lower the PCLK to the maximum stable one if the current PCLK is not stable
+     *
+     * @return `true` if configuration succeeds, `false` otherwise
+     * @note This function should be called before `init()` and after the timing is configured
+     */
+    bool configRGB_BounceBufferAuto(
+        const BusRGBPlanner::Budget &budget = BusRGBPlanner::Budget{}, bool limit_pclk = true
+    );
+
     /**
      * @brief Configure RGB timing flags
      *
@@ -518,6 +560,37 @@ public:
         return _config;
     }
 
+    /**
+     * @brief Attach the bounce buffer underrun monitor to the refresh panel
+     *
+     * A frame is counted as underrun if the VSYNC comes before all its bounce buffers are filled, or if the time from
+     * the end of filling to the VSYNC is shorter than sending one bounce buffer plus the vertical blanking (see
+     * `BusRGBPlanner::getMinFillSlackNs()`), since the DMA then has caught up with the filling. This validates the plan
+     * of `planRGB_BounceBuffer()` at runtime.
+     *
+     * @param[in] refresh_panel Handle of the RGB refresh panel, which should use the bounce buffers
+     *
+     * @return `true` if attachment succeeds, `false` otherwise
+     * @note `esp_lcd_rgb_panel_register_event_callbacks()` replaces all the callbacks of the refresh panel and their
+     *       user context at once, so this function drops any `on_vsync`, `on_bounce_empty`, `on_bounce_frame_finish`
+     *       or `on_frame_buf_complete` callback registered before (e.g. by the LCD driver or the user). Likewise, any
+     *       registration after it (e.g. the refresh finish callback of the LCD) detaches the monitor. Only use it when
+     *       no other RGB panel callback is needed, such as in a bring-up or a test.
+     */
+    bool attachRGB_UnderrunMonitor(esp_lcd_panel_handle_t refresh_panel);
+
+    /**
+     * @brief Get the statistics of the bounce buffer underrun monitor
+     *
+     * @return Statistics since the monitor is attached or reset
+     */
+    UnderrunStats getRGB_UnderrunStats() const;
+
+    /**
+     * @brief Reset the statistics of the bounce buffer underrun monitor
+     */
+    void resetRGB_UnderrunStats();
+
     /**
      * @brief Alias for backward compatibility
      * @deprecated Use other constructors instead
@@ -695,7 +768,30 @@ private:
      */
     RefreshPanelFullConfig &getRefreshPanelFullConfig();
 
+    /**
+     * @brief Convert the refresh panel configuration to the timing of the planner
+     *
+     * @return Timing of the planner
+     */
+    BusRGBPlanner::Timing getPlannerTiming();
+
+    IRAM_ATTR static bool onUnderrunMonitorVsync(
+        esp_lcd_panel_handle_t panel, const esp_lcd_rgb_panel_event_data_t *edata, void *user_ctx
+    );
+    IRAM_ATTR static bool onUnderrunMonitorBounceFrameFinish(
+        esp_lcd_panel_handle_t panel, const esp_lcd_rgb_panel_event_data_t *edata, void *user_ctx
+    );
+
     Config _config = {};  ///< RGB bus configuration
+    struct {
+        std::atomic<uint32_t> frames{0};
+        std::atomic<uint32_t> underruns{0};
+        std::atomic<int32_t> min_slack_us{-1};
+        int32_t required_slack_us = 0;
+        int64_t fill_finish_us = 0;
+        bool is_filled = false;
+        bool is_started = false;
+    } _underrun_monitor;  ///< State of the bounce buffer underrun monitor, updated in the ISR
 };
 
 } // namespace esp_panel::drivers
@@ -0,0 +1,223 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace esp_panel::drivers {
+
+/**
+ * @brief The bounce buffer planner of the RGB bus
+ *
+ * When the bounce buffers are enabled, the CPU copies the frame buffer from PSRAM into one bounce buffer (in SRAM)
+ * while the DMA sends the other one. The panel shows artifacts (underrun) once a copy takes longer than sending a
+ * bounce buffer. This class models the time of both, so the bounce buffer size and the maximum stable PCLK can be
+ * derived from the PSRAM throughput, instead of tuning them by trial and error.
+ *
+ * It only depends on the C++ standard library, so it can also be used by the host tools.
+ */
+class BusRGBPlanner {
+public:
+    /**
+     * @brief Default values for the budget
+     */
+    static constexpr uint32_t PSRAM_BANDWIDTH_DEFAULT = 40 * 1000 * 1000;
+    static constexpr uint32_t FILL_OVERHEAD_NS_DEFAULT = 5 * 1000;
+    static constexpr uint32_t SRAM_BUDGET_BYTES_DEFAULT = 64 * 1024;
+    static constexpr uint8_t MARGIN_PERCENT_DEFAULT = 20;
+    static constexpr uint32_t DMA_ALIGN_BYTES = 64;
+
+    /**
+     * @brief Timing of the panel, same as the fields of `esp_lcd_rgb_timing_t`
+     */
+    struct Timing {
+        uint32_t pclk_hz = 0;               ///< Target pixel clock frequency in Hz
+        uint32_t h_res = 0;                 ///< Horizontal resolution
+        uint32_t v_res = 0;                 ///< Vertical resolution
+        uint32_t hsync_pulse_width = 0;     ///< HSYNC pulse width
+        uint32_t hsync_back_porch = 0;      ///< HSYNC back porch
+        uint32_t hsync_front_porch = 0;     ///< HSYNC front porch
+        uint32_t vsync_pulse_width = 0;     ///< VSYNC pulse width
+        uint32_t vsync_back_porch = 0;      ///< VSYNC back porch
+        uint32_t vsync_front_porch = 0;     ///< VSYNC front porch
+        uint32_t bits_per_pixel = 16;       ///< Bits per pixel
+    };
+
+    /**
+     * @brief Budget of the bounce buffers
+     */
+    struct Budget {
+        uint32_t psram_bandwidth = PSRAM_BANDWIDTH_DEFAULT;     ///< Throughput of copying from PSRAM to SRAM, in bytes/s
+        uint32_t fill_overhead_ns = FILL_OVERHEAD_NS_DEFAULT;   ///< Fixed cost of each fill (interrupt, cache), in ns
+        uint32_t sram_budget_bytes = SRAM_BUDGET_BYTES_DEFAULT; ///< Maximum SRAM for both bounce buffers
+        uint8_t margin_percent = MARGIN_PERCENT_DEFAULT;        ///< Headroom of the fill time against the send time
+    };
+
+    /**
+     * @brief Result of the planning
+     */
+    struct Plan {
+        bool is_valid = false;              ///< Whether a bounce buffer size within the budget is found
+        bool is_stable = false;             ///< Whether the target PCLK is stable with the bounce buffer size
+        uint32_t bounce_buffer_size_px = 0; ///< Bounce buffer size in pixels
+        uint32_t max_pclk_hz = 0;           ///< Maximum stable PCLK with the bounce buffer size
+        uint32_t fill_time_ns = 0;          ///< Time of filling a bounce buffer
+        uint32_t send_time_ns = 0;          ///< Time of sending a bounce buffer at the target PCLK
+        uint32_t refresh_rate_x100 = 0;     ///< Refresh rate at the PCLK to use, in 0.01 Hz
+    };
+
+    /**
+     * @brief Get the total pixels of a line, including the porches
+     */
+    static constexpr uint64_t getLineTotal(const Timing &timing)
+    {
+        return static_cast<uint64_t>(timing.h_res) + timing.hsync_pulse_width + timing.hsync_back_porch +
+               timing.hsync_front_porch;
+    }
+
+    /**
+     * @brief Get the total lines of a frame, including the porches
+     */
+    static constexpr uint64_t getFrameLines(const Timing &timing)
+    {
+        return static_cast<uint64_t>(timing.v_res) + timing.vsync_pulse_width + timing.vsync_back_porch +
+               timing.vsync_front_porch;
+    }
+
+    /**
+     * @brief Get the refresh rate in 0.01 Hz
+     */
+    static constexpr uint32_t getRefreshRateX100(const Timing &timing, uint32_t pclk_hz)
+    {
+        uint64_t frame_pixels = getLineTotal(timing) * getFrameLines(timing);
+
+        return (frame_pixels == 0) ? 0 : static_cast<uint32_t>(static_cast<uint64_t>(pclk_hz) * 100 / frame_pixels);
+    }
+
+    /**
+     * @brief Get the time of filling a bounce buffer in ns
+     */
+    static constexpr uint64_t getFillTimeNs(const Timing &timing, const Budget &budget, uint32_t size_px)
+    {
+        uint64_t bytes = static_cast<uint64_t>(size_px) * timing.bits_per_pixel / 8;
+
+        return bytes * 1000000000ULL / budget.psram_bandwidth + budget.fill_overhead_ns;
+    }
+
+    /**
+     * @brief Get the time of sending a bounce buffer in ns
+     *
+     * The DMA only reads data in the active area, so the horizontal porches give the CPU extra time.
+     */
+    static constexpr uint64_t getSendTimeNs(const Timing &timing, uint32_t pclk_hz, uint32_t size_px)
+    {
+        return static_cast<uint64_t>(size_px) * getLineTotal(timing) * 1000000000ULL /
+               (static_cast<uint64_t>(timing.h_res) * pclk_hz);
+    }
+
+    /**
+     * @brief Get the time of the vertical blanking (VSYNC pulse and porches) in ns
+     */
+    static constexpr uint64_t getVerticalBlankingTimeNs(const Timing &timing, uint32_t pclk_hz)
+    {
+        uint64_t lines = static_cast<uint64_t>(timing.vsync_pulse_width) + timing.vsync_back_porch +
+                         timing.vsync_front_porch;
+
+        return (pclk_hz == 0) ? 0 : lines * getLineTotal(timing) * 1000000000ULL / pclk_hz;
+    }
+
+    /**
+     * @brief Get the minimum time from the end of filling the last bounce buffer of a frame to the next VSYNC in ns
+     *
+     * The last bounce buffer should be filled while the previous one is sent, so at least the last one is still to be
+     * sent, followed by the vertical blanking. A shorter time means the DMA has caught up with the filling.
+     */
+    static constexpr uint64_t getMinFillSlackNs(const Timing &timing, uint32_t pclk_hz, uint32_t size_px)
+    {
+        if (pclk_hz == 0) {
+            return 0;
+        }
+
+        return getSendTimeNs(timing, pclk_hz, size_px) + getVerticalBlankingTimeNs(timing, pclk_hz);
+    }
+
+    /**
+     * @brief Get the maximum stable PCLK with the given bounce buffer size
+     *
+     * The PCLK is stable if `fill_time <= send_time * (100 - margin_percent) / 100`.
+     */
+    static constexpr uint32_t getMaxStablePclkHz(const Timing &timing, const Budget &budget, uint32_t size_px)
+    {
+        uint64_t fill_time_ns = getFillTimeNs(timing, budget, size_px);
+        uint64_t pclk_hz = static_cast<uint64_t>(size_px) * getLineTotal(timing) * 1000000000ULL *
+                           (100 - budget.margin_percent) / (100ULL * timing.h_res * fill_time_ns);
+
+        return (pclk_hz > UINT32_MAX) ? UINT32_MAX : static_cast<uint32_t>(pclk_hz);
+    }
+
+    /**
+     * @brief Check if the bounce buffer size is accepted by the RGB driver and the DMA
+     *
+     * The size should divide half of the frame, and its bytes should be aligned to `DMA_ALIGN_BYTES`.
+     */
+    static constexpr bool isBounceBufferSizeValid(const Timing &timing, uint32_t size_px)
+    {
+        uint64_t half_total_pixels = static_cast<uint64_t>(timing.h_res) * timing.v_res / 2;
+        uint64_t bytes = static_cast<uint64_t>(size_px) * timing.bits_per_pixel / 8;
+
+        return (size_px > 0) && (half_total_pixels % size_px == 0) && (bytes % DMA_ALIGN_BYTES == 0);
+    }
+
+    /**
+     * @brief Plan the bounce buffer size for the target PCLK
+     *
+     * It picks the smallest valid size (at least one line) which makes the target PCLK stable. If no size within the
+     * SRAM budget does, it picks the largest one, which gives the highest stable PCLK, and `is_stable` is `false`.
+     *
+     * @param[in] timing Timing of the panel
+     * @param[in] budget Budget of the bounce buffers
+     * @return The plan, `is_valid` is `false` if the inputs are invalid or no size fits the budget
+     */
+    static constexpr Plan plan(const Timing &timing, const Budget &budget)
+    {
+        Plan result = {};
+        if ((timing.pclk_hz == 0) || (timing.h_res == 0) || (timing.v_res == 0) || (timing.bits_per_pixel == 0) ||
+                (budget.psram_bandwidth == 0) || (budget.margin_percent >= 100)) {
+            return result;
+        }
+
+        uint64_t max_size_px = static_cast<uint64_t>(budget.sram_budget_bytes) * 8 / 2 / timing.bits_per_pixel;
+        uint64_t half_total_pixels = static_cast<uint64_t>(timing.h_res) * timing.v_res / 2;
+        if (max_size_px > half_total_pixels) {
+            max_size_px = half_total_pixels;
+        }
+        for (uint64_t size_px = timing.h_res; size_px <= max_size_px; size_px++) {
+            if (!isBounceBufferSizeValid(timing, static_cast<uint32_t>(size_px))) {
+                continue;
+            }
+            result.is_valid = true;
+            result.bounce_buffer_size_px = static_cast<uint32_t>(size_px);
+            result.max_pclk_hz = getMaxStablePclkHz(timing, budget, result.bounce_buffer_size_px);
+            if (result.max_pclk_hz >= timing.pclk_hz) {
+                result.is_stable = true;
+                break;
+            }
+        }
+        if (result.is_valid) {
+            result.fill_time_ns = static_cast<uint32_t>(getFillTimeNs(timing, budget, result.bounce_buffer_size_px));
+            result.send_time_ns =
+                static_cast<uint32_t>(getSendTimeNs(timing, timing.pclk_hz, result.bounce_buffer_size_px));
+            result.refresh_rate_x100 = getRefreshRateX100(
+                                           timing, result.is_stable ? timing.pclk_hz : result.max_pclk_hz
+                                       );
+        }
+
+        return result;
+    }
+};
+
+} // namespace esp_panel::drivers
@@ -7,59 +7,189 @@
 #include "esp_panel_bus_conf_internal.h"
 #if ESP_PANEL_DRIVERS_BUS_ENABLE_SPI
 
+#include <algorithm>
+#include <atomic>
+#include <new>
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "esp_lcd_panel_io_interface.h"
 #include "utils/esp_panel_utils_log.h"
 #include "drivers/host/esp_panel_host_spi.hpp"
 #include "esp_panel_bus_spi.hpp"
 
 namespace esp_panel::drivers {
 
+namespace {
+
+constexpr int ARBITRATION_WAIT_MS_MAX = 20;
+constexpr int ARBITRATION_INFLIGHT_WAIT_MS_MAX = 1000;
+
+/**
+ * The panel IO which arbitrates the transactions of a bus on the shared host and forwards them to the original one.
+ *
+ * The color transfer done callback of the original panel IO is taken over, since it is called for every chunk. Bit
+ * `n % 32` of `last_chunk_mask` records whether the `n`th submitted chunk is the last one of a color transfer. The
+ * original panel IO queues up to its queue depth of chunks, so `inflight_sem` bounds the chunks in flight to
+ * `BusSPI::ARBITRATION_INFLIGHT_CHUNKS_MAX`, which keeps the bits from aliasing and the queued chunks ahead of an
+ * urgent transaction few.
+ */
+static_assert(
+    (BusSPI::ARBITRATION_INFLIGHT_CHUNKS_MAX > 0) && (BusSPI::ARBITRATION_INFLIGHT_CHUNKS_MAX < 32),
+    "The chunks in flight should be fewer than the bits of `last_chunk_mask`"
+);
+
+struct ArbitratedPanelIO {
+    esp_lcd_panel_io_t base;        // Must be the first member
+    esp_lcd_panel_io_handle_t io;
+    HostSPI *host;
+    BusSPI::Priority priority;
+    size_t chunk_bytes;
+    esp_lcd_panel_io_color_trans_done_cb_t on_color_trans_done;
+    void *user_ctx;
+    std::atomic<uint32_t> last_chunk_mask;
+    uint32_t submitted_count;
+    uint32_t finished_count;
+    SemaphoreHandle_t inflight_sem;
+    StaticSemaphore_t inflight_sem_buffer;
+};
+
+IRAM_ATTR bool arbitrated_on_color_trans_done(
+    esp_lcd_panel_io_handle_t io, esp_lcd_panel_io_event_data_t *edata, void *user_ctx
+)
+{
+    auto panel_io = static_cast<ArbitratedPanelIO *>(user_ctx);
+    uint32_t bit = 1UL << (panel_io->finished_count++ % 32);
+    BaseType_t need_yield = pdFALSE;
+
+    xSemaphoreGiveFromISR(panel_io->inflight_sem, &need_yield);
+    if (!(panel_io->last_chunk_mask.load() & bit) || (panel_io->on_color_trans_done == nullptr)) {
+        return (need_yield == pdTRUE);
+    }
+
+    return panel_io->on_color_trans_done(&panel_io->base, edata, panel_io->user_ctx) || (need_yield == pdTRUE);
+}
+
+esp_err_t arbitrated_rx_param(esp_lcd_panel_io_t *io, int lcd_cmd, void *param, size_t param_size)
+{
+    auto panel_io = __containerof(io, ArbitratedPanelIO, base);
+
+    if (panel_io->priority != BusSPI::Priority::URGENT) {
+        return esp_lcd_panel_io_rx_param(panel_io->io, lcd_cmd, param, param_size);
+    }
+
+    panel_io->host->beginUrgentTransaction();
+    esp_err_t ret = esp_lcd_panel_io_rx_param(panel_io->io, lcd_cmd, param, param_size);
+    panel_io->host->endUrgentTransaction();
+
+    return ret;
+}
+
+esp_err_t arbitrated_tx_param(esp_lcd_panel_io_t *io, int lcd_cmd, const void *param, size_t param_size)
+{
+    auto panel_io = __containerof(io, ArbitratedPanelIO, base);
+
+    if (panel_io->priority != BusSPI::Priority::URGENT) {
+        return esp_lcd_panel_io_tx_param(panel_io->io, lcd_cmd, param, param_size);
+    }
+
+    panel_io->host->beginUrgentTransaction();
+    esp_err_t ret = esp_lcd_panel_io_tx_param(panel_io->io, lcd_cmd, param, param_size);
+    panel_io->host->endUrgentTransaction();
+
+    return ret;
+}
+
+esp_err_t arbitrated_tx_color_chunk(
+    ArbitratedPanelIO *panel_io, int lcd_cmd, const void *color, size_t color_size, bool is_last
+)
+{
+    // Given back by the done callback of the chunk
+    if (xSemaphoreTake(panel_io->inflight_sem, pdMS_TO_TICKS(ARBITRATION_INFLIGHT_WAIT_MS_MAX)) != pdTRUE) {
+        return ESP_ERR_TIMEOUT;
+    }
+
+    uint32_t bit = 1UL << (panel_io->submitted_count++ % 32);
+    if (is_last) {
+        panel_io->last_chunk_mask.fetch_or(bit);
+    } else {
+        panel_io->last_chunk_mask.fetch_and(~bit);
+    }
+
+    esp_err_t ret = esp_lcd_panel_io_tx_color(panel_io->io, lcd_cmd, color, color_size);
+    if (ret != ESP_OK) {
+        // The chunk is not queued, so there is no callback for it
+        panel_io->submitted_count--;
+        xSemaphoreGive(panel_io->inflight_sem);
+    }
+
+    return ret;
+}
+
+esp_err_t arbitrated_tx_color(esp_lcd_panel_io_t *io, int lcd_cmd, const void *color, size_t color_size)
+{
+    auto panel_io = __containerof(io, ArbitratedPanelIO, base);
+
+    if (panel_io->priority == BusSPI::Priority::URGENT) {
+        panel_io->host->beginUrgentTransaction();
+        esp_err_t ret = arbitrated_tx_color_chunk(panel_io, lcd_cmd, color, color_size, true);
+        panel_io->host->endUrgentTransaction();
+
+        return ret;
+    }
+
+    // Only the first chunk sends the command, the rest are appended to the data of it
+    auto data = static_cast<const uint8_t *>(color);
+    esp_err_t ret = ESP_OK;
+    do {
+        size_t chunk_size = std::min(color_size, panel_io->chunk_bytes);
+        color_size -= chunk_size;
+        // Yield to the urgent transactions at the chunk boundary, but don't stall the color transfer forever
+        panel_io->host->waitUrgentTransactions(ARBITRATION_WAIT_MS_MAX);
+        ret = arbitrated_tx_color_chunk(panel_io, lcd_cmd, data, chunk_size, color_size == 0);
+        data += chunk_size;
+        lcd_cmd = -1;
+    } while ((ret == ESP_OK) && (color_size > 0));
+
+    return ret;
+}
+
+esp_err_t arbitrated_register_event_callbacks(
+    esp_lcd_panel_io_t *io, const esp_lcd_panel_io_callbacks_t *cbs, void *user_ctx
+)
+{
+    auto panel_io = __containerof(io, ArbitratedPanelIO, base);
+    panel_io->on_color_trans_done = cbs->on_color_trans_done;
+    panel_io->user_ctx = user_ctx;
+
+    return ESP_OK;
+}
+
+esp_err_t arbitrated_del(esp_lcd_panel_io_t *io)
+{
+    auto panel_io = __containerof(io, ArbitratedPanelIO, base);
+    esp_err_t ret = esp_lcd_panel_io_del(panel_io->io);
+    vSemaphoreDelete(panel_io->inflight_sem);
+    delete panel_io;
+
+    return ret;
+}
+
+} // namespace
+
 void BusSPI::Config::convertPartialToFull()
 {
     if (isHostConfigValid() && std::holds_alternative<HostPartialConfig>(host.value())) {
 #if ESP_UTILS_CONF_LOG_LEVEL == ESP_UTILS_LOG_LEVEL_DEBUG
         printHostConfig();
 #endif // ESP_UTILS_LOG_LEVEL_DEBUG
-        auto &config = std::get<HostPartialConfig>(host.value());
-        host = HostFullConfig{
-            .mosi_io_num = config.mosi_io_num,
-            .miso_io_num = config.miso_io_num,
-            .sclk_io_num = config.sclk_io_num,
-            .quadwp_io_num = -1,
-            .quadhd_io_num = -1,
-            .data4_io_num = -1,
-            .data5_io_num = -1,
-            .data6_io_num = -1,
-            .data7_io_num = -1,
-            .max_transfer_sz = ESP_PANEL_HOST_SPI_MAX_TRANSFER_SIZE,
-            .flags = SPICOMMON_BUSFLAG_MASTER,
-            .intr_flags = 0,
-        };
+        host = std::get<HostPartialConfig>(host.value()).toFull();
     }
 
     if (std::holds_alternative<ControlPanelPartialConfig>(control_panel)) {
 #if ESP_UTILS_CONF_LOG_LEVEL == ESP_UTILS_LOG_LEVEL_DEBUG
         printControlPanelConfig();
 #endif // ESP_UTILS_LOG_LEVEL_DEBUG
-        auto &config = std::get<ControlPanelPartialConfig>(control_panel);
-        control_panel = ControlPanelFullConfig{
-            .cs_gpio_num = config.cs_gpio_num,
-            .dc_gpio_num = config.dc_gpio_num,
-            .spi_mode = config.spi_mode,
-            .pclk_hz = static_cast<unsigned int>(config.pclk_hz),
-            .trans_queue_depth = 10,
-            .on_color_trans_done = nullptr,
-            .user_ctx = nullptr,
-            .lcd_cmd_bits = config.lcd_cmd_bits,
-            .lcd_param_bits = config.lcd_param_bits,
-            .flags = {
-                .dc_low_on_data = 0,
-                .octal_mode = 0,
-                .quad_mode = 0,
-                .sio_mode = 0,
-                .lsb_first = 0,
-                .cs_high_active = 0,
-            },
-        };
+        control_panel = std::get<ControlPanelPartialConfig>(control_panel).toFull();
     }
 }
 
@@ -271,6 +401,36 @@ bool BusSPI::configSPI_TransQueueDepth(uint8_t depth)
     return true;
 }
 
+bool BusSPI::configSPI_AutoTune(bool en)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isOverState(State::INIT), false, "Should be called before `init()`");
+
+    ESP_UTILS_LOGD("Param: en(%d)", en);
+    _config.auto_tune = en;
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool BusSPI::configSPI_Priority(Priority priority, int chunk_bytes)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isOverState(State::INIT), false, "Should be called before `init()`");
+    ESP_UTILS_CHECK_FALSE_RETURN(chunk_bytes > 0, false, "Invalid chunk size");
+
+    ESP_UTILS_LOGD("Param: priority(%d), chunk_bytes(%d)", static_cast<int>(priority), chunk_bytes);
+    _config.priority = priority;
+    _config.arbitration_chunk_bytes = chunk_bytes;
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
 bool BusSPI::init()
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
@@ -284,6 +444,11 @@ bool BusSPI::init()
     _config.printControlPanelConfig();
 #endif // ESP_UTILS_LOG_LEVEL_DEBUG
 
+    // The chunk size should be chosen before creating the host, since it can't be changed after that
+    if (_config.auto_tune) {
+        tuneChunkSize();
+    }
+
     // Get the host instance if not skipped
     if (!isHostSkipInit()) {
         auto host_id = getConfig().host_id;
@@ -318,17 +483,11 @@ bool BusSPI::begin()
     }
 
     // Create the control panel
-    ESP_UTILS_CHECK_ERROR_RETURN(
-#if ESP_IDF_VERSION < ESP_IDF_VERSION_VAL(5, 3, 0)
-        esp_lcd_new_panel_io_spi(
-            reinterpret_cast<esp_lcd_spi_bus_handle_t>(host_id), &getControlPanelFullConfig(), &control_panel
-#else
-        esp_lcd_new_panel_io_spi(
-            static_cast<esp_lcd_spi_bus_handle_t>(host_id), &getControlPanelFullConfig(), &control_panel
-#endif
-        ), false, "create panel IO failed"
-    );
-    ESP_UTILS_LOGD("Create control panel @%p", control_panel);
+    ESP_UTILS_CHECK_FALSE_RETURN(createControlPanel(), false, "Create control panel failed");
+
+    if (_config.auto_tune) {
+        ESP_UTILS_CHECK_FALSE_RETURN(tuneQueueDepth(), false, "Tune queue depth failed");
+    }
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 
@@ -362,6 +521,180 @@ bool BusSPI::del()
     return true;
 }
 
+void BusSPI::tuneChunkSize()
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    int dma_free = heap_caps_get_free_size(MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    int chunk_bytes = ESP_PANEL_HOST_SPI_MAX_TRANSFER_SIZE;
+    _auto_tune_report.dma_free_bytes = dma_free;
+
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
+    // Only the newer `esp_lcd` splits the color data by the maximum transfer size of the host, otherwise keep the
+    // hardware limit to avoid the transaction being rejected
+    if (!isHostSkipInit()) {
+        // The color data out of the DMA-capable memory (e.g. PSRAM) is copied to a temporary DMA buffer for each queued
+        // chunk, so leave room for the minimum queue depth and the other drivers
+        int dma_largest = heap_caps_get_largest_free_block(MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+        chunk_bytes = std::min(chunk_bytes, std::min(dma_largest, dma_free / (AUTO_TUNE_QUEUE_DEPTH_MIN * 2)));
+        chunk_bytes = std::max(chunk_bytes, AUTO_TUNE_CHUNK_BYTES_MIN) & ~63;
+        getHostFullConfig().max_transfer_sz = chunk_bytes;
+    }
+#endif
+    _auto_tune_report.chunk_bytes = chunk_bytes;
+
+    ESP_UTILS_LOGD("Tune chunk size: %d bytes (DMA free: %d bytes)", chunk_bytes, dma_free);
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+}
+
+bool BusSPI::tuneQueueDepth()
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    constexpr int MEASURE_COUNT = 8;
+
+    // The host may be created by another bus, so use its actual chunk size
+    if (_host != nullptr) {
+        _auto_tune_report.chunk_bytes = _host->getConfig().max_transfer_sz;
+    }
+
+    // Measure the software latency of a transaction by sending NOP commands, which are ignored by the LCDs
+    int64_t start_us = esp_timer_get_time();
+    for (int i = 0; i < MEASURE_COUNT; i++) {
+        ESP_UTILS_CHECK_ERROR_RETURN(
+            esp_lcd_panel_io_tx_param(control_panel, 0x00, nullptr, 0), false, "Send NOP command failed"
+        );
+    }
+    int latency_us = static_cast<int>((esp_timer_get_time() - start_us) / MEASURE_COUNT);
+
+    auto &control_panel_config = getControlPanelFullConfig();
+    int chunk_bytes = _auto_tune_report.chunk_bytes;
+    int chunk_time_us = static_cast<int>(
+                            static_cast<int64_t>(chunk_bytes) * 8 * 1000000 / control_panel_config.pclk_hz
+                        );
+
+    // Keep enough chunks queued to cover the latency of submitting the next one, so the bus never idles between
+    // chunks, but don't queue more than the DMA-capable memory can hold
+    int queue_depth = AUTO_TUNE_QUEUE_DEPTH_MIN + (latency_us + chunk_time_us - 1) / std::max(chunk_time_us, 1);
+    int dma_depth = heap_caps_get_free_size(MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL) / (2 * std::max(chunk_bytes, 1));
+    queue_depth = std::min(queue_depth, std::max(dma_depth, AUTO_TUNE_QUEUE_DEPTH_MIN));
+    queue_depth = std::clamp(queue_depth, AUTO_TUNE_QUEUE_DEPTH_MIN, AUTO_TUNE_QUEUE_DEPTH_MAX);
+
+    // The queue depth can only be changed by recreating the control panel
+    if (queue_depth != static_cast<int>(control_panel_config.trans_queue_depth)) {
+        ESP_UTILS_CHECK_FALSE_RETURN(delControlPanel(), false, "Delete control panel failed");
+        control_panel_config.trans_queue_depth = queue_depth;
+        ESP_UTILS_CHECK_FALSE_RETURN(createControlPanel(), false, "Create control panel failed");
+    }
+
+    _auto_tune_report.queue_depth = queue_depth;
+    _auto_tune_report.trans_latency_us = latency_us;
+    _auto_tune_report.chunk_time_us = chunk_time_us;
+    ESP_UTILS_LOGI(
+        "SPI host(%d) auto-tuned: chunk(%d bytes), queue depth(%d), latency(%d us), chunk time(%d us), "
+        "DMA free(%d bytes)", getConfig().host_id, chunk_bytes, queue_depth, latency_us, chunk_time_us,
+        _auto_tune_report.dma_free_bytes
+    );
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool BusSPI::createControlPanel()
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    auto host_id = getConfig().host_id;
+    ESP_UTILS_CHECK_ERROR_RETURN(
+#if ESP_IDF_VERSION < ESP_IDF_VERSION_VAL(5, 3, 0)
+        esp_lcd_new_panel_io_spi(
+            reinterpret_cast<esp_lcd_spi_bus_handle_t>(host_id), &getControlPanelFullConfig(), &control_panel
+#else
+        esp_lcd_new_panel_io_spi(
+            static_cast<esp_lcd_spi_bus_handle_t>(host_id), &getControlPanelFullConfig(), &control_panel
+#endif
+        ), false, "create panel IO failed"
+    );
+    ESP_UTILS_LOGD("Create control panel @%p", control_panel);
+
+    if (_config.priority != Priority::NONE) {
+        ESP_UTILS_CHECK_FALSE_RETURN(wrapControlPanel(), false, "Wrap control panel failed");
+    }
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool BusSPI::wrapControlPanel()
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    // The bus which skips the host initialization still shares the host created by another bus
+    auto host_id = getConfig().host_id;
+    if (_host == nullptr) {
+        _host = HostSPI::getInstance(host_id);
+    }
+    ESP_UTILS_CHECK_NULL_RETURN(
+        _host, false, "SPI host(%d) is not initialized by any bus, arbitration is not available", host_id
+    );
+
+    auto panel_io = new (std::nothrow) ArbitratedPanelIO{};
+    ESP_UTILS_CHECK_NULL_RETURN(panel_io, false, "Allocate arbitrated panel IO failed");
+
+    auto &control_panel_config = getControlPanelFullConfig();
+    panel_io->io = control_panel;
+    panel_io->host = _host.get();
+    panel_io->priority = _config.priority;
+    panel_io->chunk_bytes = (_config.priority == Priority::BULK) ? _config.arbitration_chunk_bytes : SIZE_MAX;
+    panel_io->on_color_trans_done = control_panel_config.on_color_trans_done;
+    panel_io->user_ctx = control_panel_config.user_ctx;
+    panel_io->inflight_sem = xSemaphoreCreateCountingStatic(
+                                 ARBITRATION_INFLIGHT_CHUNKS_MAX, ARBITRATION_INFLIGHT_CHUNKS_MAX,
+                                 &panel_io->inflight_sem_buffer
+                             );
+    panel_io->base.rx_param = arbitrated_rx_param;
+    panel_io->base.tx_param = arbitrated_tx_param;
+    panel_io->base.tx_color = arbitrated_tx_color;
+    panel_io->base.del = arbitrated_del;
+    panel_io->base.register_event_callbacks = arbitrated_register_event_callbacks;
+
+    // Take over the callback of the original panel IO, since it is called for every chunk
+    esp_lcd_panel_io_callbacks_t io_cb = {
+        .on_color_trans_done = arbitrated_on_color_trans_done,
+    };
+    esp_err_t ret = esp_lcd_panel_io_register_event_callbacks(control_panel, &io_cb, panel_io);
+    if (ret != ESP_OK) {
+        vSemaphoreDelete(panel_io->inflight_sem);
+        delete panel_io;
+        ESP_UTILS_CHECK_ERROR_RETURN(ret, false, "Register panel IO callbacks failed");
+    }
+    control_panel = &panel_io->base;
+    ESP_UTILS_LOGD(
+        "Wrap control panel @%p with priority(%d), chunk(%d bytes)", control_panel, static_cast<int>(_config.priority),
+        (_config.priority == Priority::BULK) ? _config.arbitration_chunk_bytes : 0
+    );
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool BusSPI::writeRegisterRun(const RegisterCommand *commands, size_t num) const
+{
+    if ((_config.priority != Priority::URGENT) || (_host == nullptr)) {
+        return Bus::writeRegisterRun(commands, num);
+    }
+
+    _host->beginUrgentTransaction();
+    bool ret = Bus::writeRegisterRun(commands, num);
+    _host->endUrgentTransaction();
+
+    return ret;
+}
+
 BusSPI::HostFullConfig &BusSPI::getHostFullConfig()
 {
     if (std::holds_alternative<HostPartialConfig>(_config.host.value())) {
@@ -34,21 +34,81 @@ public:
     };
     static constexpr int SPI_HOST_ID_DEFAULT = static_cast<int>(SPI2_HOST);
     static constexpr int SPI_PCLK_HZ_DEFAULT = SPI_MASTER_FREQ_40M;
+    static constexpr int AUTO_TUNE_CHUNK_BYTES_MIN = 4 * 1024;
+    static constexpr int AUTO_TUNE_QUEUE_DEPTH_MIN = 2;
+    static constexpr int AUTO_TUNE_QUEUE_DEPTH_MAX = 32;
+    static constexpr int ARBITRATION_CHUNK_BYTES_DEFAULT = 8 * 1024;
+    static constexpr int ARBITRATION_INFLIGHT_CHUNKS_MAX = 4;
+
+    using HostFullConfig = spi_bus_config_t;
+    using ControlPanelFullConfig = esp_lcd_panel_io_spi_config_t;
 
     /**
      * @brief Partial host configuration structure
      */
     struct HostPartialConfig {
+        /**
+         * @brief Convert to the full configuration
+         *
+         * @return Full host configuration
+         * @note This function can be evaluated at compile time
+         */
+        constexpr HostFullConfig toFull() const
+        {
+            return HostFullConfig{
+                .mosi_io_num = mosi_io_num,
+                .miso_io_num = miso_io_num,
+                .sclk_io_num = sclk_io_num,
+                .quadwp_io_num = -1,
+                .quadhd_io_num = -1,
+                .data4_io_num = -1,
+                .data5_io_num = -1,
+                .data6_io_num = -1,
+                .data7_io_num = -1,
+                .max_transfer_sz = ESP_PANEL_HOST_SPI_MAX_TRANSFER_SIZE,
+                .flags = SPICOMMON_BUSFLAG_MASTER,
+                .intr_flags = 0,
+            };
+        }
+
         int mosi_io_num = -1;    ///< GPIO number for MOSI signal
         int miso_io_num = -1;    ///< GPIO number for MISO signal
         int sclk_io_num = -1;    ///< GPIO number for SCLK signal
     };
-    using HostFullConfig = spi_bus_config_t;
 
     /**
      * @brief Partial control panel configuration structure
      */
     struct ControlPanelPartialConfig {
+        /**
+         * @brief Convert to the full configuration
+         *
+         * @return Full control panel configuration
+         * @note This function can be evaluated at compile time
+         */
+        constexpr ControlPanelFullConfig toFull() const
+        {
+            return ControlPanelFullConfig{
+                .cs_gpio_num = cs_gpio_num,
+                .dc_gpio_num = dc_gpio_num,
+                .spi_mode = spi_mode,
+                .pclk_hz = static_cast<unsigned int>(pclk_hz),
+                .trans_queue_depth = 10,
+                .on_color_trans_done = nullptr,
+                .user_ctx = nullptr,
+                .lcd_cmd_bits = lcd_cmd_bits,
+                .lcd_param_bits = lcd_param_bits,
+                .flags = {
+                    .dc_low_on_data = 0,
+                    .octal_mode = 0,
+                    .quad_mode = 0,
+                    .sio_mode = 0,
+                    .lsb_first = 0,
+                    .cs_high_active = 0,
+                },
+            };
+        }
+
         int cs_gpio_num = -1;        ///< GPIO number for CS signal
         int dc_gpio_num = -1;        ///< GPIO number for DC signal
         int spi_mode = 0;            ///< SPI mode (0-3)
@@ -56,11 +116,30 @@ public:
         int lcd_cmd_bits = 8;        ///< Bits for LCD commands
         int lcd_param_bits = 8;      ///< Bits for LCD parameters
     };
-    using ControlPanelFullConfig = esp_lcd_panel_io_spi_config_t;
 
     using HostConfig = std::variant<HostPartialConfig, HostFullConfig>;
     using ControlPanelConfig = std::variant<ControlPanelPartialConfig, ControlPanelFullConfig>;
 
+    /**
+     * @brief Priority of the transactions on a shared host, see `configSPI_Priority()`
+     */
+    enum class Priority : uint8_t {
+        NONE = 0,   ///< No arbitration, the transactions are submitted to the host directly
+        BULK,       ///< Large transfers (e.g. LCD color data), split into chunks and yield to urgent transactions
+        URGENT,     ///< Small latency-sensitive transactions (e.g. touch reads), served at the next chunk boundary
+    };
+
+    /**
+     * @brief Parameters chosen by the auto-tuning, see `configSPI_AutoTune()`
+     */
+    struct AutoTuneReport {
+        int chunk_bytes = 0;        ///< Maximum bytes of a single transaction, color data is split by it
+        int queue_depth = 0;        ///< Transaction queue depth of the control panel
+        int dma_free_bytes = 0;     ///< Free DMA-capable memory before creating the host
+        int trans_latency_us = 0;   ///< Measured latency of a single small transaction
+        int chunk_time_us = 0;      ///< Time to transfer a full chunk at the configured clock frequency
+    };
+
     /**
      * @brief The SPI bus configuration structure
      */
@@ -93,6 +172,9 @@ public:
         int host_id = SPI_HOST_ID_DEFAULT;  ///< SPI host ID
         std::optional<HostConfig> host;     ///< Host configuration. If not set, the host will not be initialized
         ControlPanelConfig control_panel = ControlPanelPartialConfig{}; ///< Control panel configuration
+        bool auto_tune = false;             ///< Tune the chunk size and queue depth, see `configSPI_AutoTune()`
+        Priority priority = Priority::NONE; ///< Priority on a shared host, see `configSPI_Priority()`
+        int arbitration_chunk_bytes = ARBITRATION_CHUNK_BYTES_DEFAULT; ///< Chunk size of the `BULK` transfers
     };
 
 // *INDENT-OFF*
@@ -256,6 +338,41 @@ public:
      */
     bool configSPI_TransQueueDepth(uint8_t depth);
 
+    /**
+     * @brief Configure whether to tune the transfer chunk size and transaction queue depth automatically
+     *
+     * When enabled, the chunk size (the maximum transfer size of the host) is chosen from the free DMA-capable memory
+     * in `init()`, and the queue depth is chosen from the measured transaction latency in `begin()`. The chosen
+     * parameters can be got by `getAutoTuneReport()`.
+     *
+     * @param[in] en Whether to enable
+     * @return `true` if configuration succeeds, `false` otherwise
+     * @note This function should be called before `init()`
+     * @note The latency is measured by sending NOP (0x00) commands, so this function should only be used for LCDs
+     * @note The chunk size only takes effect when the host is created by this bus
+     */
+    bool configSPI_AutoTune(bool en = true);
+
+    /**
+     * @brief Configure the priority of the transactions when the host is shared with other devices
+     *
+     * The color data of a `BULK` bus is split into chunks, and before submitting each chunk it waits for the
+     * transactions of the `URGENT` buses on the same host to finish. At most `ARBITRATION_INFLIGHT_CHUNKS_MAX` chunks
+     * (and no more than the transaction queue depth) are in flight, so an urgent transaction waits for at most that
+     * number of chunks already queued, regardless of the size of the color data. The latency is bounded by about
+     * `min(queue_depth, ARBITRATION_INFLIGHT_CHUNKS_MAX) * chunk_bytes * 8 / pclk_hz` seconds.
+     *
+     * @param[in] priority    Priority of the bus
+     * @param[in] chunk_bytes Chunk size of the color data, only valid for the `BULK` priority. A smaller one shortens
+     *                        the latency of the urgent transactions, but increases the overhead of the color transfers
+     * @return `true` if configuration succeeds, `false` otherwise
+     * @note This function should be called before `init()`
+     * @note The arbitration requires the host to be initialized by one of the buses, not by the user
+     * @note For the `BULK` priority, `esp_lcd_panel_io_tx_color()` blocks until the last chunk is submitted, and the
+     *       color transfer done callback is only called for the last chunk
+     */
+    bool configSPI_Priority(Priority priority, int chunk_bytes = ARBITRATION_CHUNK_BYTES_DEFAULT);
+
     /**
      * @brief Initialize the SPI bus
      *
@@ -287,6 +404,16 @@ public:
         return _config;
     }
 
+    /**
+     * @brief Get the parameters chosen by the auto-tuning
+     *
+     * @return Reference to the report, all fields are `0` if the auto-tuning is disabled or not finished
+     */
+    const AutoTuneReport &getAutoTuneReport() const
+    {
+        return _auto_tune_report;
+    }
+
     /**
      * @brief Alias for backward compatibility
      * @deprecated Use `configSPI_Mode()` instead
@@ -337,6 +464,20 @@ public:
         configSPI_TransQueueDepth(depth);
     }
 
+protected:
+    /**
+     * @brief Write a run of register commands without delay, called by `writeRegisterBatch()`
+     *
+     * On an `URGENT` bus of a shared host, the whole run is one urgent transaction, so the `BULK` buses don't put
+     * their color chunks between the commands.
+     *
+     * @param[in] commands Array of register commands
+     * @param[in] num      Number of commands in the array
+     *
+     * @return `true` if all commands are written, `false` otherwise
+     */
+    bool writeRegisterRun(const RegisterCommand *commands, size_t num) const override;
+
 private:
     /**
      * @brief Check if host is skipped initialization
@@ -366,8 +507,35 @@ private:
      */
     ControlPanelFullConfig &getControlPanelFullConfig();
 
+    /**
+     * @brief Choose the chunk size from the free DMA-capable memory
+     */
+    void tuneChunkSize();
+
+    /**
+     * @brief Choose the queue depth from the measured transaction latency, and recreate the control panel if changed
+     *
+     * @return `true` if successful, `false` otherwise
+     */
+    bool tuneQueueDepth();
+
+    /**
+     * @brief Create the control panel with the current configuration
+     *
+     * @return `true` if successful, `false` otherwise
+     */
+    bool createControlPanel();
+
+    /**
+     * @brief Wrap the control panel to arbitrate its transactions on the shared host
+     *
+     * @return `true` if successful, `false` otherwise
+     */
+    bool wrapControlPanel();
+
     Config _config = {};                      ///< SPI bus configuration
     std::shared_ptr<HostSPI> _host = nullptr; ///< SPI host instance
+    AutoTuneReport _auto_tune_report = {};    ///< Parameters chosen by the auto-tuning
 };
 
 } // namespace esp_panel::drivers
@@ -0,0 +1,123 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Encoder of the software 3-wire SPI, which converts a package (DC bit + 1 ~ 4 bytes) into the sequence of line states.
+ *
+ * Each state holds the levels of all the lines, so it can be applied by one write of the IO expander output port (or
+ * one write of the dedicated GPIO bundle). The states are the minimum needed to generate the waveform: the data bit is
+ * set together with the inactive SCL edge, and the consecutive duplicate states are dropped.
+ *
+ * It has no dependency on ESP-IDF, so it can also be used by the host tools.
+ */
+
+#define PANEL_IO_3WIRE_LINE_CS          (1 << 0)    // Bit of the CS line in a state
+#define PANEL_IO_3WIRE_LINE_SCL         (1 << 1)    // Bit of the SCL line in a state
+#define PANEL_IO_3WIRE_LINE_SDA         (1 << 2)    // Bit of the SDA line in a state
+
+#define PANEL_IO_3WIRE_DC_BIT_0         (0)         // DC bit = 0
+#define PANEL_IO_3WIRE_DC_BIT_1         (1)         // DC bit = 1
+#define PANEL_IO_3WIRE_NO_DC_BIT        (2)         // No DC bit
+
+#define PANEL_IO_3WIRE_PACKAGE_BYTES_MAX    (4)
+#define PANEL_IO_3WIRE_PACKAGE_STATES_MAX   ((1 + PANEL_IO_3WIRE_PACKAGE_BYTES_MAX * 8) * 2 + 2)
+
+/**
+ * @brief Encoder configuration structure
+ */
+typedef struct {
+    uint8_t cs_high_active: 1;          /*!< CS line is high active */
+    uint8_t sda_scl_idle_high: 1;       /*!< SDA and SCL lines are high when idle */
+    uint8_t scl_active_rising_edge: 1;  /*!< Data is sampled on the rising edge of SCL */
+    uint8_t lsb_first: 1;               /*!< Transmit LSB bit first */
+} panel_io_3wire_encoder_config_t;
+
+/**
+ * @brief Get the idle state of the lines
+ *
+ * @param[in] config Encoder configuration
+ * @return Idle state
+ */
+static inline uint8_t panel_io_3wire_get_idle_state(const panel_io_3wire_encoder_config_t *config)
+{
+    uint8_t state = config->cs_high_active ? 0 : PANEL_IO_3WIRE_LINE_CS;
+    if (config->sda_scl_idle_high) {
+        state |= PANEL_IO_3WIRE_LINE_SCL | PANEL_IO_3WIRE_LINE_SDA;
+    }
+
+    return state;
+}
+
+/**
+ * @brief Encode a package into the sequence of line states
+ *
+ * The bytes of the data are sent from the most significant one, and the DC bit (if any) is sent before the first byte.
+ * The sequence starts after the idle state and ends with the idle state.
+ *
+ * @param[in]  config     Encoder configuration
+ * @param[in]  dc_bit     DC bit, `PANEL_IO_3WIRE_DC_BIT_0`, `PANEL_IO_3WIRE_DC_BIT_1` or `PANEL_IO_3WIRE_NO_DC_BIT`
+ * @param[in]  data       Data to send
+ * @param[in]  data_bytes Bytes of the data (1 ~ 4)
+ * @param[out] states     Buffer of the states, should be able to hold `PANEL_IO_3WIRE_PACKAGE_STATES_MAX` states
+ * @return Number of the states
+ */
+static inline size_t panel_io_3wire_encode_package(
+    const panel_io_3wire_encoder_config_t *config, int dc_bit, uint32_t data, uint32_t data_bytes, uint8_t *states
+)
+{
+    uint8_t idle_state = panel_io_3wire_get_idle_state(config);
+    uint8_t cs_active = config->cs_high_active ? PANEL_IO_3WIRE_LINE_CS : 0;
+    uint8_t scl_before = config->scl_active_rising_edge ? 0 : PANEL_IO_3WIRE_LINE_SCL;
+    uint8_t scl_after = scl_before ^ PANEL_IO_3WIRE_LINE_SCL;
+    uint8_t last_state = idle_state;
+    size_t num = 0;
+
+#define PANEL_IO_3WIRE_PUSH_STATE(state)    \
+    do {                                    \
+        uint8_t _state = (state);           \
+        if (_state != last_state) {         \
+            states[num++] = _state;         \
+            last_state = _state;            \
+        }                                   \
+    } while (0)
+
+    int bit_count = (dc_bit != PANEL_IO_3WIRE_NO_DC_BIT) ? 1 : 0;
+    for (int i = -bit_count; i < (int)(data_bytes * 8); i++) {
+        bool level = false;
+        if (i < 0) {
+            level = (dc_bit == PANEL_IO_3WIRE_DC_BIT_1);
+        } else {
+            int byte_index = data_bytes - 1 - i / 8;
+            int bit_index = config->lsb_first ? (i % 8) : (7 - i % 8);
+            level = (data >> (byte_index * 8 + bit_index)) & 0x1;
+        }
+        uint8_t sda = level ? PANEL_IO_3WIRE_LINE_SDA : 0;
+        // Set the data bit with the inactive edge, then latch it with the active edge
+        PANEL_IO_3WIRE_PUSH_STATE(cs_active | scl_before | sda);
+        PANEL_IO_3WIRE_PUSH_STATE(cs_active | scl_after | sda);
+    }
+    // Restore SCL and SDA before releasing CS, so no extra edge is seen by the panel
+    PANEL_IO_3WIRE_PUSH_STATE(cs_active | (idle_state & ~PANEL_IO_3WIRE_LINE_CS));
+    PANEL_IO_3WIRE_PUSH_STATE(idle_state);
+
+#undef PANEL_IO_3WIRE_PUSH_STATE
+
+    return num;
+}
+
+#ifdef __cplusplus
+}
+#endif
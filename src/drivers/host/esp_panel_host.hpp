@@ -7,6 +7,8 @@
 
 #include <array>
 #include <memory>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
 #include "utils/esp_panel_utils_log.h"
 #include "utils/esp_panel_utils_cxx.hpp"
 
@@ -15,6 +17,10 @@ namespace esp_panel::drivers {
 /**
  * @brief The base bus host template class implementing a variant of the Singleton pattern
  *
+ * The instances are kept in a registry keyed by the host ID. Each slot of the registry is guarded by a mutex, so the
+ * instances can be got, started and released from multiple tasks (e.g. when initializing devices in parallel), and the
+ * configuration of an existing instance is calibrated by one task at a time.
+ *
  * @tparam Derived Derived class type
  * @tparam Config Configuration type
  * @tparam N Maximum number of instances allowed
@@ -55,8 +61,15 @@ public:
      * @brief Startup the host
      *
      * @return `true` if successful, `false` otherwise
+     * @note The slot of the host is held during the startup, so the host is started only once even if multiple
+     *       devices sharing it call this function at the same time
      */
-    virtual bool begin() = 0;
+    bool begin()
+    {
+        SlotLock lock(id_);
+
+        return beginImpl();
+    }
 
     /**
      * @brief Get the ID of the host
@@ -78,6 +91,16 @@ public:
         return handle_;
     }
 
+    /**
+     * @brief Get the configuration of the host
+     *
+     * @return Host configuration, which may be calibrated by the later instances
+     */
+    const Config &getConfig() const
+    {
+        return config_;
+    }
+
     /**
      * @brief Check if driver has reached specified state
      *
@@ -149,11 +172,75 @@ protected:
     NativeHandle handle_ = nullptr;     /*!< Host native handle */
 
 private:
+    /**
+     * @brief Mutexes of the registry slots
+     */
+    struct SlotMutexes {
+        SlotMutexes()
+        {
+            for (int i = 0; i < N; i++) {
+                // The static mutex never fails to be created
+                handles[i] = xSemaphoreCreateMutexStatic(&buffers[i]);
+            }
+        }
+
+        std::array<StaticSemaphore_t, N> buffers;   /*!< Buffers of the mutexes */
+        std::array<SemaphoreHandle_t, N> handles;   /*!< Handles of the mutexes */
+    };
+
+    /**
+     * @brief Scoped lock of a registry slot, which blocks until the mutex of the slot is taken
+     */
+    class SlotLock {
+    public:
+        explicit SlotLock(int id): mutex_(getSlotMutex(id))
+        {
+            xSemaphoreTake(mutex_, portMAX_DELAY);
+        }
+
+        ~SlotLock()
+        {
+            xSemaphoreGive(mutex_);
+        }
+
+        SlotLock(const SlotLock &) = delete;
+        SlotLock &operator=(const SlotLock &) = delete;
+
+    private:
+        SemaphoreHandle_t mutex_;
+    };
+
+    /**
+     * @brief Get the mutex of a registry slot
+     *
+     * @param[in] id Host ID
+     * @return Mutex handle
+     * @note The mutexes are created on the first use, and the initialization of the local static variable is
+     *       thread-safe
+     */
+    static SemaphoreHandle_t getSlotMutex(int id)
+    {
+        static SlotMutexes mutexes;
+
+        return mutexes.handles[id];
+    }
+
+    /**
+     * @brief Startup the host, called by `begin()` with the slot of the host held
+     *
+     * @return `true` if successful, `false` otherwise
+     */
+    virtual bool beginImpl() = 0;
+
     /**
      * @brief Calibrate configuration when host already exists
      *
+     * Compatible configurations should be merged into the existing one, and the existing one should be left unchanged
+     * if they are incompatible
+     *
      * @param[in] config New configuration
      * @return `true` if successful, `false` otherwise
+     * @note This function is called with the slot of the host held, so it won't run concurrently
      */
     virtual bool calibrateConfig(const Config &config) = 0;
 
@@ -171,6 +258,7 @@ bool Host<Derived, Config, N>::tryReleaseInstance(int id)
     ESP_UTILS_LOGD("Param: id(%d)", id);
     ESP_UTILS_CHECK_FALSE_RETURN((size_t)id < instances_.size(), false, "Invalid ID"); 
 
+    SlotLock lock(id);
     if ((instances_[id] != nullptr) && (instances_[id].use_count() == 1)) {
         instances_[id] = nullptr;
         ESP_UTILS_LOGD("Release host(%d)", id);
@@ -189,6 +277,7 @@ std::shared_ptr<Derived> Host<Derived, Config, N>::getInstance(int id, const Con
     ESP_UTILS_LOGD("Param: id(%d), config(@%p)", id, &config);
     ESP_UTILS_CHECK_FALSE_RETURN((size_t)id < instances_.size(), nullptr, "Invalid host ID");
 
+    SlotLock lock(id);
     if (instances_[id] == nullptr) {
         ESP_UTILS_CHECK_EXCEPTION_RETURN(
             (instances_[id] = utils::make_shared<Derived>(id, config)), nullptr, "Create instance failed"
@@ -217,9 +306,12 @@ std::shared_ptr<Derived> Host<Derived, Config, N>::getInstance(int id)
     ESP_UTILS_LOGD("Param: id(%d)", id);
     ESP_UTILS_CHECK_FALSE_RETURN((size_t)id < instances_.size(), nullptr, "Invalid host ID");
 
+    SlotLock lock(id);
+    std::shared_ptr<Derived> instance = instances_[id];
+
     ESP_UTILS_LOG_TRACE_EXIT();
 
-    return instances_[id];
+    return instance;
 }
 
 } // namespace esp_panel::drivers
@@ -29,7 +29,7 @@ HostDSI::~HostDSI()
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 }
 
-bool HostDSI::begin()
+bool HostDSI::beginImpl()
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
 
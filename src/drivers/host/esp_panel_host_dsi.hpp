@@ -22,6 +22,8 @@ public:
     /* Add friend class to allow them to access the private member */
     template <typename U>
     friend struct esp_utils::GeneralMemoryAllocator;    // To access `HostDSI()`
+    template <typename U>
+    friend struct utils::PoolMemoryAllocator;           // To access `HostDSI()`
     template <class Instance, typename Config, int N>
     friend class Host;                                  // To access `del()`, `calibrateConfig()`
 
@@ -30,13 +32,6 @@ public:
      */
     ~HostDSI() override;
 
-    /**
-     * @brief Startup the host
-     *
-     * @return `true` if successful, `false` otherwise
-     */
-    bool begin() override;
-
 private:
     /**
      * @brief Private constructor to prevent direct instantiation
@@ -47,6 +42,13 @@ private:
     HostDSI(int id, const esp_lcd_dsi_bus_config_t &config):
         Host<HostDSI, esp_lcd_dsi_bus_config_t, MIPI_DSI_LL_NUM_BUS>(id, config) {}
 
+    /**
+     * @brief Startup the host, called by `begin()` with the slot of the host held
+     *
+     * @return `true` if successful, `false` otherwise
+     */
+    bool beginImpl() override;
+
     /**
      * @brief Calibrate configuration when host already exists
      *
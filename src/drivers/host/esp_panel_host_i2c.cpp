@@ -4,6 +4,9 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <algorithm>
+#include "freertos/task.h"
+#include "esp_timer.h"
 #include "utils/esp_panel_utils_log.h"
 #include "esp_panel_host_i2c.hpp"
 
@@ -13,6 +16,10 @@ HostI2C::~HostI2C()
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
 
+    // The scheduler task uses the bus, so stop it first
+    stopScheduler();
+    vSemaphoreDelete(scheduler_.mutex);
+
     if (isOverState(State::BEGIN)) {
         ESP_UTILS_CHECK_ERROR_EXIT(
             i2c_del_master_bus(static_cast<i2c_master_bus_handle_t>(handle_)), "I2C driver delete failed"
@@ -25,7 +32,7 @@ HostI2C::~HostI2C()
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 }
 
-bool HostI2C::begin()
+bool HostI2C::beginImpl()
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
 
@@ -49,6 +56,217 @@ end:
     return true;
 }
 
+bool HostI2C::submitTransaction(Transaction trans)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::BEGIN), false, "Not begun");
+    ESP_UTILS_CHECK_NULL_RETURN(trans.device, false, "Invalid device");
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        !trans.write_data.empty() || (trans.read_size > 0), false, "Empty transaction"
+    );
+    ESP_UTILS_CHECK_FALSE_RETURN((trans.read_size == 0) || (trans.read_data != nullptr), false, "Invalid read buffer");
+
+    ESP_UTILS_CHECK_FALSE_RETURN(startScheduler(), false, "Start scheduler failed");
+
+    TransactionDoneCallback replaced_on_done = nullptr;
+    void *replaced_user_ctx = nullptr;
+    {
+        SchedulerLock lock(this);
+
+        // Replace the queued write of the same register, only the latest value matters
+        auto it = scheduler_.queue.end();
+        if (trans.replaceable && (trans.read_size == 0) && !trans.write_data.empty()) {
+            it = std::find_if(scheduler_.queue.begin(), scheduler_.queue.end(), [&trans](const Transaction & queued) {
+                return queued.replaceable && (queued.device == trans.device) && (queued.read_size == 0) &&
+                       !queued.write_data.empty() && (queued.write_data[0] == trans.write_data[0]);
+            });
+        }
+        if (it != scheduler_.queue.end()) {
+            replaced_on_done = it->on_done;
+            replaced_user_ctx = it->user_ctx;
+            *it = std::move(trans);
+            scheduler_.stats.replaced++;
+        } else {
+            scheduler_.queue.push_back(std::move(trans));
+            scheduler_.stats.max_queue_length = std::max(
+                                                    scheduler_.stats.max_queue_length,
+                                                    static_cast<uint32_t>(scheduler_.queue.size())
+                                                );
+        }
+    }
+    // The replaced transaction is considered finished, since its data is overwritten by the newer one
+    if (replaced_on_done != nullptr) {
+        replaced_on_done(ESP_OK, replaced_user_ctx);
+    }
+    xSemaphoreGive(scheduler_.wake_sem);
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool HostI2C::flushTransactions(uint32_t timeout_ms)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    TickType_t start_tick = xTaskGetTickCount();
+    while (true) {
+        {
+            SchedulerLock lock(this);
+            if (scheduler_.queue.empty() && !scheduler_.is_busy) {
+                break;
+            }
+        }
+        if ((xTaskGetTickCount() - start_tick) >= pdMS_TO_TICKS(timeout_ms)) {
+            ESP_UTILS_LOGW("Flush transactions timeout");
+            return false;
+        }
+        vTaskDelay(1);
+    }
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+HostI2C::OccupancyStats HostI2C::getOccupancyStats()
+{
+    SchedulerLock lock(this);
+
+    return scheduler_.stats;
+}
+
+int HostI2C::getOccupancyPercent()
+{
+    SchedulerLock lock(this);
+
+    int64_t elapsed_us = esp_timer_get_time() - scheduler_.stats.start_us;
+    if ((scheduler_.task == nullptr) || (elapsed_us <= 0)) {
+        return 0;
+    }
+
+    return static_cast<int>(scheduler_.stats.busy_us * 100 / elapsed_us);
+}
+
+void HostI2C::resetOccupancyStats()
+{
+    SchedulerLock lock(this);
+
+    scheduler_.stats = {};
+    scheduler_.stats.start_us = esp_timer_get_time();
+}
+
+bool HostI2C::startScheduler()
+{
+    SchedulerLock lock(this);
+
+    if (scheduler_.task != nullptr) {
+        return true;
+    }
+
+    if (scheduler_.wake_sem == nullptr) {
+        scheduler_.wake_sem = xSemaphoreCreateBinary();
+        ESP_UTILS_CHECK_NULL_RETURN(scheduler_.wake_sem, false, "Create wake semaphore failed");
+    }
+    if (scheduler_.exit_sem == nullptr) {
+        scheduler_.exit_sem = xSemaphoreCreateBinary();
+        ESP_UTILS_CHECK_NULL_RETURN(scheduler_.exit_sem, false, "Create exit semaphore failed");
+    }
+    scheduler_.is_stopping = false;
+    scheduler_.stats = {};
+    scheduler_.stats.start_us = esp_timer_get_time();
+
+    BaseType_t ret = xTaskCreate(
+                         schedulerTask, "i2c_sched", SCHEDULER_TASK_STACK_SIZE, this, SCHEDULER_TASK_PRIORITY,
+                         &scheduler_.task
+                     );
+    ESP_UTILS_CHECK_FALSE_RETURN(ret == pdPASS, false, "Create scheduler task failed");
+    ESP_UTILS_LOGD("Start I2C host(%d) scheduler", getID());
+
+    return true;
+}
+
+void HostI2C::stopScheduler()
+{
+    {
+        SchedulerLock lock(this);
+        if (scheduler_.task != nullptr) {
+            scheduler_.is_stopping = true;
+        }
+    }
+
+    if (scheduler_.is_stopping) {
+        xSemaphoreGive(scheduler_.wake_sem);
+        xSemaphoreTake(scheduler_.exit_sem, portMAX_DELAY);
+        scheduler_.task = nullptr;
+        scheduler_.queue.clear();
+        ESP_UTILS_LOGD("Stop I2C host(%d) scheduler", getID());
+    }
+    if (scheduler_.wake_sem != nullptr) {
+        vSemaphoreDelete(scheduler_.wake_sem);
+        scheduler_.wake_sem = nullptr;
+    }
+    if (scheduler_.exit_sem != nullptr) {
+        vSemaphoreDelete(scheduler_.exit_sem);
+        scheduler_.exit_sem = nullptr;
+    }
+}
+
+void HostI2C::schedulerTask(void *arg)
+{
+    auto host = static_cast<HostI2C *>(arg);
+    auto &scheduler = host->scheduler_;
+    int timeout = SCHEDULER_TIMEOUT_MS;
+
+    while (xSemaphoreTake(scheduler.wake_sem, portMAX_DELAY) == pdTRUE) {
+        while (true) {
+            Transaction trans;
+            {
+                SchedulerLock lock(host);
+                if (scheduler.is_stopping || scheduler.queue.empty()) {
+                    break;
+                }
+                trans = std::move(scheduler.queue.front());
+                scheduler.queue.pop_front();
+                scheduler.is_busy = true;
+            }
+
+            int64_t start_us = esp_timer_get_time();
+            esp_err_t ret = ESP_OK;
+            if (trans.read_size > 0) {
+                ret = trans.write_data.empty() ?
+                      i2c_master_receive(trans.device, trans.read_data, trans.read_size, timeout) :
+                      i2c_master_transmit_receive(
+                          trans.device, trans.write_data.data(), trans.write_data.size(), trans.read_data,
+                          trans.read_size, timeout
+                      );
+            } else {
+                ret = i2c_master_transmit(trans.device, trans.write_data.data(), trans.write_data.size(), timeout);
+            }
+            int64_t busy_us = esp_timer_get_time() - start_us;
+            if (trans.on_done != nullptr) {
+                trans.on_done(ret, trans.user_ctx);
+            }
+
+            SchedulerLock lock(host);
+            scheduler.is_busy = false;
+            scheduler.stats.busy_us += busy_us;
+            scheduler.stats.executed++;
+            if (ret != ESP_OK) {
+                scheduler.stats.failed++;
+            }
+        }
+
+        if (scheduler.is_stopping) {
+            break;
+        }
+    }
+
+    xSemaphoreGive(scheduler.exit_sem);
+    vTaskDelete(nullptr);
+}
+
 bool HostI2C::calibrateConfig(const i2c_master_bus_config_t  &config)
 {
     if (memcmp(&config, &this->config_, sizeof(i2c_master_bus_config_t ))) {
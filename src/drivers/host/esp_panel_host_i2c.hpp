@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
 #include "driver/i2c_master.h"
 #include "esp_panel_host.hpp"
 
@@ -13,12 +15,62 @@ namespace esp_panel::drivers {
 
 /**
  * @brief I2C bus host class
+ *
+ * Besides the synchronous transactions issued by the devices directly, the host has a transaction scheduler for the
+ * non-urgent ones (e.g. backlight updates). They are submitted by `submitTransaction()` and executed by a low priority
+ * task, so they never block the caller, and a waiting higher priority task (e.g. touch reading) gets the bus first.
  */
 class HostI2C : public Host<HostI2C, i2c_master_bus_config_t, static_cast<int>(I2C_NUM_MAX)> {
 public:
+    static constexpr int SCHEDULER_TASK_STACK_SIZE = 3 * 1024;
+    static constexpr int SCHEDULER_TASK_PRIORITY = 1;
+    static constexpr int SCHEDULER_TIMEOUT_MS = 100;
+
+    /**
+     * @brief Callback of a finished transaction
+     *
+     * It is called in the scheduler task after the transaction is executed. If the transaction is replaced by a newer
+     * one before being executed, it is called with `ESP_OK` in the caller context of `submitTransaction()` of the newer
+     * one instead. It is not called for the pending transactions dropped by stopping the scheduler.
+     *
+     * @param[in] ret      Result of the transaction
+     * @param[in] user_ctx User context passed to `submitTransaction()`
+     */
+    using TransactionDoneCallback = void (*)(esp_err_t ret, void *user_ctx);
+
+    /**
+     * @brief Transaction structure for the scheduler
+     *
+     * If `read_size` is not `0`, the write and read are combined into one transfer with a repeated start, which is the
+     * usual way to read registers.
+     */
+    struct Transaction {
+        i2c_master_dev_handle_t device = nullptr;   /*!< Device handle */
+        utils::vector<uint8_t> write_data;          /*!< Data to write, copied when submitting */
+        uint8_t *read_data = nullptr;               /*!< Buffer to read, should be valid until the callback */
+        size_t read_size = 0;                       /*!< Size to read in bytes */
+        bool replaceable = false;                   /*!< If `true`, a queued write to the same device starting with
+                                                     *   the same byte (register) is replaced by this one */
+        TransactionDoneCallback on_done = nullptr;  /*!< Callback when finished or replaced, optional */
+        void *user_ctx = nullptr;                   /*!< User context of the callback */
+    };
+
+    /**
+     * @brief Bus occupancy statistics of the scheduler
+     */
+    struct OccupancyStats {
+        int64_t start_us = 0;           /*!< Time of the start (or reset) of the statistics */
+        int64_t busy_us = 0;            /*!< Time spent on executing the transactions */
+        uint32_t executed = 0;          /*!< Number of executed transactions */
+        uint32_t replaced = 0;          /*!< Number of transactions replaced before being executed */
+        uint32_t failed = 0;            /*!< Number of failed transactions */
+        uint32_t max_queue_length = 0;  /*!< Maximum number of pending transactions */
+    };
     /* Add friend class to allow them to access the private member */
     template <typename U>
     friend struct esp_utils::GeneralMemoryAllocator;    // To access `HostI2C()`
+    template <typename U>
+    friend struct utils::PoolMemoryAllocator;           // To access `HostI2C()`
     template <class Instance, typename Config, int N>
     friend class Host;                                  // To access `del()`, `calibrateConfig()`
 
@@ -28,11 +80,41 @@ public:
     ~HostI2C() override;
 
     /**
-     * @brief Startup the host
+     * @brief Submit a transaction to the scheduler, which is executed asynchronously
      *
+     * @param[in] trans Transaction to submit
      * @return `true` if successful, `false` otherwise
+     * @note The scheduler task is created on the first submission
+     */
+    bool submitTransaction(Transaction trans);
+
+    /**
+     * @brief Wait until all the submitted transactions are finished
+     *
+     * @param[in] timeout_ms Maximum time to wait in milliseconds
+     * @return `true` if all finished, `false` if timeout
+     * @note Call this function before removing a device which has submitted transactions
+     */
+    bool flushTransactions(uint32_t timeout_ms);
+
+    /**
+     * @brief Get the bus occupancy statistics of the scheduler
+     *
+     * @return Copy of the statistics
+     */
+    OccupancyStats getOccupancyStats();
+
+    /**
+     * @brief Get the percentage of time the bus is occupied by the scheduler since the start of the statistics
+     *
+     * @return Occupancy in percent, `0` if the scheduler is not started
      */
-    bool begin() override;
+    int getOccupancyPercent();
+
+    /**
+     * @brief Reset the bus occupancy statistics of the scheduler
+     */
+    void resetOccupancyStats();
 
 private:
     /**
@@ -42,7 +124,18 @@ private:
      * @param[in] config Host configuration
      */
     HostI2C(int id, const i2c_master_bus_config_t  &config):
-        Host<HostI2C, i2c_master_bus_config_t , static_cast<int>(I2C_NUM_MAX)>(id, config) {}
+        Host<HostI2C, i2c_master_bus_config_t , static_cast<int>(I2C_NUM_MAX)>(id, config)
+    {
+        // The static mutex never fails to be created
+        scheduler_.mutex = xSemaphoreCreateMutexStatic(&scheduler_.mutex_buffer);
+    }
+
+    /**
+     * @brief Startup the host, called by `begin()` with the slot of the host held
+     *
+     * @return `true` if successful, `false` otherwise
+     */
+    bool beginImpl() override;
 
     /**
      * @brief Calibrate configuration when host already exists
@@ -51,6 +144,56 @@ private:
      * @return `true` if successful, `false` otherwise
      */
     bool calibrateConfig(const i2c_master_bus_config_t  &config) override;
+
+    /**
+     * @brief Start the scheduler task if not started
+     *
+     * @return `true` if successful, `false` otherwise
+     */
+    bool startScheduler();
+
+    /**
+     * @brief Stop the scheduler task and drop the pending transactions
+     */
+    void stopScheduler();
+
+    /**
+     * @brief Scheduler task function
+     *
+     * @param[in] arg Host instance
+     */
+    static void schedulerTask(void *arg);
+
+    /**
+     * @brief Scoped lock of the scheduler mutex
+     */
+    class SchedulerLock {
+    public:
+        explicit SchedulerLock(HostI2C *host): mutex_(host->scheduler_.mutex)
+        {
+            xSemaphoreTake(mutex_, portMAX_DELAY);
+        }
+
+        ~SchedulerLock()
+        {
+            xSemaphoreGive(mutex_);
+        }
+
+    private:
+        SemaphoreHandle_t mutex_;
+    };
+
+    struct {
+        StaticSemaphore_t mutex_buffer;             /*!< Buffer of the mutex */
+        SemaphoreHandle_t mutex = nullptr;          /*!< Mutex of the members below */
+        utils::deque<Transaction> queue;            /*!< Pending transactions */
+        TaskHandle_t task = nullptr;                /*!< Scheduler task handle */
+        SemaphoreHandle_t wake_sem = nullptr;       /*!< Given when a transaction is submitted or to stop */
+        SemaphoreHandle_t exit_sem = nullptr;       /*!< Given when the task exits */
+        bool is_busy = false;                       /*!< Whether a transaction is being executed */
+        bool is_stopping = false;                   /*!< Whether the task is requested to exit */
+        OccupancyStats stats;                       /*!< Bus occupancy statistics */
+    } scheduler_;
 };
 
 } // namespace esp_panel::drivers
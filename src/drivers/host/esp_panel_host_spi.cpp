@@ -22,11 +22,12 @@ HostSPI::~HostSPI()
 
         setState(State::DEINIT);
     }
+    vSemaphoreDelete(urgent_done_sem_);
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 }
 
-bool HostSPI::begin()
+bool HostSPI::beginImpl()
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
 
@@ -51,28 +52,55 @@ end:
     return true;
 }
 
-bool HostSPI::calibrateConfig(const spi_bus_config_t &config_)
+void HostSPI::beginUrgentTransaction()
 {
-    spi_bus_config_t temp_config = config_;
+    urgent_count_++;
+}
 
-    // Keep the compatibility between SPI and QSPI
-    if (temp_config.miso_io_num < 0) {
-        temp_config.miso_io_num = this->config_.miso_io_num;
-    } else if (this->config_.miso_io_num < 0) {
-        this->config_.miso_io_num = temp_config.miso_io_num;
-    }
-    if (temp_config.quadwp_io_num < 0) {
-        temp_config.quadwp_io_num = this->config_.quadwp_io_num;
-    } else if (this->config_.quadwp_io_num < 0) {
-        this->config_.quadwp_io_num = temp_config.quadwp_io_num;
+void HostSPI::endUrgentTransaction()
+{
+    if (--urgent_count_ == 0) {
+        xSemaphoreGive(urgent_done_sem_);
     }
-    if (temp_config.quadhd_io_num < 0) {
-        temp_config.quadhd_io_num = this->config_.quadhd_io_num;
-    } else if (this->config_.quadhd_io_num < 0) {
-        this->config_.quadhd_io_num = temp_config.quadhd_io_num;
+}
+
+bool HostSPI::waitUrgentTransactions(uint32_t timeout_ms)
+{
+    TickType_t start_tick = xTaskGetTickCount();
+    TickType_t timeout_tick = pdMS_TO_TICKS(timeout_ms);
+
+    // The semaphore may be given without a waiter or taken by another waiter, so only use it to wake up early and
+    // always check the counter
+    while (urgent_count_ > 0) {
+        if ((xTaskGetTickCount() - start_tick) >= timeout_tick) {
+            return false;
+        }
+        xSemaphoreTake(urgent_done_sem_, 1);
     }
 
-    if (memcmp(&config_, &this->config_, sizeof(spi_bus_config_t))) {
+    return true;
+}
+
+bool HostSPI::calibrateConfig(const spi_bus_config_t &config_)
+{
+    spi_bus_config_t temp_config = config_;
+    spi_bus_config_t merged_config = this->config_;
+
+    // Keep the compatibility between SPI and QSPI, the unused pins of each side are taken from the other side
+    auto merge_pin = [](int &new_pin, int &merged_pin) {
+        if (new_pin < 0) {
+            new_pin = merged_pin;
+        } else if (merged_pin < 0) {
+            merged_pin = new_pin;
+        }
+    };
+    merge_pin(temp_config.miso_io_num, merged_config.miso_io_num);
+    merge_pin(temp_config.quadwp_io_num, merged_config.quadwp_io_num);
+    merge_pin(temp_config.quadhd_io_num, merged_config.quadhd_io_num);
+    // The maximum transfer size may be tuned by the first device, the others just use the existing one
+    temp_config.max_transfer_sz = merged_config.max_transfer_sz;
+
+    if (memcmp(&temp_config, &merged_config, sizeof(spi_bus_config_t))) {
         ESP_UTILS_LOGI(
             "\n{Original config}\n"
             "\t- mosi_io_num: %d\n"
@@ -101,6 +129,8 @@ bool HostSPI::calibrateConfig(const spi_bus_config_t &config_)
         );
         ESP_UTILS_CHECK_FALSE_RETURN(false, false, "Config mismatch");
     }
+    // Only apply the merged pins if the configurations are compatible
+    this->config_ = merged_config;
 
     return true;
 }
@@ -6,7 +6,10 @@
 
 #pragma once
 
+#include <atomic>
 #include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
 #include "driver/spi_master.h"
 #include "esp_panel_host.hpp"
 
@@ -20,6 +23,8 @@ public:
     /* Add friend class to allow them to access the private member */
     template <typename U>
     friend struct esp_utils::GeneralMemoryAllocator;    // To access `HostSPI()`
+    template <typename U>
+    friend struct utils::PoolMemoryAllocator;           // To access `HostSPI()`
     template <class Instance, typename Config, int N>
     friend class Host;                                  // To access `del()`, `calibrateConfig()`
 
@@ -29,11 +34,25 @@ public:
     ~HostSPI() override;
 
     /**
-     * @brief Startup the host
+     * @brief Mark the start of an urgent transaction, the bulk transfers on the host will yield to it at the next
+     *        chunk boundary
      *
-     * @return `true` if successful, `false` otherwise
+     * @note This function should be paired with `endUrgentTransaction()`
+     */
+    void beginUrgentTransaction();
+
+    /**
+     * @brief Mark the end of an urgent transaction
      */
-    bool begin() override;
+    void endUrgentTransaction();
+
+    /**
+     * @brief Wait until there is no urgent transaction on the host
+     *
+     * @param[in] timeout_ms Maximum time to wait in milliseconds
+     * @return `true` if no urgent transaction is pending, `false` if timeout
+     */
+    bool waitUrgentTransactions(uint32_t timeout_ms);
 
 private:
     /**
@@ -43,7 +62,17 @@ private:
      * @param[in] config Host configuration
      */
     HostSPI(int id, const spi_bus_config_t &config):
-        Host<HostSPI, spi_bus_config_t, static_cast<int>(SPI_HOST_MAX)>(id, config) {}
+        Host<HostSPI, spi_bus_config_t, static_cast<int>(SPI_HOST_MAX)>(id, config)
+    {
+        urgent_done_sem_ = xSemaphoreCreateBinaryStatic(&urgent_done_sem_buffer_);
+    }
+
+    /**
+     * @brief Startup the host, called by `begin()` with the slot of the host held
+     *
+     * @return `true` if successful, `false` otherwise
+     */
+    bool beginImpl() override;
 
     /**
      * @brief Calibrate configuration when host already exists
@@ -52,24 +81,10 @@ private:
      * @return `true` if successful, `false` otherwise
      */
     bool calibrateConfig(const spi_bus_config_t &config) override;
-};
 
-/**
- * SPI & QSPI Host Default Configuration
- *
- */
-/* Refer to `hal/spi_ll.h` in SDK (ESP-IDF) */
-#ifdef CONFIG_IDF_TARGET_ESP32
-// ESP32
-#define ESP_PANEL_HOST_SPI_MAX_TRANSFER_SIZE   ((1U << 24) >> 3)
-#elif CONFIG_IDF_TARGET_ESP32S2
-// ESP32-S2
-#define ESP_PANEL_HOST_SPI_MAX_TRANSFER_SIZE   ((1U << 23) >> 3)
-#else
-// ESP32-C3, ESP32-C3, ESP32-C5, ESP32-C6, ESP32-C61
-// ESP32-S3
-// ESP32-P4
-#define ESP_PANEL_HOST_SPI_MAX_TRANSFER_SIZE   ((1U << 18) >> 3)
-#endif
+    std::atomic<int> urgent_count_ = 0;             /*!< Number of urgent transactions in progress */
+    SemaphoreHandle_t urgent_done_sem_ = nullptr;   /*!< Given when the last urgent transaction ends */
+    StaticSemaphore_t urgent_done_sem_buffer_ = {}; /*!< Static buffer of `urgent_done_sem_` */
+};
 
 } // namespace esp_panel::drivers
@@ -4,16 +4,22 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <inttypes.h>
 #include <algorithm>
+#include <cstddef>
+#include <cstring>
 #include <memory>
 #include <numeric>
 #include "sdkconfig.h"
+#include "esp_attr.h"
+#include "esp_system.h"
 #include "esp_heap_caps.h"
 #include "esp_lcd_panel_ops.h"
 #include "esp_lcd_panel_io.h"
 #include "esp_memory_utils.h"
 #include "driver/spi_master.h"
 #include "utils/esp_panel_utils_log.h"
+#include "utils/esp_panel_utils_image.hpp"
 #include "esp_panel_lcd.hpp"
 
 
@@ -22,6 +28,54 @@
 
 namespace esp_panel::drivers {
 
+#define WARM_START_MARKER_MAGIC         (0x4C43444DUL)  /* "LCDM" */
+#define WARM_START_FNV_OFFSET_BASIS     (2166136261UL)
+#define WARM_START_FNV_PRIME            (16777619UL)
+
+#define DRAW_IMAGE_STRIPE_SIZE          (8 * 1024)
+
+// The vendor initialization commands are written by `Bus::writeRegisterBatch()` directly
+static_assert(sizeof(Bus::RegisterCommand) == sizeof(esp_panel_lcd_vendor_init_cmd_t), "Layout mismatch");
+static_assert(
+    offsetof(Bus::RegisterCommand, data) == offsetof(esp_panel_lcd_vendor_init_cmd_t, data), "Layout mismatch"
+);
+static_assert(
+    offsetof(Bus::RegisterCommand, data_size) == offsetof(esp_panel_lcd_vendor_init_cmd_t, data_bytes),
+    "Layout mismatch"
+);
+static_assert(
+    offsetof(Bus::RegisterCommand, delay_ms) == offsetof(esp_panel_lcd_vendor_init_cmd_t, delay_ms), "Layout mismatch"
+);
+
+static esp_err_t tx_vendor_init_cmds(const esp_panel_lcd_vendor_init_cmd_t *cmds, size_t cmds_num, void *user_ctx)
+{
+    auto bus = static_cast<const Bus *>(user_ctx);
+
+    return bus->writeRegisterBatch(reinterpret_cast<const Bus::RegisterCommand *>(cmds), cmds_num) ? ESP_OK :
+           ESP_FAIL;
+}
+
+/**
+ * @brief Panel initialized marker, retained across software resets and deep-sleep wake-ups
+ */
+struct WarmStartMarker {
+    uint32_t magic;
+    uint32_t signature;
+    uint32_t signature_inv;
+};
+
+static RTC_NOINIT_ATTR WarmStartMarker warm_start_marker;
+
+static uint32_t warm_start_hash(uint32_t hash, const void *data, size_t size)
+{
+    auto bytes = static_cast<const uint8_t *>(data);
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * WARM_START_FNV_PRIME;
+    }
+
+    return hash;
+}
+
 void LCD::BasicBusSpecification::print(utils::string bus_name) const
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
@@ -113,34 +167,14 @@ void LCD::Config::convertPartialToFull()
 #if ESP_UTILS_CONF_LOG_LEVEL == ESP_UTILS_LOG_LEVEL_DEBUG
         printDeviceConfig();
 #endif // ESP_UTILS_LOG_LEVEL_DEBUG
-        auto &config = std::get<DevicePartialConfig>(device);
-        device = DeviceFullConfig{
-            .reset_gpio_num = config.reset_gpio_num,
-            .rgb_ele_order = static_cast<lcd_rgb_element_order_t>(config.rgb_ele_order),
-            .data_endian = LCD_RGB_DATA_ENDIAN_BIG,
-            .bits_per_pixel = static_cast<uint32_t>(config.bits_per_pixel),
-            .flags = {
-                .reset_active_high = config.flags_reset_active_high,
-            },
-            .vendor_config = nullptr,
-        };
+        device = std::get<DevicePartialConfig>(device).toFull();
     }
 
     if (std::holds_alternative<VendorPartialConfig>(vendor)) {
 #if ESP_UTILS_CONF_LOG_LEVEL == ESP_UTILS_LOG_LEVEL_DEBUG
         printVendorConfig();
 #endif // ESP_UTILS_LOG_LEVEL_DEBUG
-        auto &config = std::get<VendorPartialConfig>(vendor);
-        vendor = VendorFullConfig{
-            .hor_res = config.hor_res,
-            .ver_res = config.ver_res,
-            .init_cmds = config.init_cmds,
-            .init_cmds_size = static_cast<unsigned int>(config.init_cmds_size),
-            .flags = {
-                .mirror_by_cmd = config.flags_mirror_by_cmd,
-                .enable_io_multiplex = config.flags_enable_io_multiplex,
-            },
-        };
+        vendor = std::get<VendorPartialConfig>(vendor).toFull();
     }
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
@@ -396,6 +430,38 @@ bool LCD::configFrameBufferNumber(int num)
     return true;
 }
 
+bool LCD::configWarmStart(bool en, uint32_t verify_reg, uint8_t verify_mask, uint8_t verify_value)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(!isOverState(State::INIT), false, "Should be called before `init()`");
+    ESP_UTILS_CHECK_FALSE_RETURN(isBusValid(), false, "Invalid bus");
+
+    auto bus_type = getBus()->getBasicAttributes().type;
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        (bus_type == ESP_PANEL_BUS_TYPE_SPI) || (bus_type == ESP_PANEL_BUS_TYPE_QSPI), false,
+        "Only valid for the \"SPI\" and \"QSPI\" bus"
+    );
+
+    ESP_UTILS_LOGD(
+        "Param: en(%d), verify_reg(0x%" PRIx32 "), verify_mask(0x%02x), verify_value(0x%02x)", en, verify_reg,
+        verify_mask, verify_value
+    );
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        (verify_value & ~verify_mask) == 0, false, "Verify value(0x%02x) is out of mask(0x%02x)", verify_value,
+        verify_mask
+    );
+
+    _warm_start.enable = en;
+    _warm_start.verify_reg = verify_reg;
+    _warm_start.verify_mask = verify_mask;
+    _warm_start.verify_value = verify_value;
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
 bool LCD::begin()
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
@@ -408,12 +474,31 @@ bool LCD::begin()
         ESP_UTILS_CHECK_FALSE_RETURN(init(), false, "Init failed");
     }
 
-    /* Reset the panel before initializing */
-    ESP_UTILS_CHECK_FALSE_RETURN(reset(), false, "Reset failed");
+    /* If the panel keeps the state of the last initialization, skip reset and initialization */
+    _warm_start.is_started = _warm_start.enable && !isOverState(State::RESET) && checkWarmStart();
+    if (_warm_start.is_started) {
+        ESP_UTILS_LOGI("Warm start, skip reset and initialization");
+    } else {
+        // Invalidate the marker first, in case the initialization is interrupted
+        if (_warm_start.enable) {
+            warm_start_marker.magic = 0;
+        }
+
+        /* Reset the panel before initializing */
+        ESP_UTILS_CHECK_FALSE_RETURN(reset(), false, "Reset failed");
+
+        /* Initialize refresh panel */
+        ESP_UTILS_CHECK_ERROR_RETURN(esp_lcd_panel_init(refresh_panel), false, "Init panel failed");
+        ESP_UTILS_LOGD("Refresh panel(@%p) initialized", refresh_panel);
 
-    /* Initialize refresh panel */
-    ESP_UTILS_CHECK_ERROR_RETURN(esp_lcd_panel_init(refresh_panel), false, "Init panel failed");
-    ESP_UTILS_LOGD("Refresh panel(@%p) initialized", refresh_panel);
+        if (_warm_start.enable) {
+            auto signature = getWarmStartSignature();
+            warm_start_marker.signature = signature;
+            warm_start_marker.signature_inv = ~signature;
+            warm_start_marker.magic = WARM_START_MARKER_MAGIC;
+            ESP_UTILS_LOGD("Record warm start marker(0x%08" PRIx32 ")", signature);
+        }
+    }
 
     auto bus_type = getBus()->getBasicAttributes().type;
     /* If the panel is reset, goto end directly */
@@ -505,6 +590,8 @@ bool LCD::reset()
 
     ESP_UTILS_CHECK_ERROR_RETURN(esp_lcd_panel_reset(refresh_panel), false, "Reset panel failed");
     ESP_UTILS_LOGD("Refresh panel(@%p) reset", refresh_panel);
+    // The registers are back to the default values, so the data in the shadow is stale
+    getBus()->invalidateRegisterShadow();
 
 end:
     // If not begun, only reset the panel, not reset the state
@@ -531,6 +618,8 @@ bool LCD::del()
 
     _transformation = {};
     _interruption = {};
+    _warm_start.is_started = false;
+    _align_buffer = {};
 
     setState(State::DEINIT);
 
@@ -615,6 +704,208 @@ bool LCD::drawBitmap(int x_start, int y_start, int width, int height, const uint
     return true;
 }
 
+bool LCD::drawBitmapAligned(
+    int x_start, int y_start, int width, int height, const uint8_t *canvas, int canvas_width, int canvas_height,
+    int timeout_ms
+)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::BEGIN), false, "Not begun");
+
+    ESP_UTILS_LOGD(
+        "Param: x_start(%d), y_start(%d), width(%d), height(%d), canvas(@%p), canvas_width(%d), canvas_height(%d), "
+        "timeout_ms(%d)", x_start, y_start, width, height, canvas, canvas_width, canvas_height, timeout_ms
+    );
+
+    ESP_UTILS_CHECK_NULL_RETURN(canvas, false, "Invalid canvas");
+    int bytes_per_pixel = (getFrameColorBits() + 7) / 8;
+    ESP_UTILS_CHECK_FALSE_RETURN(bytes_per_pixel > 0, false, "Invalid color bits");
+
+    int x1 = x_start;
+    int y1 = y_start;
+    int aligned_width = width;
+    int aligned_height = height;
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        getAlignedRegion(x1, y1, aligned_width, aligned_height, canvas_width, canvas_height), false,
+        "Get aligned region failed"
+    );
+
+    size_t line_bytes = aligned_width * bytes_per_pixel;
+    size_t canvas_line_bytes = canvas_width * bytes_per_pixel;
+    const uint8_t *region = canvas + y1 * canvas_line_bytes + x1 * bytes_per_pixel;
+
+    // The lines of the region are contiguous in the canvas, so send it directly
+    if ((aligned_width == canvas_width) || (aligned_height == 1)) {
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            drawBitmap(x1, y1, aligned_width, aligned_height, region, timeout_ms), false, "Draw bitmap failed"
+        );
+
+        ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+        return true;
+    }
+
+    // Otherwise, pack the lines into the internal buffer
+    size_t buffer_size = line_bytes * aligned_height;
+    if (_align_buffer.size() < buffer_size) {
+        ESP_UTILS_CHECK_EXCEPTION_RETURN(_align_buffer.resize(buffer_size), false, "Resize align buffer failed");
+    }
+    uint8_t *buffer = _align_buffer.data();
+    for (int i = 0; i < aligned_height; i++) {
+        memcpy(buffer + i * line_bytes, region + i * canvas_line_bytes, line_bytes);
+    }
+
+    // The buffer is reused by the next call, so wait for the drawing to finish
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        drawBitmap(x1, y1, aligned_width, aligned_height, buffer, (timeout_ms == 0) ? -1 : timeout_ms), false,
+        "Draw bitmap failed"
+    );
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool LCD::getAlignedRegion(int &x_start, int &y_start, int &width, int &height, int canvas_width, int canvas_height)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_LOGD(
+        "Param: x_start(%d), y_start(%d), width(%d), height(%d), canvas_width(%d), canvas_height(%d)", x_start,
+        y_start, width, height, canvas_width, canvas_height
+    );
+
+    // Check basic parameters validity
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        (x_start >= 0) && (y_start >= 0), false, "Invalid start coordinates: (%d,%d)", x_start, y_start
+    );
+    ESP_UTILS_CHECK_FALSE_RETURN((width > 0) && (height > 0), false, "Empty region: (%d,%d)", width, height);
+
+    // Clamp the region to the canvas and display limits
+    auto swap_xy = getTransformation().swap_xy;
+    auto frame_width = getFrameWidth();
+    auto frame_height = getFrameHeight();
+    int max_x = canvas_width;
+    int max_y = canvas_height;
+    if (frame_width > 0) {
+        max_x = std::min(max_x, swap_xy ? frame_height : frame_width);
+    }
+    if (frame_height > 0) {
+        max_y = std::min(max_y, swap_xy ? frame_width : frame_height);
+    }
+    int x_end = std::min(x_start + width, max_x);
+    int y_end = std::min(y_start + height, max_y);
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        (x_start < x_end) && (y_start < y_end), false, "Region is out of the limits(%dx%d)", max_x, max_y
+    );
+
+    // Round the region outward to the required alignment, and round the end down again if it exceeds the limits
+    int x_align = getBasicAttributes().basic_bus_spec.x_coord_align;
+    int y_align = getBasicAttributes().basic_bus_spec.y_coord_align;
+    int x1 = x_start & ~(x_align - 1);
+    int y1 = y_start & ~(y_align - 1);
+    int x2 = (x_end + x_align - 1) & ~(x_align - 1);
+    int y2 = (y_end + y_align - 1) & ~(y_align - 1);
+    if (x2 > max_x) {
+        x2 = max_x & ~(x_align - 1);
+    }
+    if (y2 > max_y) {
+        y2 = max_y & ~(y_align - 1);
+    }
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        (x1 < x2) && (y1 < y2), false, "No aligned region in the limits(%dx%d)", max_x, max_y
+    );
+    if ((x2 < x_end) || (y2 < y_end)) {
+        ESP_UTILS_LOGW("Drop the unaligned end of the region: (%d,%d) -> (%d,%d)", x_end, y_end, x2, y2);
+    }
+
+    x_start = x1;
+    y_start = y1;
+    width = x2 - x1;
+    height = y2 - y1;
+    ESP_UTILS_LOGD("Aligned region: x_start(%d), y_start(%d), width(%d), height(%d)", x_start, y_start, width, height);
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
+bool LCD::drawImage(int x_start, int y_start, const uint8_t *image, size_t size, uint16_t bg_color)
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    ESP_UTILS_CHECK_FALSE_RETURN(isOverState(State::BEGIN), false, "Not begun");
+
+    ESP_UTILS_LOGD(
+        "Param: x_start(%d), y_start(%d), image(@%p), size(%d), bg_color(0x%04x)", x_start, y_start, image,
+        static_cast<int>(size), bg_color
+    );
+
+    ESP_UTILS_CHECK_FALSE_RETURN(getFrameColorBits() == 16, false, "Only support 16-bit color depth");
+
+    utils::ImageDecoder decoder;
+    auto bus_type = getBus()->getBasicAttributes().type;
+    // For SPI bus, the data bytes should be swapped since the data is sent by LSB first
+    decoder.setSwapBytes((bus_type == ESP_PANEL_BUS_TYPE_SPI) || (bus_type == ESP_PANEL_BUS_TYPE_QSPI));
+    decoder.setBackgroundColor(bg_color);
+    ESP_UTILS_CHECK_FALSE_RETURN(decoder.begin(image, size), false, "Invalid image");
+
+    int width = decoder.getHeader().width;
+    int height = decoder.getHeader().height;
+    if ((width == 0) || (height == 0)) {
+        return true;
+    }
+
+    // Keep the stripes aligned, so only the last one may be unaligned
+    int y_align = getBasicAttributes().basic_bus_spec.y_coord_align;
+    int stripe_lines = std::min(std::max(DRAW_IMAGE_STRIPE_SIZE / (width * 2), 1), height);
+    if (stripe_lines > y_align) {
+        stripe_lines &= ~(y_align - 1);
+    }
+    utils::vector<uint16_t> stripes;
+    ESP_UTILS_CHECK_EXCEPTION_RETURN(
+        stripes.resize(2 * stripe_lines * width), false, "Resize stripe buffers failed"
+    );
+    uint16_t *stripe_bufs[2] = {stripes.data(), stripes.data() + stripe_lines * width};
+
+    // Discard the finish signal left by the previous non-blocking drawing
+    auto finish_sem = _interruption.draw_bitmap_finish_sem;
+    if (finish_sem != nullptr) {
+        xSemaphoreTake(finish_sem, 0);
+    }
+
+    // Decode the next stripe while the previous one is being transmitted
+    int buf_index = 0;
+    int y = y_start;
+    int lines = decoder.decodeLines(stripe_bufs[buf_index], stripe_lines);
+    ESP_UTILS_CHECK_FALSE_RETURN(lines > 0, false, "Decode image failed");
+    while (lines > 0) {
+        ESP_UTILS_CHECK_FALSE_RETURN(
+            drawBitmap(x_start, y, width, lines, reinterpret_cast<const uint8_t *>(stripe_bufs[buf_index]), 0),
+            false, "Draw bitmap failed"
+        );
+        y += lines;
+        buf_index ^= 1;
+
+        int next_lines = 0;
+        if (!decoder.isFinished()) {
+            next_lines = decoder.decodeLines(stripe_bufs[buf_index], stripe_lines);
+        }
+        if (finish_sem != nullptr) {
+            ESP_UTILS_CHECK_FALSE_RETURN(
+                xSemaphoreTake(finish_sem, portMAX_DELAY) == pdTRUE, false, "Draw bitmap wait for finish failed"
+            );
+        }
+        ESP_UTILS_CHECK_FALSE_RETURN(next_lines >= 0, false, "Decode image failed");
+        lines = next_lines;
+    }
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
 bool LCD::mirrorX(bool en)
 {
     ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
@@ -1102,6 +1393,9 @@ bool LCD::processDeviceOnInit(const BasicBusSpecificationMap &bus_specs)
     case ESP_PANEL_BUS_TYPE_QSPI:
         vendor_config.flags.use_qspi_interface = 1;
         break;
+    case ESP_PANEL_BUS_TYPE_I80:
+        // The I80 bus shares the same initialization sequence with the SPI bus
+        break;
 // #if ESP_PANEL_DRIVERS_BUS_ENABLE_RGB
 //     /* Retrieve RGB configuration from the bus and register it into the vendor configuration */
 //     case ESP_PANEL_BUS_TYPE_RGB: {
@@ -1147,6 +1441,12 @@ bool LCD::processDeviceOnInit(const BasicBusSpecificationMap &bus_specs)
         break;
     }
 
+    // Write the vendor initialization commands through the bus, which batches the commands without delay
+    if (vendor_config.tx_init_cmds == nullptr) {
+        vendor_config.tx_init_cmds = tx_vendor_init_cmds;
+        vendor_config.tx_init_cmds_user_ctx = getBus();
+    }
+
     // Bind the vendor configuration to the device configuration
     auto &device_config = getDeviceFullConfig();
     device_config.vendor_config = &vendor_config;
@@ -1162,6 +1462,71 @@ bool LCD::processDeviceOnInit(const BasicBusSpecificationMap &bus_specs)
     return true;
 }
 
+uint32_t LCD::getWarmStartSignature()
+{
+    auto &device_config = getDeviceFullConfig();
+    auto &vendor_config = getVendorFullConfig();
+    int bus_type = getBus()->getBasicAttributes().type;
+    int rgb_ele_order = device_config.rgb_ele_order;
+    uint32_t bits_per_pixel = device_config.bits_per_pixel;
+
+    uint32_t hash = WARM_START_FNV_OFFSET_BASIS;
+    if (_basic_attributes.name != nullptr) {
+        hash = warm_start_hash(hash, _basic_attributes.name, strlen(_basic_attributes.name));
+    }
+    hash = warm_start_hash(hash, &bus_type, sizeof(bus_type));
+    hash = warm_start_hash(hash, &rgb_ele_order, sizeof(rgb_ele_order));
+    hash = warm_start_hash(hash, &bits_per_pixel, sizeof(bits_per_pixel));
+    hash = warm_start_hash(hash, &vendor_config.hor_res, sizeof(vendor_config.hor_res));
+    hash = warm_start_hash(hash, &vendor_config.ver_res, sizeof(vendor_config.ver_res));
+    // Hash the content of the commands instead of the address, which may change after the firmware is updated
+    for (unsigned int i = 0; (vendor_config.init_cmds != nullptr) && (i < vendor_config.init_cmds_size); i++) {
+        auto &init_cmd = vendor_config.init_cmds[i];
+        hash = warm_start_hash(hash, &init_cmd.cmd, sizeof(init_cmd.cmd));
+        if (init_cmd.data != nullptr) {
+            hash = warm_start_hash(hash, init_cmd.data, init_cmd.data_bytes);
+        }
+    }
+
+    return hash;
+}
+
+bool LCD::checkWarmStart()
+{
+    ESP_UTILS_LOG_TRACE_ENTER_WITH_THIS();
+
+    // The panel loses its state after these resets, and the RTC memory is not retained either
+    auto reset_reason = esp_reset_reason();
+    if ((reset_reason == ESP_RST_POWERON) || (reset_reason == ESP_RST_BROWNOUT) ||
+            (reset_reason == ESP_RST_UNKNOWN)) {
+        ESP_UTILS_LOGD("Reset reason(%d) doesn't allow warm start", static_cast<int>(reset_reason));
+        return false;
+    }
+
+    auto signature = getWarmStartSignature();
+    if ((warm_start_marker.magic != WARM_START_MARKER_MAGIC) || (warm_start_marker.signature != signature) ||
+            (warm_start_marker.signature_inv != ~signature)) {
+        ESP_UTILS_LOGD("Warm start marker mismatch");
+        return false;
+    }
+
+    // Read a status register to make sure the panel was not reset or powered off by others
+    uint8_t value = 0;
+    if (!getBus()->readRegisterData(_warm_start.verify_reg, &value, 1)) {
+        ESP_UTILS_LOGD("Read verify register failed");
+        return false;
+    }
+    // All bits high usually means the MISO line is floating
+    if ((value == 0xFF) || ((value & _warm_start.verify_mask) != _warm_start.verify_value)) {
+        ESP_UTILS_LOGD("Verify register(0x%" PRIx32 ") value(0x%02x) mismatch", _warm_start.verify_reg, value);
+        return false;
+    }
+
+    ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
+
+    return true;
+}
+
 LCD::DeviceFullConfig &LCD::getDeviceFullConfig()
 {
     if (!std::holds_alternative<DeviceFullConfig>(_config.device)) {
@@ -37,6 +37,15 @@ public:
      */
     static constexpr int FRAME_BUFFER_MAX_NUM = 3;
 
+    /**
+     * @brief Default register and expected bits used to verify the panel state in warm start mode
+     *
+     * `RDDPM` (0x0A) is the MIPI DCS "read display power mode" command, bit 4 (`SLPOUT`) is set once the panel has
+     * exited sleep mode, which is cleared by any hardware or power-on reset.
+     */
+    static constexpr uint32_t WARM_START_VERIFY_REG_DEFAULT = 0x0A;
+    static constexpr uint8_t WARM_START_VERIFY_MASK_DEFAULT = 0x10;
+
     /**
      * @brief Panel handle type definition for refresh operations
      */
@@ -145,6 +154,26 @@ public:
      * @brief Simplified device configuration structure
      */
     struct DevicePartialConfig {
+        /**
+         * @brief Convert to the full configuration
+         *
+         * @return Full device configuration
+         * @note This function can be evaluated at compile time
+         */
+        constexpr esp_lcd_panel_dev_config_t toFull() const
+        {
+            return esp_lcd_panel_dev_config_t{
+                .reset_gpio_num = reset_gpio_num,
+                .rgb_ele_order = static_cast<lcd_rgb_element_order_t>(rgb_ele_order),
+                .data_endian = LCD_RGB_DATA_ENDIAN_BIG,
+                .bits_per_pixel = static_cast<uint32_t>(bits_per_pixel),
+                .flags = {
+                    .reset_active_high = flags_reset_active_high,
+                },
+                .vendor_config = nullptr,
+            };
+        }
+
         int reset_gpio_num = -1;                    /*!< Reset GPIO pin number (-1 if unused) */
         int rgb_ele_order = static_cast<int>(LCD_RGB_ELEMENT_ORDER_RGB); /*!< RGB color element order */
         int bits_per_pixel = 16;                    /*!< Color depth in bits per pixel */
@@ -157,6 +186,26 @@ public:
      * @brief Simplified vendor configuration structure
      */
     struct VendorPartialConfig {
+        /**
+         * @brief Convert to the full configuration
+         *
+         * @return Full vendor configuration
+         * @note This function can be evaluated at compile time
+         */
+        constexpr esp_panel_lcd_vendor_config_t toFull() const
+        {
+            return esp_panel_lcd_vendor_config_t{
+                .hor_res = hor_res,
+                .ver_res = ver_res,
+                .init_cmds = init_cmds,
+                .init_cmds_size = static_cast<unsigned int>(init_cmds_size),
+                .flags = {
+                    .mirror_by_cmd = flags_mirror_by_cmd,
+                    .enable_io_multiplex = flags_enable_io_multiplex,
+                },
+            };
+        }
+
         int hor_res = 0;    /*!< Horizontal resolution of the panel (in pixels) */
         int ver_res = 0;    /*!< Vertical resolution of the panel (in pixels) */
         const esp_panel_lcd_vendor_init_cmd_t *init_cmds = nullptr; /*!< Vendor initialization commands */
@@ -383,6 +432,29 @@ public:
      */
     bool configFrameBufferNumber(int num);
 
+    /**
+     * @brief Configure the warm start mode
+     *
+     * When enabled, a marker is kept in RTC retained memory after the panel is initialized. On the next `begin()`
+     * after a software reset or deep-sleep wake-up, if the marker matches the current configuration and the panel
+     * passes a register check, the hardware reset and vendor initialization commands are skipped.
+     *
+     * @param[in] en true: enable, false: disable
+     * @param[in] verify_reg Register address used to check the panel state, defaults to `RDDPM` (0x0A). For the
+     *                       "QSPI" bus, it should be encoded with the read opcode of the controller, like
+     *                       `(0x0B << 24) | (0x0A << 8)`
+     * @param[in] verify_mask Mask applied to the value read from `verify_reg`
+     * @param[in] verify_value Expected value after masking, defaults to the `SLPOUT` bit of `RDDPM`
+     * @return `true` if successful, `false` otherwise
+     * @note This function should be called before `init()`
+     * @note This function is only valid for the "SPI" and "QSPI" bus, and the MISO line should be connected
+     * @note The marker is shared by all LCD devices, only the last initialized one can be warm started
+     */
+    bool configWarmStart(
+        bool en, uint32_t verify_reg = WARM_START_VERIFY_REG_DEFAULT,
+        uint8_t verify_mask = WARM_START_VERIFY_MASK_DEFAULT, uint8_t verify_value = WARM_START_VERIFY_MASK_DEFAULT
+    );
+
     /**
      * @brief Initialize the LCD device
      *
@@ -440,6 +512,64 @@ public:
      */
     bool drawBitmap(int x_start, int y_start, int width, int height, const uint8_t *color_data, int timeout_ms = 0);
 
+    /**
+     * @brief Draw a region of a canvas, expanding it to the coordinate alignment required by the LCD
+     *
+     * The region is adjusted by `getAlignedRegion()`, and the padding pixels are taken from the canvas, so panels with
+     * alignment requirements (e.g. SPD2010, ST77922) always get a valid transfer.
+     *
+     * @param[in] x_start X coordinate of the start point of the region
+     * @param[in] y_start Y coordinate of the start point of the region
+     * @param[in] width Width of the region
+     * @param[in] height Height of the region
+     * @param[in] canvas Pointer of the color data of the canvas, whose top left pixel is at (0, 0) of the LCD
+     * @param[in] canvas_width Width of the canvas in pixels, also used as the line stride
+     * @param[in] canvas_height Height of the canvas in pixels
+     * @param[in] timeout_ms Wait timeout for drawing to finish in milliseconds, default is 0, -1 means wait forever
+     * @return `true` if successful, `false` otherwise (including an empty region after clamping)
+     * @note This function should be called after `begin()`
+     * @note If the lines of the aligned region are contiguous in the canvas (e.g. it spans the whole canvas width),
+     *       the canvas is sent directly. Otherwise, the region is packed into an internal buffer, and this function
+     *       waits for the drawing to finish (forever if `timeout_ms` is 0) before the buffer can be reused
+     */
+    bool drawBitmapAligned(
+        int x_start, int y_start, int width, int height, const uint8_t *canvas, int canvas_width, int canvas_height,
+        int timeout_ms = 0
+    );
+
+    /**
+     * @brief Get the region drawn by `drawBitmapAligned()` for a region of a canvas
+     *
+     * The region is clamped to the canvas and the frame, and rounded outward to `x_coord_align` and `y_coord_align`.
+     * If the rounded end exceeds the limits, it is rounded down instead, so the pixels between the last aligned
+     * coordinate and an unaligned limit are dropped.
+     *
+     * @param[in,out] x_start X coordinate of the start point of the region
+     * @param[in,out] y_start Y coordinate of the start point of the region
+     * @param[in,out] width Width of the region
+     * @param[in,out] height Height of the region
+     * @param[in] canvas_width Width of the canvas in pixels
+     * @param[in] canvas_height Height of the canvas in pixels
+     * @return `true` if successful, `false` if the parameters are invalid or the adjusted region is empty
+     */
+    bool getAlignedRegion(int &x_start, int &y_start, int &width, int &height, int canvas_width, int canvas_height);
+
+    /**
+     * @brief Draw a compressed image (EPI format) generated by `tools/image_converter.py`
+     *
+     * The image is decoded in stripes, and the next stripe is decoded while the previous one is being transmitted.
+     *
+     * @param[in] x_start X coordinate of the start point of the image
+     * @param[in] y_start Y coordinate of the start point of the image
+     * @param[in] image Pointer of the image, can be placed in flash
+     * @param[in] size Size of the image in bytes
+     * @param[in] bg_color Background color in RGB565 to blend the pixels with alpha against, default is black
+     * @return `true` if successful, `false` otherwise
+     * @note This function should be called after `begin()`, and only supports LCDs with 16-bit color depth
+     * @note This function waits for the drawing to finish before returning
+     */
+    bool drawImage(int x_start, int y_start, const uint8_t *image, size_t size, uint16_t bg_color = 0);
+
     /**
      * @brief Mirror the X axis
      *
@@ -590,6 +720,16 @@ public:
         return (_state >= state);
     }
 
+    /**
+     * @brief Check if the panel skipped reset and initialization in the last `begin()`
+     *
+     * @return `true` if warm started, `false` otherwise
+     */
+    bool isWarmStarted() const
+    {
+        return _warm_start.is_started;
+    }
+
     /**
      * @brief Check if LCD function is supported
      *
@@ -894,6 +1034,31 @@ private:
         std::shared_ptr<StaticSemaphore_t> on_draw_bitmap_finish_sem_buffer = nullptr; /*!< Semaphore buffer */
     };
 
+    /**
+     * @brief Warm start configuration and status
+     */
+    struct WarmStart {
+        bool enable = false;                                    /*!< Whether warm start is enabled */
+        bool is_started = false;                                /*!< Whether the last `begin()` was warm started */
+        uint32_t verify_reg = WARM_START_VERIFY_REG_DEFAULT;    /*!< Register used to verify the panel state */
+        uint8_t verify_mask = WARM_START_VERIFY_MASK_DEFAULT;   /*!< Mask of the verify register value */
+        uint8_t verify_value = WARM_START_VERIFY_MASK_DEFAULT;  /*!< Expected verify register value after masking */
+    };
+
+    /**
+     * @brief Calculate the signature of the current configuration for warm start
+     *
+     * @return Signature value
+     */
+    uint32_t getWarmStartSignature();
+
+    /**
+     * @brief Check if the panel can skip reset and initialization
+     *
+     * @return `true` if the panel keeps the state of the last initialization, `false` otherwise
+     */
+    bool checkWarmStart();
+
     /**
      * @brief Get device full configuration
      *
@@ -939,6 +1104,8 @@ private:
     State _state = State::DEINIT;               /*!< Current driver state */
     Transformation _transformation = {};        /*!< Coordinate transformation settings */
     Interruption _interruption = {};            /*!< Interrupt handling */
+    WarmStart _warm_start = {};                 /*!< Warm start configuration and status */
+    utils::vector<uint8_t> _align_buffer;       /*!< Buffer to pack the regions of `drawBitmapAligned()` */
 };
 
 } // namespace esp_panel::drivers
@@ -53,6 +53,8 @@ typedef struct {
     uint8_t colmod_val; // save surrent value of LCD_CMD_COLMOD register
     const esp_panel_lcd_vendor_init_cmd_t *init_cmds;
     uint16_t init_cmds_size;
+    esp_panel_lcd_vendor_tx_cmds_t tx_init_cmds;
+    void *tx_init_cmds_user_ctx;
     struct {
         unsigned int use_qspi_interface: 1;
         unsigned int reset_level: 1;
@@ -112,6 +114,8 @@ esp_err_t esp_lcd_new_panel_axs15231b(const esp_lcd_panel_io_handle_t io, const
     if (panel_dev_config->vendor_config) {
         axs15231b->init_cmds = ((esp_panel_lcd_vendor_config_t *)panel_dev_config->vendor_config)->init_cmds;
         axs15231b->init_cmds_size = ((esp_panel_lcd_vendor_config_t *)panel_dev_config->vendor_config)->init_cmds_size;
+        axs15231b->tx_init_cmds = ((esp_panel_lcd_vendor_config_t *)panel_dev_config->vendor_config)->tx_init_cmds;
+        axs15231b->tx_init_cmds_user_ctx = ((esp_panel_lcd_vendor_config_t *)panel_dev_config->vendor_config)->tx_init_cmds_user_ctx;
         axs15231b->flags.use_qspi_interface = ((esp_panel_lcd_vendor_config_t *)panel_dev_config->vendor_config)->flags.use_qspi_interface;
     }
     axs15231b->base.del = panel_axs15231b_del;
@@ -271,9 +275,9 @@ static esp_err_t panel_axs15231b_init(esp_lcd_panel_t *panel)
         if (is_cmd_overwritten) {
             ESP_LOGW(TAG, "The %02Xh command has been used and will be overwritten by external initialization sequence", init_cmds[i].cmd);
         }
-        ESP_RETURN_ON_ERROR(tx_param(axs15231b, io, init_cmds[i].cmd, init_cmds[i].data, init_cmds[i].data_bytes), TAG, "send command failed");
-        vTaskDelay(pdMS_TO_TICKS(init_cmds[i].delay_ms));
     }
+    ESP_RETURN_ON_ERROR(esp_panel_lcd_vendor_tx_init_cmds(io, init_cmds, init_cmds_size, axs15231b->tx_init_cmds,
+                        axs15231b->tx_init_cmds_user_ctx, axs15231b->flags.use_qspi_interface ? LCD_OPCODE_WRITE_CMD : 0), TAG, "send init commands failed");
     ESP_LOGI(TAG, "send init commands success");
 
     return ESP_OK;
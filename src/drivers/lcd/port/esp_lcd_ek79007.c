@@ -40,6 +40,8 @@ typedef struct {
     uint8_t madctl_val; // save current value of LCD_CMD_MADCTL register
     const esp_panel_lcd_vendor_init_cmd_t *init_cmds;
     uint16_t init_cmds_size;
+    esp_panel_lcd_vendor_tx_cmds_t tx_init_cmds;
+    void *tx_init_cmds_user_ctx;
     uint8_t lane_num;
     struct {
         unsigned int reset_level: 1;
@@ -83,6 +85,8 @@ esp_err_t esp_lcd_new_panel_ek79007(const esp_lcd_panel_io_handle_t io, const es
     ek79007->io = io;
     ek79007->init_cmds = vendor_config->init_cmds;
     ek79007->init_cmds_size = vendor_config->init_cmds_size;
+    ek79007->tx_init_cmds = vendor_config->tx_init_cmds;
+    ek79007->tx_init_cmds_user_ctx = vendor_config->tx_init_cmds_user_ctx;
     ek79007->lane_num = vendor_config->mipi_config.lane_num;
     ek79007->reset_gpio_num = panel_dev_config->reset_gpio_num;
     ek79007->flags.reset_level = panel_dev_config->flags.reset_active_high;
@@ -182,11 +186,9 @@ static esp_err_t panel_ek79007_send_init_cmds(ek79007_panel_t *ek79007)
                          init_cmds[i].cmd);
             }
         }
-
-        // Send command
-        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, init_cmds[i].cmd, init_cmds[i].data, init_cmds[i].data_bytes), TAG, "send command failed");
-        vTaskDelay(pdMS_TO_TICKS(init_cmds[i].delay_ms));
     }
+    ESP_RETURN_ON_ERROR(esp_panel_lcd_vendor_tx_init_cmds(io, init_cmds, init_cmds_size, ek79007->tx_init_cmds,
+                        ek79007->tx_init_cmds_user_ctx, 0), TAG, "send init commands failed");
 
     ESP_LOGD(TAG, "send init commands success");
 
@@ -40,6 +40,8 @@ typedef struct {
     uint8_t colmod_val; // Save current value of LCD_CMD_COLMOD register
     const esp_panel_lcd_vendor_init_cmd_t *init_cmds;
     uint16_t init_cmds_size;
+    esp_panel_lcd_vendor_tx_cmds_t tx_init_cmds;
+    void *tx_init_cmds_user_ctx;
     struct {
         unsigned int mirror_by_cmd: 1;
         unsigned int auto_del_panel_io: 1;
@@ -118,6 +120,8 @@ esp_err_t esp_lcd_new_panel_gc9503(const esp_lcd_panel_io_handle_t io, const esp
     gc9503->io = io;
     gc9503->init_cmds = vendor_config->init_cmds;
     gc9503->init_cmds_size = vendor_config->init_cmds_size;
+    gc9503->tx_init_cmds = vendor_config->tx_init_cmds;
+    gc9503->tx_init_cmds_user_ctx = vendor_config->tx_init_cmds_user_ctx;
     gc9503->reset_gpio_num = panel_dev_config->reset_gpio_num;
     gc9503->flags.reset_level = panel_dev_config->flags.reset_active_high;
     gc9503->flags.auto_del_panel_io = vendor_config->flags.auto_del_panel_io;
@@ -289,11 +293,9 @@ static esp_err_t panel_gc9503_send_init_cmds(gc9503_panel_t *gc9503)
             ESP_LOGW(TAG, "The %02Xh command has been used and will be overwritten by external initialization sequence",
                      init_cmds[i].cmd);
         }
-
-        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, init_cmds[i].cmd, init_cmds[i].data, init_cmds[i].data_bytes),
-                            TAG, "send command failed");
-        vTaskDelay(pdMS_TO_TICKS(init_cmds[i].delay_ms));
     }
+    ESP_RETURN_ON_ERROR(esp_panel_lcd_vendor_tx_init_cmds(io, init_cmds, init_cmds_size, gc9503->tx_init_cmds,
+                        gc9503->tx_init_cmds_user_ctx, 0), TAG, "send init commands failed");
     ESP_LOGD(TAG, "send init commands success");
 
     return ESP_OK;
@@ -50,6 +50,8 @@ typedef struct {
     uint8_t colmod_val; // save current value of LCD_CMD_COLMOD register
     const esp_panel_lcd_vendor_init_cmd_t *init_cmds;
     uint16_t init_cmds_size;
+    esp_panel_lcd_vendor_tx_cmds_t tx_init_cmds;
+    void *tx_init_cmds_user_ctx;
 } gc9a01_panel_t;
 
 esp_err_t esp_lcd_new_panel_gc9a01(const esp_lcd_panel_io_handle_t io, const esp_lcd_panel_dev_config_t *panel_dev_config, esp_lcd_panel_handle_t *ret_panel)
@@ -117,6 +119,8 @@ esp_err_t esp_lcd_new_panel_gc9a01(const esp_lcd_panel_io_handle_t io, const esp
     if (panel_dev_config->vendor_config) {
         gc9a01->init_cmds = ((esp_panel_lcd_vendor_config_t *)panel_dev_config->vendor_config)->init_cmds;
         gc9a01->init_cmds_size = ((esp_panel_lcd_vendor_config_t *)panel_dev_config->vendor_config)->init_cmds_size;
+        gc9a01->tx_init_cmds = ((esp_panel_lcd_vendor_config_t *)panel_dev_config->vendor_config)->tx_init_cmds;
+        gc9a01->tx_init_cmds_user_ctx = ((esp_panel_lcd_vendor_config_t *)panel_dev_config->vendor_config)->tx_init_cmds_user_ctx;
     }
     gc9a01->base.del = panel_gc9a01_del;
     gc9a01->base.reset = panel_gc9a01_reset;
@@ -270,10 +274,9 @@ static esp_err_t panel_gc9a01_init(esp_lcd_panel_t *panel)
         if (is_cmd_overwritten) {
             ESP_LOGW(TAG, "The %02Xh command has been used and will be overwritten by external initialization sequence", init_cmds[i].cmd);
         }
-
-        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, init_cmds[i].cmd, init_cmds[i].data, init_cmds[i].data_bytes), TAG, "send command failed");
-        vTaskDelay(pdMS_TO_TICKS(init_cmds[i].delay_ms));
     }
+    ESP_RETURN_ON_ERROR(esp_panel_lcd_vendor_tx_init_cmds(io, init_cmds, init_cmds_size, gc9a01->tx_init_cmds,
+                        gc9a01->tx_init_cmds_user_ctx, 0), TAG, "send init commands failed");
     ESP_LOGD(TAG, "send init commands success");
 
     return ESP_OK;
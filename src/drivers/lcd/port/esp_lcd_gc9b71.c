@@ -54,6 +54,8 @@ typedef struct {
     uint8_t colmod_val; // save current value of LCD_CMD_COLMOD register
     const esp_panel_lcd_vendor_init_cmd_t *init_cmds;
     uint16_t init_cmds_size;
+    esp_panel_lcd_vendor_tx_cmds_t tx_init_cmds;
+    void *tx_init_cmds_user_ctx;
     struct {
         unsigned int use_qspi_interface: 1;
         unsigned int reset_level: 1;
@@ -117,6 +119,8 @@ esp_err_t esp_lcd_new_panel_gc9b71(const esp_lcd_panel_io_handle_t io, const esp
     if (vendor_config) {
         gc9b71->init_cmds = vendor_config->init_cmds;
         gc9b71->init_cmds_size = vendor_config->init_cmds_size;
+        gc9b71->tx_init_cmds = vendor_config->tx_init_cmds;
+        gc9b71->tx_init_cmds_user_ctx = vendor_config->tx_init_cmds_user_ctx;
         gc9b71->flags.use_qspi_interface = vendor_config->flags.use_qspi_interface;
     }
     gc9b71->flags.reset_level = panel_dev_config->flags.reset_active_high;
@@ -302,11 +306,9 @@ static esp_err_t panel_gc9b71_init(esp_lcd_panel_t *panel)
         if (is_cmd_overwritten) {
             ESP_LOGW(TAG, "The %02Xh command has been used and will be overwritten by external initialization sequence", init_cmds[i].cmd);
         }
-
-        ESP_RETURN_ON_ERROR(tx_param(gc9b71, io, init_cmds[i].cmd, init_cmds[i].data, init_cmds[i].data_bytes), TAG,
-                            "send command failed");
-        vTaskDelay(pdMS_TO_TICKS(init_cmds[i].delay_ms));
     }
+    ESP_RETURN_ON_ERROR(esp_panel_lcd_vendor_tx_init_cmds(io, init_cmds, init_cmds_size, gc9b71->tx_init_cmds,
+                        gc9b71->tx_init_cmds_user_ctx, gc9b71->flags.use_qspi_interface ? LCD_OPCODE_WRITE_CMD : 0), TAG, "send init commands failed");
     ESP_LOGD(TAG, "send init commands success");
 
     return ESP_OK;
@@ -49,6 +49,8 @@ typedef struct {
     uint8_t colmod_val; // save surrent value of LCD_CMD_COLMOD register
     const esp_panel_lcd_vendor_init_cmd_t *init_cmds;
     uint16_t init_cmds_size;
+    esp_panel_lcd_vendor_tx_cmds_t tx_init_cmds;
+    void *tx_init_cmds_user_ctx;
     uint8_t lane_num;
     struct {
         unsigned int reset_level: 1;
@@ -121,6 +123,8 @@ esp_err_t esp_lcd_new_panel_ili9881c(const esp_lcd_panel_io_handle_t io, const e
     ili9881c->io = io;
     ili9881c->init_cmds = vendor_config->init_cmds;
     ili9881c->init_cmds_size = vendor_config->init_cmds_size;
+    ili9881c->tx_init_cmds = vendor_config->tx_init_cmds;
+    ili9881c->tx_init_cmds_user_ctx = vendor_config->tx_init_cmds_user_ctx;
     ili9881c->lane_num = vendor_config->mipi_config.lane_num;
     ili9881c->reset_gpio_num = panel_dev_config->reset_gpio_num;
     ili9881c->flags.reset_level = panel_dev_config->flags.reset_active_high;
@@ -462,16 +466,14 @@ static esp_err_t panel_ili9881c_init(esp_lcd_panel_t *panel)
             }
         }
 
-        // Send command
-        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, init_cmds[i].cmd, init_cmds[i].data, init_cmds[i].data_bytes), TAG, "send command failed");
-        vTaskDelay(pdMS_TO_TICKS(init_cmds[i].delay_ms));
-
         if ((init_cmds[i].cmd == ILI9881C_CMD_CNDBKxSEL) && (((uint8_t *)init_cmds[i].data)[2] == ILI9881C_CMD_BKxSEL_BYTE2_PAGE0)) {
             is_command0_enable = true;
         } else if ((init_cmds[i].cmd == ILI9881C_CMD_CNDBKxSEL) && (((uint8_t *)init_cmds[i].data)[2] != ILI9881C_CMD_BKxSEL_BYTE2_PAGE0)) {
             is_command0_enable = false;
         }
     }
+    ESP_RETURN_ON_ERROR(esp_panel_lcd_vendor_tx_init_cmds(io, init_cmds, init_cmds_size, ili9881c->tx_init_cmds,
+                        ili9881c->tx_init_cmds_user_ctx, 0), TAG, "send init commands failed");
     ESP_LOGD(TAG, "send init commands success");
 
     ESP_RETURN_ON_ERROR(ili9881c->init(panel), TAG, "init MIPI DPI panel failed");
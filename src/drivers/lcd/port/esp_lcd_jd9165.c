@@ -36,6 +36,8 @@ typedef struct {
     uint8_t colmod_val; // save surrent value of LCD_CMD_COLMOD register
     const esp_panel_lcd_vendor_init_cmd_t *init_cmds;
     uint16_t init_cmds_size;
+    esp_panel_lcd_vendor_tx_cmds_t tx_init_cmds;
+    void *tx_init_cmds_user_ctx;
     struct {
         unsigned int reset_level: 1;
     } flags;
@@ -90,6 +92,8 @@ esp_err_t esp_lcd_new_panel_jd9165(const esp_lcd_panel_io_handle_t io, const esp
     jd9165->io = io;
     jd9165->init_cmds = vendor_config->init_cmds;
     jd9165->init_cmds_size = vendor_config->init_cmds_size;
+    jd9165->tx_init_cmds = vendor_config->tx_init_cmds;
+    jd9165->tx_init_cmds_user_ctx = vendor_config->tx_init_cmds_user_ctx;
     jd9165->reset_gpio_num = panel_dev_config->reset_gpio_num;
     jd9165->flags.reset_level = panel_dev_config->flags.reset_active_high;
 
@@ -190,11 +194,9 @@ static esp_err_t panel_jd9165_init(esp_lcd_panel_t *panel)
                          init_cmds[i].cmd);
             }
         }
-
-        // Send command
-        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, init_cmds[i].cmd, init_cmds[i].data, init_cmds[i].data_bytes), TAG, "send command failed");
-        vTaskDelay(pdMS_TO_TICKS(init_cmds[i].delay_ms));
     }
+    ESP_RETURN_ON_ERROR(esp_panel_lcd_vendor_tx_init_cmds(io, init_cmds, init_cmds_size, jd9165->tx_init_cmds,
+                        jd9165->tx_init_cmds_user_ctx, 0), TAG, "send init commands failed");
     ESP_LOGD(TAG, "send init commands success");
 
     ESP_RETURN_ON_ERROR(jd9165->init(panel), TAG, "init MIPI DPI panel failed");
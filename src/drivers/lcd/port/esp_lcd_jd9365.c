@@ -45,6 +45,8 @@ typedef struct {
     uint8_t colmod_val; // save surrent value of LCD_CMD_COLMOD register
     const esp_panel_lcd_vendor_init_cmd_t *init_cmds;
     uint16_t init_cmds_size;
+    esp_panel_lcd_vendor_tx_cmds_t tx_init_cmds;
+    void *tx_init_cmds_user_ctx;
     uint8_t lane_num;
     struct {
         unsigned int reset_level: 1;
@@ -115,6 +117,8 @@ esp_err_t esp_lcd_new_panel_jd9365(const esp_lcd_panel_io_handle_t io, const esp
     jd9365->io = io;
     jd9365->init_cmds = vendor_config->init_cmds;
     jd9365->init_cmds_size = vendor_config->init_cmds_size;
+    jd9365->tx_init_cmds = vendor_config->tx_init_cmds;
+    jd9365->tx_init_cmds_user_ctx = vendor_config->tx_init_cmds_user_ctx;
     jd9365->lane_num = vendor_config->mipi_config.lane_num;
     jd9365->reset_gpio_num = panel_dev_config->reset_gpio_num;
     jd9365->flags.reset_level = panel_dev_config->flags.reset_active_high;
@@ -476,15 +480,13 @@ static esp_err_t panel_jd9365_init(esp_lcd_panel_t *panel)
             }
         }
 
-        // Send command
-        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, init_cmds[i].cmd, init_cmds[i].data, init_cmds[i].data_bytes), TAG, "send command failed");
-        vTaskDelay(pdMS_TO_TICKS(init_cmds[i].delay_ms));
-
         // Check if the current cmd is the "page set" cmd
         if ((init_cmds[i].cmd == JD9365_CMD_PAGE) && (init_cmds[i].data_bytes > 0)) {
             is_user_set = (((uint8_t *)init_cmds[i].data)[0] == JD9365_PAGE_USER);
         }
     }
+    ESP_RETURN_ON_ERROR(esp_panel_lcd_vendor_tx_init_cmds(io, init_cmds, init_cmds_size, jd9365->tx_init_cmds,
+                        jd9365->tx_init_cmds_user_ctx, 0), TAG, "send init commands failed");
     ESP_LOGD(TAG, "send init commands success");
 
     ESP_RETURN_ON_ERROR(jd9365->init(panel), TAG, "init MIPI DPI panel failed");
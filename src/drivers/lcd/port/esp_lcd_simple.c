@@ -36,6 +36,8 @@ typedef struct {
     uint8_t colmod_val; // save current value of LCD_CMD_COLMOD register
     const esp_panel_lcd_vendor_init_cmd_t *init_cmds;
     uint16_t init_cmds_size;
+    esp_panel_lcd_vendor_tx_cmds_t tx_init_cmds;
+    void *tx_init_cmds_user_ctx;
     uint8_t lane_num;
     struct {
         unsigned int reset_level: 1;
@@ -104,6 +106,8 @@ esp_err_t esp_lcd_new_panel_simple(const esp_lcd_panel_io_handle_t io, const esp
     simple->io = io;
     simple->init_cmds = vendor_config->init_cmds;
     simple->init_cmds_size = vendor_config->init_cmds_size;
+    simple->tx_init_cmds = vendor_config->tx_init_cmds;
+    simple->tx_init_cmds_user_ctx = vendor_config->tx_init_cmds_user_ctx;
     simple->lane_num = vendor_config->mipi_config.lane_num;
     simple->reset_gpio_num = panel_dev_config->reset_gpio_num;
     simple->flags.reset_level = panel_dev_config->flags.reset_active_high;
@@ -207,15 +211,9 @@ static esp_err_t panel_simple_init(esp_lcd_panel_t *panel)
                          init_cmds[i].cmd);
             }
         }
-
-        // Send command - but for simple driver, we skip this
-        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, init_cmds[i].cmd, init_cmds[i].data, init_cmds[i].data_bytes), TAG, "send command failed");
-        ESP_LOGI(TAG, "Skipping command 0x%02X for simple driver", init_cmds[i].cmd);
-
-        if (init_cmds[i].delay_ms > 0) {
-            vTaskDelay(pdMS_TO_TICKS(init_cmds[i].delay_ms));
-        }
     }
+    ESP_RETURN_ON_ERROR(esp_panel_lcd_vendor_tx_init_cmds(io, init_cmds, init_cmds_size, simple->tx_init_cmds,
+                        simple->tx_init_cmds_user_ctx, 0), TAG, "send init commands failed");
 
     ESP_LOGI(TAG, "Simple LCD panel init completed - no commands sent");
 
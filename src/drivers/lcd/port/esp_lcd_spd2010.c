@@ -59,6 +59,8 @@ typedef struct {
     uint8_t colmod_val; // save current value of LCD_CMD_COLMOD register
     const esp_panel_lcd_vendor_init_cmd_t *init_cmds;
     uint16_t init_cmds_size;
+    esp_panel_lcd_vendor_tx_cmds_t tx_init_cmds;
+    void *tx_init_cmds_user_ctx;
     struct {
         unsigned int use_qspi_interface: 1;
         unsigned int reset_level: 1;
@@ -122,6 +124,8 @@ esp_err_t esp_lcd_new_panel_spd2010(const esp_lcd_panel_io_handle_t io, const es
     if (vendor_config) {
         spd2010->init_cmds = vendor_config->init_cmds;
         spd2010->init_cmds_size = vendor_config->init_cmds_size;
+        spd2010->tx_init_cmds = vendor_config->tx_init_cmds;
+        spd2010->tx_init_cmds_user_ctx = vendor_config->tx_init_cmds_user_ctx;
         spd2010->flags.use_qspi_interface = vendor_config->flags.use_qspi_interface;
     }
     spd2010->flags.reset_level = panel_dev_config->flags.reset_active_high;
@@ -659,16 +663,13 @@ static esp_err_t panel_spd2010_init(esp_lcd_panel_t *panel)
             }
         }
 
-        // Send command
-        ESP_RETURN_ON_ERROR(tx_param(spd2010, io, init_cmds[i].cmd, init_cmds[i].data, init_cmds[i].data_bytes), TAG,
-                            "send command failed");
-        vTaskDelay(pdMS_TO_TICKS(init_cmds[i].delay_ms));
-
         // Check if the current cmd is the "command set" cmd
         if ((init_cmds[i].cmd == SPD2010_CMD_SET) && (init_cmds[i].data_bytes > 2)) {
             is_user_set = (((uint8_t *)init_cmds[i].data)[2] == SPD2010_CMD_SET_USER);
         }
     }
+    ESP_RETURN_ON_ERROR(esp_panel_lcd_vendor_tx_init_cmds(io, init_cmds, init_cmds_size, spd2010->tx_init_cmds,
+                        spd2010->tx_init_cmds_user_ctx, spd2010->flags.use_qspi_interface ? LCD_OPCODE_WRITE_CMD : 0), TAG, "send init commands failed");
     ESP_LOGD(TAG, "send init commands success");
 
     return ESP_OK;
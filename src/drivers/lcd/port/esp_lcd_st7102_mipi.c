@@ -45,6 +45,8 @@ typedef struct {
     uint8_t colmod_val; // save current value of LCD_CMD_COLMOD register
     const esp_panel_lcd_vendor_init_cmd_t *init_cmds;
     uint16_t init_cmds_size;
+    esp_panel_lcd_vendor_tx_cmds_t tx_init_cmds;
+    void *tx_init_cmds_user_ctx;
     struct {
         unsigned int reset_level: 1;
     } flags;
@@ -104,6 +106,8 @@ esp_err_t esp_lcd_new_panel_st7102_mipi(const esp_lcd_panel_io_handle_t io, cons
     st7102->flags.reset_level = panel_dev_config->flags.reset_active_high;
     st7102->init_cmds = vendor_config->init_cmds;
     st7102->init_cmds_size = vendor_config->init_cmds_size;
+    st7102->tx_init_cmds = vendor_config->tx_init_cmds;
+    st7102->tx_init_cmds_user_ctx = vendor_config->tx_init_cmds_user_ctx;
 
     // Create MIPI DPI panel first
     esp_lcd_panel_handle_t dpi_panel = NULL;
@@ -176,12 +180,9 @@ static esp_err_t panel_st7102_init(esp_lcd_panel_t *panel)
 
     // Send vendor specific initialization commands
     if (st7102->init_cmds && st7102->init_cmds_size > 0) {
-        for (int i = 0; i < st7102->init_cmds_size; i++) {
-            ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(st7102->io, st7102->init_cmds[i].cmd, st7102->init_cmds[i].data, st7102->init_cmds[i].data_bytes), TAG, "send command failed");
-            if (st7102->init_cmds[i].delay_ms > 0) {
-                vTaskDelay(pdMS_TO_TICKS(st7102->init_cmds[i].delay_ms));
-            }
-        }
+        ESP_RETURN_ON_ERROR(esp_panel_lcd_vendor_tx_init_cmds(st7102->io, st7102->init_cmds, st7102->init_cmds_size,
+                            st7102->tx_init_cmds, st7102->tx_init_cmds_user_ctx, 0), TAG,
+                            "send init commands failed");
     }
 
     // Set color mode
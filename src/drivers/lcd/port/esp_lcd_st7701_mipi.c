@@ -47,6 +47,8 @@ typedef struct {
     uint8_t colmod_val; // save surrent value of LCD_CMD_COLMOD register
     const esp_panel_lcd_vendor_init_cmd_t *init_cmds;
     uint16_t init_cmds_size;
+    esp_panel_lcd_vendor_tx_cmds_t tx_init_cmds;
+    void *tx_init_cmds_user_ctx;
     struct {
         unsigned int reset_level: 1;
     } flags;
@@ -104,6 +106,8 @@ esp_err_t esp_lcd_new_panel_st7701_mipi(const esp_lcd_panel_io_handle_t io, cons
     st7701->io = io;
     st7701->init_cmds = vendor_config->init_cmds;
     st7701->init_cmds_size = vendor_config->init_cmds_size;
+    st7701->tx_init_cmds = vendor_config->tx_init_cmds;
+    st7701->tx_init_cmds_user_ctx = vendor_config->tx_init_cmds_user_ctx;
     st7701->reset_gpio_num = panel_dev_config->reset_gpio_num;
     st7701->flags.reset_level = panel_dev_config->flags.reset_active_high;
 
@@ -279,16 +283,13 @@ static esp_err_t panel_st7701_init(esp_lcd_panel_t *panel)
             }
         }
 
-        // Send command
-        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, init_cmds[i].cmd, init_cmds[i].data, init_cmds[i].data_bytes),
-                            TAG, "send command failed");
-        vTaskDelay(pdMS_TO_TICKS(init_cmds[i].delay_ms));
-
         // Check if the current cmd is the command2 disable cmd
         if ((init_cmds[i].cmd == ST7701_CMD_CND2BKxSEL) && (init_cmds[i].data_bytes > 4)) {
             is_command2_disable = !(((uint8_t *)init_cmds[i].data)[4] & ST7701_CMD_CN2_BIT);
         }
     }
+    ESP_RETURN_ON_ERROR(esp_panel_lcd_vendor_tx_init_cmds(io, init_cmds, init_cmds_size, st7701->tx_init_cmds,
+                        st7701->tx_init_cmds_user_ctx, 0), TAG, "send init commands failed");
     ESP_LOGD(TAG, "send init commands success");
 
     ESP_RETURN_ON_ERROR(st7701->init(panel), TAG, "init MIPI DPI panel failed");
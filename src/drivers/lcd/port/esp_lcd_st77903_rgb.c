@@ -45,6 +45,8 @@ typedef struct {
     uint16_t ver_res;
     const esp_panel_lcd_vendor_init_cmd_t *init_cmds;
     uint16_t init_cmds_size;
+    esp_panel_lcd_vendor_tx_cmds_t tx_init_cmds;
+    void *tx_init_cmds_user_ctx;
     struct {
         unsigned int enable_io_multiplex: 1;
         unsigned int display_on_off_use_cmd: 1;
@@ -125,6 +127,8 @@ esp_err_t esp_lcd_new_panel_st77903_rgb(const esp_lcd_panel_io_handle_t io, cons
     st77903->reset_gpio_num = panel_dev_config->reset_gpio_num;
     st77903->init_cmds = vendor_config->init_cmds;
     st77903->init_cmds_size = vendor_config->init_cmds_size;
+    st77903->tx_init_cmds = vendor_config->tx_init_cmds;
+    st77903->tx_init_cmds_user_ctx = vendor_config->tx_init_cmds_user_ctx;
     st77903->hor_res = vendor_config->rgb_config->timings.h_res;
     st77903->ver_res = vendor_config->rgb_config->timings.v_res;
     st77903->flags.enable_io_multiplex = vendor_config->flags.enable_io_multiplex;
@@ -273,6 +277,7 @@ static esp_err_t panel_st77903_rgb_send_init_cmds(st77903_panel_t *st77903)
 
     bool is_cmd_overwritten = false;
     bool is_cmd_conflicting = false;
+    int run_start = 0;
     for (int i = 0; i < init_cmds_size; i++) {
         // Check if the command has been used or conflicts with the internal
         switch (init_cmds[i].cmd) {
@@ -304,13 +309,16 @@ static esp_err_t panel_st77903_rgb_send_init_cmds(st77903_panel_t *st77903)
                      init_cmds[i].cmd);
         }
 
-        // Only send the command if it is not conflicted
-        if (!is_cmd_conflicting) {
-            ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, init_cmds[i].cmd, init_cmds[i].data, init_cmds[i].data_bytes),
-                                TAG, "send command failed");
-            vTaskDelay(pdMS_TO_TICKS(init_cmds[i].delay_ms));
+        // Only send the commands which are not conflicted, the ones before the conflicted command are sent together
+        if (is_cmd_conflicting) {
+            ESP_RETURN_ON_ERROR(esp_panel_lcd_vendor_tx_init_cmds(io, init_cmds + run_start, i - run_start,
+                                st77903->tx_init_cmds, st77903->tx_init_cmds_user_ctx, 0), TAG,
+                                "send init commands failed");
+            run_start = i + 1;
         }
     }
+    ESP_RETURN_ON_ERROR(esp_panel_lcd_vendor_tx_init_cmds(io, init_cmds + run_start, init_cmds_size - run_start,
+                        st77903->tx_init_cmds, st77903->tx_init_cmds_user_ctx, 0), TAG, "send init commands failed");
     ESP_LOGD(TAG, "send init commands success");
 
     return ESP_OK;
@@ -50,6 +50,8 @@ typedef struct {
     uint8_t colmod_val; // save surrent value of LCD_CMD_COLMOD register
     const esp_panel_lcd_vendor_init_cmd_t *init_cmds;
     uint16_t init_cmds_size;
+    esp_panel_lcd_vendor_tx_cmds_t tx_init_cmds;
+    void *tx_init_cmds_user_ctx;
     struct {
         unsigned int use_qspi_interface: 1;
         unsigned int reset_level: 1;
@@ -111,6 +113,8 @@ esp_err_t esp_lcd_new_panel_st77922_general(const esp_lcd_panel_io_handle_t io,
     if (vendor_config) {
         st77922->init_cmds = vendor_config->init_cmds;
         st77922->init_cmds_size = vendor_config->init_cmds_size;
+        st77922->tx_init_cmds = vendor_config->tx_init_cmds;
+        st77922->tx_init_cmds_user_ctx = vendor_config->tx_init_cmds_user_ctx;
         st77922->flags.use_qspi_interface = vendor_config->flags.use_qspi_interface;
     }
     st77922->base.del = panel_st77922_del;
@@ -303,10 +307,6 @@ static esp_err_t panel_st77922_init(esp_lcd_panel_t *panel)
             }
         }
 
-        // Send command
-        ESP_RETURN_ON_ERROR(tx_param(st77922, io, init_cmds[i].cmd, init_cmds[i].data, init_cmds[i].data_bytes), TAG, "send command failed");
-        vTaskDelay(pdMS_TO_TICKS(init_cmds[i].delay_ms));
-
         // Check if the current cmd is the command1 enable cmd
         if ((init_cmds[i].cmd == ST77922_PAGE_CMD2 || init_cmds[i].cmd == ST77922_PAGE_CMD3) && init_cmds[i].data_bytes > 0) {
             is_command1_enable = false;
@@ -314,6 +314,8 @@ static esp_err_t panel_st77922_init(esp_lcd_panel_t *panel)
             is_command1_enable = true;
         }
     }
+    ESP_RETURN_ON_ERROR(esp_panel_lcd_vendor_tx_init_cmds(io, init_cmds, init_cmds_size, st77922->tx_init_cmds,
+                        st77922->tx_init_cmds_user_ctx, st77922->flags.use_qspi_interface ? LCD_OPCODE_WRITE_CMD : 0), TAG, "send init commands failed");
     ESP_LOGD(TAG, "send init commands success");
 
     return ESP_OK;
@@ -34,6 +34,8 @@ typedef struct {
     uint8_t colmod_val; // save surrent value of LCD_CMD_COLMOD register
     const esp_panel_lcd_vendor_init_cmd_t *init_cmds;
     uint16_t init_cmds_size;
+    esp_panel_lcd_vendor_tx_cmds_t tx_init_cmds;
+    void *tx_init_cmds_user_ctx;
     struct {
         unsigned int reset_level: 1;
     } flags;
@@ -101,6 +103,8 @@ esp_err_t esp_lcd_new_panel_st77922_mipi(const esp_lcd_panel_io_handle_t io, con
     st77922->io = io;
     st77922->init_cmds = vendor_config->init_cmds;
     st77922->init_cmds_size = vendor_config->init_cmds_size;
+    st77922->tx_init_cmds = vendor_config->tx_init_cmds;
+    st77922->tx_init_cmds_user_ctx = vendor_config->tx_init_cmds_user_ctx;
     st77922->reset_gpio_num = panel_dev_config->reset_gpio_num;
     st77922->flags.reset_level = panel_dev_config->flags.reset_active_high;
 
@@ -274,10 +278,6 @@ static esp_err_t panel_st77922_init(esp_lcd_panel_t *panel)
             }
         }
 
-        // Send command
-        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, init_cmds[i].cmd, init_cmds[i].data, init_cmds[i].data_bytes), TAG, "send command failed");
-        vTaskDelay(pdMS_TO_TICKS(init_cmds[i].delay_ms));
-
         // Check if the current cmd is the command1 enable cmd
         if ((init_cmds[i].cmd == ST77922_PAGE_CMD2 || init_cmds[i].cmd == ST77922_PAGE_CMD3) && init_cmds[i].data_bytes > 0) {
             is_command1_enable = false;
@@ -285,6 +285,8 @@ static esp_err_t panel_st77922_init(esp_lcd_panel_t *panel)
             is_command1_enable = true;
         }
     }
+    ESP_RETURN_ON_ERROR(esp_panel_lcd_vendor_tx_init_cmds(io, init_cmds, init_cmds_size, st77922->tx_init_cmds,
+                        st77922->tx_init_cmds_user_ctx, 0), TAG, "send init commands failed");
     ESP_LOGD(TAG, "send init commands success");
 
     ESP_RETURN_ON_ERROR(st77922->init(panel), TAG, "init MIPI DPI panel failed");
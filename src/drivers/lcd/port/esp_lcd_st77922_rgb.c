@@ -34,6 +34,8 @@ typedef struct {
     uint8_t colmod_val; // Save current value of LCD_CMD_COLMOD register
     const esp_panel_lcd_vendor_init_cmd_t *init_cmds;
     uint16_t init_cmds_size;
+    esp_panel_lcd_vendor_tx_cmds_t tx_init_cmds;
+    void *tx_init_cmds_user_ctx;
     struct {
         unsigned int mirror_by_cmd: 1;
         unsigned int enable_io_multiplex: 1;
@@ -111,6 +113,8 @@ esp_err_t esp_lcd_new_panel_st77922_rgb(const esp_lcd_panel_io_handle_t io, cons
     st77922->io = io;
     st77922->init_cmds = vendor_config->init_cmds;
     st77922->init_cmds_size = vendor_config->init_cmds_size;
+    st77922->tx_init_cmds = vendor_config->tx_init_cmds;
+    st77922->tx_init_cmds_user_ctx = vendor_config->tx_init_cmds_user_ctx;
     st77922->reset_gpio_num = panel_dev_config->reset_gpio_num;
     st77922->flags.mirror_by_cmd = vendor_config->flags.mirror_by_cmd;
     st77922->flags.display_on_off_use_cmd = (vendor_config->rgb_config->disp_gpio_num >= 0) ? 0 : 1;
@@ -290,11 +294,6 @@ static esp_err_t panel_st77922_send_init_cmds(st77922_panel_t *st77922)
             }
         }
 
-        // Send command
-        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, init_cmds[i].cmd, init_cmds[i].data, init_cmds[i].data_bytes),
-                            TAG, "send command failed");
-        vTaskDelay(pdMS_TO_TICKS(init_cmds[i].delay_ms));
-
         // Check if the current cmd is the command1 enable cmd
         if ((init_cmds[i].cmd == ST77922_PAGE_CMD2 || init_cmds[i].cmd == ST77922_PAGE_CMD3) && init_cmds[i].data_bytes > 0) {
             is_command1_enable = false;
@@ -302,6 +301,8 @@ static esp_err_t panel_st77922_send_init_cmds(st77922_panel_t *st77922)
             is_command1_enable = true;
         }
     }
+    ESP_RETURN_ON_ERROR(esp_panel_lcd_vendor_tx_init_cmds(io, init_cmds, init_cmds_size, st77922->tx_init_cmds,
+                        st77922->tx_init_cmds_user_ctx, 0), TAG, "send init commands failed");
     ESP_LOGD(TAG, "send init commands success");
 
     return ESP_OK;
@@ -0,0 +1,40 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_check.h"
+
+#include "esp_panel_lcd_vendor_types.h"
+
+static const char *TAG = "lcd_vendor";
+
+esp_err_t esp_panel_lcd_vendor_tx_init_cmds(esp_lcd_panel_io_handle_t io, const esp_panel_lcd_vendor_init_cmd_t *cmds,
+        size_t cmds_num, esp_panel_lcd_vendor_tx_cmds_t tx_cmds, void *user_ctx,
+        int qspi_opcode)
+{
+    ESP_RETURN_ON_FALSE((cmds != NULL) || (cmds_num == 0), ESP_ERR_INVALID_ARG, TAG, "invalid commands");
+
+    if (tx_cmds != NULL) {
+        return tx_cmds(cmds, cmds_num, user_ctx);
+    }
+
+    ESP_RETURN_ON_FALSE(io != NULL, ESP_ERR_INVALID_ARG, TAG, "invalid panel io");
+    for (size_t i = 0; i < cmds_num; i++) {
+        int lcd_cmd = cmds[i].cmd;
+        if (qspi_opcode != 0) {
+            lcd_cmd = (qspi_opcode << 24) | ((lcd_cmd & 0xff) << 8);
+        }
+        ESP_RETURN_ON_ERROR(esp_lcd_panel_io_tx_param(io, lcd_cmd, cmds[i].data, cmds[i].data_bytes), TAG,
+                            "send command(0x%02x) failed", cmds[i].cmd);
+        // Only sleep when required, the commands without delay are sent back to back
+        if (cmds[i].delay_ms > 0) {
+            vTaskDelay(pdMS_TO_TICKS(cmds[i].delay_ms));
+        }
+    }
+
+    return ESP_OK;
+}
@@ -6,8 +6,11 @@
 
 #pragma once
 
+#include <stddef.h>
 #include "sdkconfig.h"
 #include "soc/soc_caps.h"
+#include "esp_err.h"
+#include "esp_lcd_panel_io.h"
 #if SOC_LCD_RGB_SUPPORTED
 #include "esp_lcd_panel_rgb.h"
 #endif
@@ -34,6 +37,22 @@ typedef struct {
 typedef esp_panel_lcd_vendor_init_cmd_t esp_lcd_panel_vendor_init_cmd_t
 __attribute__((deprecated("Deprecated. Please use `esp_panel_lcd_vendor_init_cmd_t` instead.")));
 
+/**
+ * @brief Function to write the initialization commands in a batch, see `esp_panel_lcd_vendor_config_t`
+ *
+ * The function should write the commands in order and sleep after the commands with a non-zero delay.
+ *
+ * @param[in] cmds     Array of commands, their `cmd` are the plain LCD commands (e.g. without the QSPI opcode)
+ * @param[in] cmds_num Number of commands
+ * @param[in] user_ctx User context, same as `tx_init_cmds_user_ctx`
+ *
+ * @return
+ *      - ESP_OK: Success
+ *      - Others: Fail
+ */
+typedef esp_err_t (*esp_panel_lcd_vendor_tx_cmds_t)(const esp_panel_lcd_vendor_init_cmd_t *cmds, size_t cmds_num,
+        void *user_ctx);
+
 /**
  * @brief LCD panel vendor configuration.
  *
@@ -78,6 +97,11 @@ typedef struct {
         unsigned int use_rgb_interface: 1;          /*!< Set to 1 if use RGB interface */
         unsigned int use_mipi_interface: 1;         /*!< Set to 1 if using MIPI interface */
     } flags;
+
+    esp_panel_lcd_vendor_tx_cmds_t tx_init_cmds;    /*!< Function to write the initialization commands in a batch.
+                                                     *   Set to NULL to write them one by one through the panel IO.
+                                                     */
+    void *tx_init_cmds_user_ctx;                    /*!< User context of `tx_init_cmds` */
 } esp_panel_lcd_vendor_config_t;
 
 typedef esp_panel_lcd_vendor_config_t esp_lcd_panel_vendor_config_t
@@ -101,6 +125,30 @@ __attribute__((deprecated("Deprecated. Please use `esp_panel_lcd_vendor_config_t
  */
 #define ESP_PANEL_LCD_CMD_WITH_NONE_PARAM(delay_ms, command) {command, (uint8_t []){ 0x00 }, 0, delay_ms}
 
+/**
+ * @brief Write the vendor initialization commands
+ *
+ * The commands are written by `tx_cmds` if it is not NULL. Otherwise, they are written one by one by
+ * `esp_lcd_panel_io_tx_param()` without yielding between them, and the task only sleeps after the commands with a
+ * non-zero delay.
+ *
+ * @param[in] io          LCD panel IO handle
+ * @param[in] cmds        Array of commands
+ * @param[in] cmds_num    Number of commands
+ * @param[in] tx_cmds     Function to write the commands in a batch, set to NULL if not used
+ * @param[in] user_ctx    User context of `tx_cmds`
+ * @param[in] qspi_opcode Write opcode of the QSPI interface, which encodes the commands as `opcode << 24 | cmd << 8`
+ *                        when writing through the panel IO. Set to 0 for the other interfaces
+ *
+ * @return
+ *      - ESP_OK:              Success
+ *      - ESP_ERR_INVALID_ARG: Invalid argument
+ *      - Others:              Fail
+ */
+esp_err_t esp_panel_lcd_vendor_tx_init_cmds(esp_lcd_panel_io_handle_t io, const esp_panel_lcd_vendor_init_cmd_t *cmds,
+        size_t cmds_num, esp_panel_lcd_vendor_tx_cmds_t tx_cmds, void *user_ctx,
+        int qspi_opcode);
+
 #ifdef __cplusplus
 }
 #endif
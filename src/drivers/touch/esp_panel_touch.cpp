@@ -41,26 +41,7 @@ void Touch::Config::convertPartialToFull()
 #if ESP_UTILS_CONF_LOG_LEVEL == ESP_UTILS_LOG_LEVEL_DEBUG
         printDeviceConfig();
 #endif // ESP_UTILS_LOG_LEVEL_DEBUG
-        auto &config = std::get<DevicePartialConfig>(device);
-        device = esp_lcd_touch_config_t{
-            .x_max = static_cast<uint16_t>(config.x_max),
-            .y_max = static_cast<uint16_t>(config.y_max),
-            .rst_gpio_num = static_cast<gpio_num_t>(config.rst_gpio_num),
-            .int_gpio_num = static_cast<gpio_num_t>(config.int_gpio_num),
-            .levels = {
-                .reset = static_cast<unsigned int>(config.levels_reset),
-                .interrupt = static_cast<unsigned int>(config.levels_interrupt),
-            },
-            .flags = {
-                .swap_xy = 0,
-                .mirror_x = 0,
-                .mirror_y = 0,
-            },
-            .process_coordinates = nullptr,
-            .interrupt_callback = nullptr,
-            .user_data = nullptr,
-            .driver_data = nullptr,
-        };
+        device = std::get<DevicePartialConfig>(device).toFull();
     }
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
@@ -208,8 +189,8 @@ bool Touch::del()
     }
 
     _transformation = {};
-    _points.clear();
-    _buttons.clear();
+    _points_num = 0;
+    _buttons_num = 0;
     _interruption = nullptr;
 
     setState(State::DEINIT);
@@ -323,14 +304,9 @@ int Touch::getPoints(TouchPoint points[], uint8_t num)
     ESP_UTILS_LOGD("Param: points(@%p), num(%d)", points, num);
     ESP_UTILS_CHECK_FALSE_RETURN((num == 0) || (points != nullptr), -1, "Invalid points or num");
 
-    int i = 0;
     std::unique_lock lock(_resource_mutex);
-    for (auto &point : _points) {
-        if (i >= num) {
-            break;
-        }
-        points[i++] = point;
-    }
+    int i = std::min(static_cast<int>(num), _points_num);
+    std::copy_n(_points.begin(), i, points);
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 
@@ -345,7 +321,7 @@ bool Touch::getPoints(utils::vector<TouchPoint> &points)
 
     ESP_UTILS_LOGD("Param: points(@%p)", &points);
     std::unique_lock lock(_resource_mutex);
-    points = _points;
+    points.assign(_points.begin(), _points.begin() + _points_num);
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 
@@ -360,7 +336,7 @@ bool Touch::getPoints(std::vector<TouchPoint> &points)
 
     ESP_UTILS_LOGD("Param: points(@%p)", &points);
     std::unique_lock lock(_resource_mutex);
-    points = std::vector<TouchPoint>(_points.begin(), _points.end());
+    points.assign(_points.begin(), _points.begin() + _points_num);
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 
@@ -377,13 +353,8 @@ int Touch::getButtons(TouchButton buttons[], uint8_t num)
     ESP_UTILS_CHECK_FALSE_RETURN((num == 0) || (buttons != nullptr), false, "Invalid buttons or num");
 
     std::unique_lock lock(_resource_mutex);
-    int i = 0;
-    for (auto &button : _buttons) {
-        if (i >= num) {
-            break;
-        }
-        buttons[i++] = button;
-    }
+    int i = std::min(static_cast<int>(num), _buttons_num);
+    std::copy_n(_buttons.begin(), i, buttons);
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 
@@ -398,7 +369,7 @@ bool Touch::getButtons(utils::vector<TouchButton> &buttons)
 
     ESP_UTILS_LOGD("Param: buttons(%p)", &buttons);
     std::unique_lock lock(_resource_mutex);
-    buttons = _buttons;
+    buttons.assign(_buttons.begin(), _buttons.begin() + _buttons_num);
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 
@@ -413,7 +384,7 @@ bool Touch::getButtons(std::vector<TouchButton> &buttons)
 
     ESP_UTILS_LOGD("Param: buttons(@%p)", &buttons);
     std::unique_lock lock(_resource_mutex);
-    buttons = std::vector<TouchButton>(_buttons.begin(), _buttons.end());
+    buttons.assign(_buttons.begin(), _buttons.begin() + _buttons_num);
 
     ESP_UTILS_LOG_TRACE_EXIT_WITH_THIS();
 
@@ -431,7 +402,8 @@ int Touch::getButtonState(int index)
     TouchButton ret_button = {};
 
     std::unique_lock lock(_resource_mutex);
-    for (auto &button : _buttons) {
+    for (int i = 0; i < _buttons_num; i++) {
+        auto &button = _buttons[i];
         if (button.first == index) {
             is_found = true;
             ret_button = button;
@@ -569,12 +541,10 @@ bool Touch::readRawDataPoints(int points_num)
     }
     ESP_UTILS_LOGD("Try to read %d points", points_num);
 
-    utils::vector<uint16_t> x(points_num);
-    utils::vector<uint16_t> y(points_num);
-    utils::vector<uint16_t> strength(points_num);
-    auto x_buf = x.data();
-    auto y_buf = y.data();
-    auto strength_buf = strength.data();
+    // Use stack buffers to keep the read path free of heap allocation
+    uint16_t x_buf[POINTS_MAX_NUM] = {};
+    uint16_t y_buf[POINTS_MAX_NUM] = {};
+    uint16_t strength_buf[POINTS_MAX_NUM] = {};
     uint8_t ret_points_num = 0;
 
     // Get the point coordinates from the raw data
@@ -583,15 +553,15 @@ bool Touch::readRawDataPoints(int points_num)
 
     // Update the points
     std::unique_lock lock(_resource_mutex);
-    _points.clear();
-    for (int i = 0; i < ret_points_num; i++) {
-        _points.emplace_back(static_cast<int>(x_buf[i]), static_cast<int>(y_buf[i]), static_cast<int>(strength_buf[i]));
+    _points_num = std::min(static_cast<int>(ret_points_num), points_num);
+    for (int i = 0; i < _points_num; i++) {
+        _points[i] = TouchPoint(static_cast<int>(x_buf[i]), static_cast<int>(y_buf[i]), static_cast<int>(strength_buf[i]));
     }
     lock.unlock();
 
 #if ESP_UTILS_CONF_LOG_LEVEL == ESP_UTILS_LOG_LEVEL_DEBUG
-    for (auto &point : _points) {
-        point.print();
+    for (int i = 0; i < _points_num; i++) {
+        _points[i].print();
     }
 #endif // ESP_UTILS_LOG_LEVEL_DEBUG
 
@@ -624,7 +594,8 @@ bool Touch::readRawDataButtons(int buttons_num)
     ESP_UTILS_LOGD("Try to read %d buttons", buttons_num);
 
     // Get the buttons state from the raw data
-    utils::vector<TouchButton> buttons;
+    std::array<TouchButton, BUTTONS_MAX_NUM> buttons = {};
+    int ret_buttons_num = 0;
     uint8_t button_state = 0;
 
     for (int i = 0; i < buttons_num; i++) {
@@ -637,16 +608,17 @@ bool Touch::readRawDataButtons(int buttons_num)
         }
         ESP_UTILS_CHECK_ERROR_RETURN(ret, false, "Get button(%d) state failed", i);
 #endif
-        buttons.emplace_back(i, button_state);
+        buttons[ret_buttons_num++] = TouchButton(i, button_state);
     }
 
     std::unique_lock lock(_resource_mutex);
-    _buttons = std::move(buttons);
+    _buttons = buttons;
+    _buttons_num = ret_buttons_num;
     lock.unlock();
 
 #if ESP_UTILS_CONF_LOG_LEVEL == ESP_UTILS_LOG_LEVEL_DEBUG
-    for (auto &button : _buttons) {
-        ESP_UTILS_LOGD("Button(%d): %d", button.first, button.second);
+    for (int i = 0; i < _buttons_num; i++) {
+        ESP_UTILS_LOGD("Button(%d): %d", _buttons[i].first, _buttons[i].second);
     }
 #endif // ESP_UTILS_LOG_LEVEL_DEBUG
 
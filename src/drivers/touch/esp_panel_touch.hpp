@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <thread>
 #include <variant>
 #include <vector>
@@ -114,6 +116,35 @@ public:
      * @brief Simplified partial configuration structure for touch device
      */
     struct DevicePartialConfig {
+        /**
+         * @brief Convert to the full configuration
+         *
+         * @return Full device configuration
+         * @note This function can be evaluated at compile time
+         */
+        constexpr esp_lcd_touch_config_t toFull() const
+        {
+            return esp_lcd_touch_config_t{
+                .x_max = static_cast<uint16_t>(x_max),
+                .y_max = static_cast<uint16_t>(y_max),
+                .rst_gpio_num = static_cast<gpio_num_t>(rst_gpio_num),
+                .int_gpio_num = static_cast<gpio_num_t>(int_gpio_num),
+                .levels = {
+                    .reset = static_cast<unsigned int>(levels_reset),
+                    .interrupt = static_cast<unsigned int>(levels_interrupt),
+                },
+                .flags = {
+                    .swap_xy = 0,
+                    .mirror_x = 0,
+                    .mirror_y = 0,
+                },
+                .process_coordinates = nullptr,
+                .interrupt_callback = nullptr,
+                .user_data = nullptr,
+                .driver_data = nullptr,
+            };
+        }
+
         int x_max = 0;              /*!< Maximum X coordinate value */
         int y_max = 0;              /*!< Maximum Y coordinate value */
         int rst_gpio_num = -1;      /*!< Reset GPIO pin number (-1 if unused) */
@@ -354,6 +385,21 @@ public:
      */
     bool getPoints(std::vector<TouchPoint> &points);
 
+    /**
+     * @brief Get touch points from raw data into a fixed-capacity buffer, without heap allocation
+     *
+     * @param[out] points Array to store touch points
+     * @return Number of points read if successful, -1 on failure
+     *
+     * @note This function should be called after `begin()`
+     * @note Call this function immediately after `readRawData()`
+     */
+    template <size_t N>
+    int getPoints(std::array<TouchPoint, N> &points)
+    {
+        return getPoints(points.data(), static_cast<uint8_t>(std::min<size_t>(N, UINT8_MAX)));
+    }
+
     /**
      * @brief Get touch buttons from raw data
      *
@@ -426,6 +472,23 @@ public:
      */
     bool readPoints(utils::vector<TouchPoint> &points, int timeout_ms);
 
+    /**
+     * @brief Read touch points with timeout into a fixed-capacity buffer, without heap allocation
+     *
+     * @param[out] points Array to store touch points
+     * @param[in] timeout_ms Timeout in milliseconds for interrupt wait
+     * @return Number of points read if successful, -1 on failure
+     *
+     * @note This function should be called after `begin()`
+     * @note This combines `readRawData()` and `getPoints()`
+     * @note Set timeout_ms to -1 for infinite wait
+     */
+    template <size_t N>
+    int readPoints(std::array<TouchPoint, N> &points, int timeout_ms)
+    {
+        return readPoints(points.data(), static_cast<int>(N), timeout_ms);
+    }
+
     /**
      * @brief Read touch buttons with timeout
      *
@@ -471,7 +534,7 @@ public:
      */
     void resetPoints()
     {
-        _points.clear();
+        _points_num = 0;
     }
 
     /**
@@ -479,7 +542,7 @@ public:
      */
     void resetButtons()
     {
-        _buttons.clear();
+        _buttons_num = 0;
     }
 
     /**
@@ -715,8 +778,10 @@ private:
     Transformation _transformation = {};                    /*!< Coordinate transformation settings */
     // note: Use std::mutex instead of std::shared_mutex (IDF-12208)
     std::mutex _resource_mutex;                             /*!< Resource access mutex */
-    utils::vector<TouchPoint> _points;                      /*!< Touch points buffer */
-    utils::vector<TouchButton> _buttons;                    /*!< Touch buttons buffer */
+    std::array<TouchPoint, POINTS_MAX_NUM> _points = {};    /*!< Touch points buffer */
+    int _points_num = 0;                                    /*!< Number of valid touch points */
+    std::array<TouchButton, BUTTONS_MAX_NUM> _buttons = {}; /*!< Touch buttons buffer */
+    int _buttons_num = 0;                                   /*!< Number of valid touch buttons */
     std::shared_ptr<Interruption> _interruption = nullptr;  /*!< Interrupt handling */
 };
 
@@ -12,6 +12,7 @@
 
 /* Utils */
 #include "utils/esp_panel_utils_cxx.hpp"
+#include "utils/esp_panel_utils_image.hpp"
 
 /* Drivers */
 #include "drivers/bus/esp_panel_bus_factory.hpp"
@@ -22,3 +23,4 @@
 
 /* Board */
 #include "board/esp_panel_board.hpp"
+#include "board/esp_panel_board_probe.hpp"
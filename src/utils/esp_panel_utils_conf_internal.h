@@ -0,0 +1,67 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+// *INDENT-OFF*
+
+#include "drivers/esp_panel_drivers_conf_internal.h"
+
+#ifndef ESP_PANEL_DRIVERS_INCLUDE_INSIDE
+    /**
+     * Define the memory pool configuration
+     *
+     */
+    #ifndef ESP_PANEL_DRIVERS_MEM_POOL_ENABLE
+        #ifdef CONFIG_ESP_PANEL_DRIVERS_MEM_POOL_ENABLE
+            #define ESP_PANEL_DRIVERS_MEM_POOL_ENABLE CONFIG_ESP_PANEL_DRIVERS_MEM_POOL_ENABLE
+        #else
+            #define ESP_PANEL_DRIVERS_MEM_POOL_ENABLE (0)
+        #endif
+    #endif
+
+    #if ESP_PANEL_DRIVERS_MEM_POOL_ENABLE
+        #ifndef ESP_PANEL_DRIVERS_MEM_POOL_BLOCK_SIZE
+            #ifdef CONFIG_ESP_PANEL_DRIVERS_MEM_POOL_BLOCK_SIZE
+                #define ESP_PANEL_DRIVERS_MEM_POOL_BLOCK_SIZE CONFIG_ESP_PANEL_DRIVERS_MEM_POOL_BLOCK_SIZE
+            #else
+                #define ESP_PANEL_DRIVERS_MEM_POOL_BLOCK_SIZE (64)
+            #endif
+        #endif
+
+        #ifndef ESP_PANEL_DRIVERS_MEM_POOL_INTERNAL_BLOCK_NUM
+            #ifdef CONFIG_ESP_PANEL_DRIVERS_MEM_POOL_INTERNAL_BLOCK_NUM
+                #define ESP_PANEL_DRIVERS_MEM_POOL_INTERNAL_BLOCK_NUM CONFIG_ESP_PANEL_DRIVERS_MEM_POOL_INTERNAL_BLOCK_NUM
+            #else
+                #define ESP_PANEL_DRIVERS_MEM_POOL_INTERNAL_BLOCK_NUM (32)
+            #endif
+        #endif
+
+        #ifndef ESP_PANEL_DRIVERS_MEM_POOL_PSRAM_BLOCK_NUM
+            #ifdef CONFIG_ESP_PANEL_DRIVERS_MEM_POOL_PSRAM_BLOCK_NUM
+                #define ESP_PANEL_DRIVERS_MEM_POOL_PSRAM_BLOCK_NUM CONFIG_ESP_PANEL_DRIVERS_MEM_POOL_PSRAM_BLOCK_NUM
+            #else
+                #define ESP_PANEL_DRIVERS_MEM_POOL_PSRAM_BLOCK_NUM (0)
+            #endif
+        #endif
+    #endif // ESP_PANEL_DRIVERS_MEM_POOL_ENABLE
+#endif // ESP_PANEL_DRIVERS_INCLUDE_INSIDE
+
+/* Fall back to the default values if the configuration file is old */
+#ifndef ESP_PANEL_DRIVERS_MEM_POOL_ENABLE
+    #define ESP_PANEL_DRIVERS_MEM_POOL_ENABLE (0)
+#endif
+#ifndef ESP_PANEL_DRIVERS_MEM_POOL_BLOCK_SIZE
+    #define ESP_PANEL_DRIVERS_MEM_POOL_BLOCK_SIZE (64)
+#endif
+#ifndef ESP_PANEL_DRIVERS_MEM_POOL_INTERNAL_BLOCK_NUM
+    #define ESP_PANEL_DRIVERS_MEM_POOL_INTERNAL_BLOCK_NUM (32)
+#endif
+#ifndef ESP_PANEL_DRIVERS_MEM_POOL_PSRAM_BLOCK_NUM
+    #define ESP_PANEL_DRIVERS_MEM_POOL_PSRAM_BLOCK_NUM (0)
+#endif
+
+// *INDENT-ON*
@@ -5,6 +5,7 @@
  */
 #pragma once
 
+#include "esp_panel_utils_deque.hpp"
 #include "esp_panel_utils_map.hpp"
 #include "esp_panel_utils_memory.hpp"
 #include "esp_panel_utils_string.hpp"
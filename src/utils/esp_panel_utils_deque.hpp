@@ -0,0 +1,17 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <deque>
+#include "esp_lib_utils.h"
+#include "esp_panel_utils_pool.hpp"
+
+namespace esp_panel::utils {
+
+template <typename T>
+using deque = std::deque<T, MemoryAllocator<T>>;
+
+} // namespace esp_panel::utils
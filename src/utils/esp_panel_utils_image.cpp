@@ -0,0 +1,184 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <algorithm>
+#include <cstring>
+#include "esp_panel_utils_image.hpp"
+
+namespace esp_panel::utils {
+
+/**
+ * Layout of the header (little-endian):
+ *
+ *  - [0, 3]: Magic `EPI` and version
+ *  - [4, 5]: Width
+ *  - [6, 7]: Height
+ *  - [8]: Color format
+ *  - [9, 11]: Reserved
+ *  - [12, 15]: Size of the encoded data
+ *
+ * Operations of the encoded data, the cache index of a pixel is `(r * 3 + g * 5 + b * 7 + a * 11) % 64`:
+ *
+ *  - `0b00xxxxxx`: Pixel from the cache
+ *  - `0b01rrggbb`: Difference of each channel to the previous pixel, biased by 2
+ *  - `0b10gggggg, 0brrrrbbbb`: Green difference biased by 32, red and blue differences minus half of it, biased by 8
+ *  - `0b11xxxxxx`: Repeat the previous pixel `x + 1` times (1 ~ 62)
+ *  - `0xfe, color[2]`: Raw color, alpha unchanged
+ *  - `0xff, color[2], alpha`: Raw color and alpha
+ */
+namespace {
+
+constexpr uint8_t MAGIC[] = {'E', 'P', 'I', 1};
+constexpr uint8_t OP_INDEX = 0x00;
+constexpr uint8_t OP_DIFF = 0x40;
+constexpr uint8_t OP_LUMA = 0x80;
+constexpr uint8_t OP_RUN = 0xc0;
+constexpr uint8_t OP_RGB = 0xfe;
+constexpr uint8_t OP_RGBA = 0xff;
+constexpr uint8_t OP_MASK = 0xc0;
+
+inline int getCacheIndex(uint16_t color, uint8_t alpha)
+{
+    return ((color >> 11) * 3 + ((color >> 5) & 0x3f) * 5 + (color & 0x1f) * 7 + alpha * 11) & 0x3f;
+}
+
+inline uint16_t makeColor(int r, int g, int b)
+{
+    return ((r & 0x1f) << 11) | ((g & 0x3f) << 5) | (b & 0x1f);
+}
+
+} // namespace
+
+bool ImageDecoder::parseHeader(const uint8_t *image, size_t size, Header &header)
+{
+    if ((image == nullptr) || (size < HEADER_SIZE) || (memcmp(image, MAGIC, sizeof(MAGIC)) != 0)) {
+        return false;
+    }
+
+    header.width = image[4] | (image[5] << 8);
+    header.height = image[6] | (image[7] << 8);
+    header.color_format = static_cast<ColorFormat>(image[8]);
+    header.data_size = image[12] | (image[13] << 8) | (image[14] << 16) | (static_cast<uint32_t>(image[15]) << 24);
+
+    return (header.color_format < ColorFormat::MAX) && (header.data_size <= size - HEADER_SIZE);
+}
+
+bool ImageDecoder::begin(const uint8_t *image, size_t size)
+{
+    if (!parseHeader(image, size, _header)) {
+        _data = nullptr;
+        return false;
+    }
+
+    _data = image + HEADER_SIZE;
+    _data_end = _data + _header.data_size;
+    _decoded_lines = 0;
+    _run = 0;
+    _color = 0;
+    _alpha = 0xff;
+    _output = getOutputColor();
+    memset(_cache_color, 0, sizeof(_cache_color));
+    memset(_cache_alpha, 0, sizeof(_cache_alpha));
+
+    return true;
+}
+
+int ImageDecoder::decodeLines(uint16_t *buffer, int lines)
+{
+    if ((_data == nullptr) || (buffer == nullptr) || (lines < 0)) {
+        return -1;
+    }
+
+    lines = std::min(lines, _header.height - _decoded_lines);
+    uint16_t *out = buffer;
+    uint16_t *out_end = buffer + lines * _header.width;
+    bool has_alpha = (_header.color_format == ColorFormat::RGB565A8);
+
+    while (out < out_end) {
+        if (_run > 0) {
+            int num = std::min(_run, static_cast<int>(out_end - out));
+            std::fill_n(out, num, _output);
+            out += num;
+            _run -= num;
+            continue;
+        }
+
+        if (_data >= _data_end) {
+            return -1;
+        }
+        uint8_t op = *_data++;
+        if (op == OP_RGB) {
+            if (_data_end - _data < 2) {
+                return -1;
+            }
+            _color = _data[0] | (_data[1] << 8);
+            _data += 2;
+        } else if (op == OP_RGBA) {
+            if (!has_alpha || (_data_end - _data < 3)) {
+                return -1;
+            }
+            _color = _data[0] | (_data[1] << 8);
+            _alpha = _data[2];
+            _data += 3;
+        } else {
+            switch (op & OP_MASK) {
+            case OP_INDEX:
+                _color = _cache_color[op];
+                _alpha = _cache_alpha[op];
+                break;
+            case OP_DIFF:
+                _color = makeColor(
+                             (_color >> 11) + ((op >> 4) & 0x03) - 2, ((_color >> 5) & 0x3f) + ((op >> 2) & 0x03) - 2,
+                             (_color & 0x1f) + (op & 0x03) - 2
+                         );
+                break;
+            case OP_LUMA: {
+                if (_data >= _data_end) {
+                    return -1;
+                }
+                int dg = (op & 0x3f) - 32;
+                int dg_half = (op & 0x3f) / 2 - 16;
+                int dr = dg_half + (*_data >> 4) - 8;
+                int db = dg_half + (*_data & 0x0f) - 8;
+                _data++;
+                _color = makeColor((_color >> 11) + dr, ((_color >> 5) & 0x3f) + dg, (_color & 0x1f) + db);
+                break;
+            }
+            default:
+                _run = (op & 0x3f) + 1;
+                continue;
+            }
+        }
+
+        int index = getCacheIndex(_color, _alpha);
+        _cache_color[index] = _color;
+        _cache_alpha[index] = _alpha;
+        _output = getOutputColor();
+        *out++ = _output;
+    }
+    _decoded_lines += lines;
+
+    return lines;
+}
+
+uint16_t ImageDecoder::getOutputColor() const
+{
+    uint16_t color = _color;
+    if (_alpha == 0) {
+        color = _bg_color;
+    } else if (_alpha != 0xff) {
+        // Blend the 3 channels at once with 5-bit alpha, each channel has enough headroom after spreading
+        uint32_t fg = (color | (color << 16)) & 0x07e0f81f;
+        uint32_t bg = (_bg_color | (_bg_color << 16)) & 0x07e0f81f;
+        uint32_t alpha = (_alpha + 4) >> 3;
+        uint32_t result = (bg + (((fg - bg) * alpha) >> 5)) & 0x07e0f81f;
+        color = static_cast<uint16_t>(result | (result >> 16));
+    }
+
+    return _swap_bytes ? static_cast<uint16_t>((color >> 8) | (color << 8)) : color;
+}
+
+} // namespace esp_panel::utils
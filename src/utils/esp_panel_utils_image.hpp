@@ -0,0 +1,141 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esp_panel::utils {
+
+/**
+ * @brief Streaming decoder of the compressed image format (EPI) generated by `tools/image_converter.py`
+ *
+ * EPI is a QOI-style format working on RGB565 pixels, with an optional 8-bit alpha channel. The image is decoded
+ * line by line into a caller-supplied buffer, so it can be drawn in stripes without decoding the whole image.
+ * Pixels with alpha are blended against a background color while decoding.
+ *
+ * @note This class has no dependency on ESP-IDF, so it can also be built on the host for benchmarking
+ */
+class ImageDecoder {
+public:
+    static constexpr size_t HEADER_SIZE = 16;
+
+    /**
+     * @brief Color format enumeration of the image
+     */
+    enum class ColorFormat : uint8_t {
+        RGB565 = 0,     /*!< 16-bit color */
+        RGB565A8,       /*!< 16-bit color with 8-bit alpha */
+        MAX,
+    };
+
+    /**
+     * @brief Image header structure
+     */
+    struct Header {
+        uint16_t width = 0;                             /*!< Image width in pixels */
+        uint16_t height = 0;                            /*!< Image height in pixels */
+        ColorFormat color_format = ColorFormat::RGB565; /*!< Color format of the image */
+        uint32_t data_size = 0;                         /*!< Size of the encoded data after the header in bytes */
+    };
+
+    /**
+     * @brief Parse the header of an image
+     *
+     * @param[in] image Pointer of the image
+     * @param[in] size Size of the image in bytes
+     * @param[out] header Header of the image
+     * @return `true` if successful, `false` otherwise
+     */
+    static bool parseHeader(const uint8_t *image, size_t size, Header &header);
+
+    /**
+     * @brief Start decoding an image
+     *
+     * @param[in] image Pointer of the image, should be valid until the decoding is finished
+     * @param[in] size Size of the image in bytes
+     * @return `true` if successful, `false` otherwise
+     */
+    bool begin(const uint8_t *image, size_t size);
+
+    /**
+     * @brief Set the background color to blend the pixels with alpha against
+     *
+     * @param[in] color Background color in RGB565
+     */
+    void setBackgroundColor(uint16_t color)
+    {
+        _bg_color = color;
+    }
+
+    /**
+     * @brief Set whether to swap the bytes of the output pixels
+     *
+     * @param[in] en Whether to swap, should be `true` for the LCDs which receive RGB565 in the big-endian order
+     *               (usually SPI/QSPI LCDs)
+     */
+    void setSwapBytes(bool en)
+    {
+        _swap_bytes = en;
+    }
+
+    /**
+     * @brief Decode the next lines of the image
+     *
+     * @param[out] buffer Buffer of the decoded RGB565 pixels, must hold at least `lines * width` pixels
+     * @param[in] lines Number of lines to decode, clamped to the remaining lines
+     * @return Number of decoded lines, or `-1` if the data is corrupted
+     */
+    int decodeLines(uint16_t *buffer, int lines);
+
+    /**
+     * @brief Get the header of the image being decoded
+     *
+     * @return Header of the image
+     */
+    const Header &getHeader() const
+    {
+        return _header;
+    }
+
+    /**
+     * @brief Get the number of decoded lines
+     *
+     * @return Number of decoded lines
+     */
+    int getDecodedLines() const
+    {
+        return _decoded_lines;
+    }
+
+    /**
+     * @brief Check if all lines of the image are decoded
+     *
+     * @return `true` if finished, `false` otherwise
+     */
+    bool isFinished() const
+    {
+        return (_data != nullptr) && (_decoded_lines >= _header.height);
+    }
+
+private:
+    uint16_t getOutputColor() const;
+
+    Header _header = {};
+    const uint8_t *_data = nullptr;
+    const uint8_t *_data_end = nullptr;
+    int _decoded_lines = 0;
+    int _run = 0;
+    uint16_t _color = 0;
+    uint8_t _alpha = 0xff;
+    uint16_t _output = 0;
+    uint16_t _cache_color[64] = {};
+    uint8_t _cache_alpha[64] = {};
+    uint16_t _bg_color = 0;
+    bool _swap_bytes = false;
+};
+
+} // namespace esp_panel::utils
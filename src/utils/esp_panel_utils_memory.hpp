@@ -7,14 +7,15 @@
 
 #include <memory>
 #include "esp_lib_utils.h"
+#include "esp_panel_utils_pool.hpp"
 
 namespace esp_panel::utils {
 
 template <typename T, typename... Args>
 std::shared_ptr<T> make_shared(Args &&... args)
 {
-    return std::allocate_shared<T, esp_utils::GeneralMemoryAllocator<T>>(
-               esp_utils::GeneralMemoryAllocator<T>(), std::forward<Args>(args)...
+    return std::allocate_shared<T, MemoryAllocator<T>>(
+               MemoryAllocator<T>(), std::forward<Args>(args)...
            );
 }
 
@@ -0,0 +1,216 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "freertos/FreeRTOS.h"
+#include "esp_heap_caps.h"
+#include "esp_panel_utils_log.h"
+#include "esp_panel_utils_pool.hpp"
+
+namespace esp_panel::utils {
+
+#if ESP_PANEL_DRIVERS_MEM_POOL_ENABLE
+static_assert(
+    (ESP_PANEL_DRIVERS_MEM_POOL_BLOCK_SIZE >= sizeof(void *)) &&
+    (ESP_PANEL_DRIVERS_MEM_POOL_BLOCK_SIZE % alignof(std::max_align_t) == 0),
+    "`ESP_PANEL_DRIVERS_MEM_POOL_BLOCK_SIZE` must be a multiple of the maximum alignment"
+);
+
+namespace {
+
+struct FreeBlock {
+    FreeBlock *next;
+};
+
+struct Arena {
+    uint8_t *begin = nullptr;
+    uint8_t *end = nullptr;
+    FreeBlock *free_list = nullptr;
+    size_t block_num = 0;
+    size_t used_num = 0;
+    size_t high_water_num = 0;
+    size_t alloc_count = 0;
+    bool is_init_tried = false;
+};
+
+struct TierInfo {
+    size_t block_num;
+    uint32_t caps;
+};
+
+constexpr TierInfo TIER_INFOS[static_cast<int>(MemoryPool::Tier::MAX)] = {
+    {ESP_PANEL_DRIVERS_MEM_POOL_INTERNAL_BLOCK_NUM, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT},
+    {ESP_PANEL_DRIVERS_MEM_POOL_PSRAM_BLOCK_NUM, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT},
+};
+
+Arena arenas[static_cast<int>(MemoryPool::Tier::MAX)];
+size_t fallback_count = 0;
+portMUX_TYPE pool_lock = portMUX_INITIALIZER_UNLOCKED;
+
+void initArena(int tier)
+{
+    auto &arena = arenas[tier];
+    auto &info = TIER_INFOS[tier];
+
+    portENTER_CRITICAL(&pool_lock);
+    bool need_init = !arena.is_init_tried;
+    arena.is_init_tried = true;
+    portEXIT_CRITICAL(&pool_lock);
+
+    if (!need_init || (info.block_num == 0)) {
+        return;
+    }
+
+    // The heap can't be called in a critical section, so allocate the arena first and then publish it
+    size_t arena_size = info.block_num * ESP_PANEL_DRIVERS_MEM_POOL_BLOCK_SIZE;
+    uint8_t *buffer = static_cast<uint8_t *>(heap_caps_aligned_alloc(alignof(std::max_align_t), arena_size, info.caps));
+    if (buffer == nullptr) {
+        ESP_UTILS_LOGW(
+            "Allocate arena(%d bytes) for tier(%d) failed, use general allocator", static_cast<int>(arena_size), tier
+        );
+        return;
+    }
+
+    FreeBlock *free_list = nullptr;
+    for (int i = info.block_num - 1; i >= 0; i--) {
+        auto block = reinterpret_cast<FreeBlock *>(buffer + i * ESP_PANEL_DRIVERS_MEM_POOL_BLOCK_SIZE);
+        block->next = free_list;
+        free_list = block;
+    }
+
+    portENTER_CRITICAL(&pool_lock);
+    arena.begin = buffer;
+    arena.end = buffer + arena_size;
+    arena.free_list = free_list;
+    arena.block_num = info.block_num;
+    portEXIT_CRITICAL(&pool_lock);
+}
+
+} // namespace
+
+void *MemoryPool::allocate(size_t size)
+{
+    if (size <= ESP_PANEL_DRIVERS_MEM_POOL_BLOCK_SIZE) {
+        for (int tier = 0; tier < static_cast<int>(Tier::MAX); tier++) {
+            auto &arena = arenas[tier];
+            if (!arena.is_init_tried) {
+                initArena(tier);
+            }
+
+            void *ptr = nullptr;
+            portENTER_CRITICAL(&pool_lock);
+            if (arena.free_list != nullptr) {
+                ptr = arena.free_list;
+                arena.free_list = arena.free_list->next;
+                arena.used_num++;
+                arena.alloc_count++;
+                if (arena.used_num > arena.high_water_num) {
+                    arena.high_water_num = arena.used_num;
+                }
+            }
+            portEXIT_CRITICAL(&pool_lock);
+
+            if (ptr != nullptr) {
+                return ptr;
+            }
+        }
+    }
+
+    portENTER_CRITICAL(&pool_lock);
+    fallback_count++;
+    portEXIT_CRITICAL(&pool_lock);
+
+    return esp_utils_mem_gen_malloc(size);
+}
+
+void MemoryPool::deallocate(void *ptr)
+{
+    if (ptr == nullptr) {
+        return;
+    }
+
+    auto addr = static_cast<uint8_t *>(ptr);
+    for (auto &arena : arenas) {
+        if ((addr >= arena.begin) && (addr < arena.end)) {
+            portENTER_CRITICAL(&pool_lock);
+            auto block = static_cast<FreeBlock *>(ptr);
+            block->next = arena.free_list;
+            arena.free_list = block;
+            arena.used_num--;
+            portEXIT_CRITICAL(&pool_lock);
+
+            return;
+        }
+    }
+
+    esp_utils_mem_gen_free(ptr);
+}
+
+bool MemoryPool::getStats(Tier tier, Stats &stats)
+{
+    ESP_UTILS_CHECK_FALSE_RETURN(tier < Tier::MAX, false, "Invalid tier(%d)", static_cast<int>(tier));
+
+    auto &arena = arenas[static_cast<int>(tier)];
+    portENTER_CRITICAL(&pool_lock);
+    stats = {
+        .block_size = ESP_PANEL_DRIVERS_MEM_POOL_BLOCK_SIZE,
+        .block_num = arena.block_num,
+        .used_num = arena.used_num,
+        .high_water_num = arena.high_water_num,
+        .alloc_count = arena.alloc_count,
+    };
+    portEXIT_CRITICAL(&pool_lock);
+
+    return true;
+}
+
+size_t MemoryPool::getFallbackCount()
+{
+    return fallback_count;
+}
+#else
+void *MemoryPool::allocate(size_t size)
+{
+    return esp_utils_mem_gen_malloc(size);
+}
+
+void MemoryPool::deallocate(void *ptr)
+{
+    esp_utils_mem_gen_free(ptr);
+}
+
+bool MemoryPool::getStats(Tier tier, Stats &stats)
+{
+    ESP_UTILS_CHECK_FALSE_RETURN(tier < Tier::MAX, false, "Invalid tier(%d)", static_cast<int>(tier));
+
+    stats = {};
+
+    return true;
+}
+
+size_t MemoryPool::getFallbackCount()
+{
+    return 0;
+}
+#endif // ESP_PANEL_DRIVERS_MEM_POOL_ENABLE
+
+void MemoryPool::printStats()
+{
+    static const char *tier_names[static_cast<int>(Tier::MAX)] = {"Internal", "PSRAM"};
+
+    ESP_UTILS_LOGI("Memory pool statistics:");
+    for (int tier = 0; tier < static_cast<int>(Tier::MAX); tier++) {
+        Stats stats;
+        getStats(static_cast<Tier>(tier), stats);
+        ESP_UTILS_LOGI(
+            "\t%s: block(%d bytes), used(%d/%d), high water(%d), allocations(%d)", tier_names[tier],
+            static_cast<int>(stats.block_size), static_cast<int>(stats.used_num), static_cast<int>(stats.block_num),
+            static_cast<int>(stats.high_water_num), static_cast<int>(stats.alloc_count)
+        );
+    }
+    ESP_UTILS_LOGI("\tFallback allocations: %d", static_cast<int>(getFallbackCount()));
+}
+
+} // namespace esp_panel::utils
@@ -0,0 +1,147 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <utility>
+#include "esp_lib_utils.h"
+#include "esp_panel_utils_conf_internal.h"
+
+namespace esp_panel::utils {
+
+/**
+ * @brief Fixed-block memory pool for small, frequently allocated objects
+ *
+ * The pool has two tiers, internal RAM and PSRAM, each one an arena of `ESP_PANEL_DRIVERS_MEM_POOL_BLOCK_SIZE` byte
+ * blocks. Requests are served from the internal tier first, then from the PSRAM tier, and fall back to the general
+ * allocator when they are larger than a block or both tiers are exhausted. Arenas are allocated once on first use and
+ * never released, so the pool doesn't fragment the heap on long-running devices.
+ */
+class MemoryPool {
+public:
+    /**
+     * @brief Memory tier enumeration
+     */
+    enum class Tier : uint8_t {
+        INTERNAL = 0,   /*!< Internal RAM tier */
+        PSRAM,          /*!< PSRAM tier */
+        MAX,
+    };
+
+    /**
+     * @brief Statistics structure of a tier
+     */
+    struct Stats {
+        size_t block_size = 0;          /*!< Size of each block in bytes */
+        size_t block_num = 0;           /*!< Total number of blocks, 0 if the arena is not allocated */
+        size_t used_num = 0;            /*!< Number of blocks in use */
+        size_t high_water_num = 0;      /*!< Maximum number of blocks in use since startup */
+        size_t alloc_count = 0;         /*!< Number of allocations served by this tier */
+    };
+
+    /**
+     * @brief Allocate memory from the pool, fall back to the general allocator if the pool can't serve it
+     *
+     * @param[in] size Size in bytes
+     * @return Pointer to the memory, or `nullptr` if failed
+     */
+    static void *allocate(size_t size);
+
+    /**
+     * @brief Release memory allocated by `allocate()`
+     *
+     * @param[in] ptr Pointer to the memory
+     */
+    static void deallocate(void *ptr);
+
+    /**
+     * @brief Get the statistics of a tier
+     *
+     * @param[in] tier Memory tier
+     * @param[out] stats Statistics of the tier
+     * @return `true` if successful, `false` otherwise
+     */
+    static bool getStats(Tier tier, Stats &stats);
+
+    /**
+     * @brief Get the number of allocations which fell back to the general allocator
+     *
+     * @return Number of fallback allocations
+     */
+    static size_t getFallbackCount();
+
+    /**
+     * @brief Print the statistics of all tiers
+     */
+    static void printStats();
+};
+
+/**
+ * @brief Allocator backed by `MemoryPool`, compatible with `esp_utils::GeneralMemoryAllocator`
+ */
+template <typename T>
+struct PoolMemoryAllocator {
+    using value_type = T;
+
+    PoolMemoryAllocator() = default;
+
+    template <typename U>
+    PoolMemoryAllocator(const PoolMemoryAllocator<U> &) {}
+
+    T *allocate(std::size_t n)
+    {
+        if (n == 0) {
+            return nullptr;
+        }
+        void *ptr = MemoryPool::allocate(n * sizeof(T));
+#if CONFIG_COMPILER_CXX_EXCEPTIONS
+        if (ptr == nullptr) {
+            throw std::bad_alloc();
+        }
+#endif
+        return static_cast<T *>(ptr);
+    }
+
+    void deallocate(T *p, std::size_t n)
+    {
+        MemoryPool::deallocate(p);
+    }
+
+    template <typename U, typename... Args>
+    void construct(U *p, Args &&... args)
+    {
+        new (p) U(std::forward<Args>(args)...);
+    }
+
+    template <typename U>
+    void destroy(U *p)
+    {
+        p->~U();
+    }
+};
+
+template <typename T, typename U>
+bool operator==(const PoolMemoryAllocator<T> &, const PoolMemoryAllocator<U> &)
+{
+    return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const PoolMemoryAllocator<T> &, const PoolMemoryAllocator<U> &)
+{
+    return false;
+}
+
+#if ESP_PANEL_DRIVERS_MEM_POOL_ENABLE
+template <typename T>
+using MemoryAllocator = PoolMemoryAllocator<T>;
+#else
+template <typename T>
+using MemoryAllocator = esp_utils::GeneralMemoryAllocator<T>;
+#endif
+
+} // namespace esp_panel::utils
@@ -7,10 +7,11 @@
 
 #include <vector>
 #include "esp_lib_utils.h"
+#include "esp_panel_utils_pool.hpp"
 
 namespace esp_panel::utils {
 
 template <typename T>
-using vector = std::vector<T, esp_utils::GeneralMemoryAllocator<T>>;
+using vector = std::vector<T, MemoryAllocator<T>>;
 
 } // namespace esp_panel::utils
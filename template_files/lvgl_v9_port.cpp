@@ -0,0 +1,636 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+
+#include "freertos/FreeRTOS.h"
+
+#include "esp_timer.h"
+#undef ESP_UTILS_LOG_TAG
+#define ESP_UTILS_LOG_TAG "LvPort"
+#include "esp_lib_utils.h"
+#include "lvgl_v9_port.h"
+
+using namespace esp_panel::drivers;
+
+#define LVGL_PORT_BUFFER_NUM_MAX                (2)
+
+static SemaphoreHandle_t lvgl_mux = nullptr;                  // LVGL mutex
+static SemaphoreHandle_t lvgl_event_sem = nullptr;            // Wake up the LVGL task when an event occurs
+static TaskHandle_t lvgl_task_handle = nullptr;
+static lv_indev_t *lvgl_touch_indev = nullptr;
+static volatile bool lvgl_touch_event_pending = false;
+static volatile bool lvgl_invalidate_pending = false;
+static void *lvgl_buf[LVGL_PORT_BUFFER_NUM_MAX] = {};
+
+/**
+ * The task notification of the LVGL task is already used to wait for the LCD refresh finish in the avoid tearing
+ * mode, so use a binary semaphore to wake up the task instead.
+ */
+static void lvgl_port_wake_up(void)
+{
+    if (lvgl_event_sem != nullptr) {
+        xSemaphoreGive(lvgl_event_sem);
+    }
+}
+
+IRAM_ATTR static bool lvgl_port_wake_up_from_isr(void)
+{
+    BaseType_t need_yield = pdFALSE;
+
+    if (lvgl_event_sem != nullptr) {
+        xSemaphoreGiveFromISR(lvgl_event_sem, &need_yield);
+    }
+
+    return (need_yield == pdTRUE);
+}
+
+static uint32_t tick_get_callback(void)
+{
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+#if LVGL_PORT_AVOID_TEAR
+#if LVGL_PORT_ROTATION_DEGREE != 0
+#if LVGL_PORT_ROTATION_DEGREE == 90
+#define LVGL_PORT_DISPLAY_ROTATION              (LV_DISPLAY_ROTATION_90)
+#elif LVGL_PORT_ROTATION_DEGREE == 180
+#define LVGL_PORT_DISPLAY_ROTATION              (LV_DISPLAY_ROTATION_180)
+#else
+#define LVGL_PORT_DISPLAY_ROTATION              (LV_DISPLAY_ROTATION_270)
+#endif
+
+/**
+ * LVGL renders into the third frame buffer, and the port rotates the flushed areas into the two frame buffers used
+ * for display. Each of them keeps the areas that changed since it was last displayed, so only the next one is
+ * synchronized before switching.
+ */
+#define LVGL_PORT_DIRTY_HISTORY_SIZE            (LV_INV_BUF_SIZE)
+
+typedef struct {
+    uint16_t num;
+    lv_area_t areas[LVGL_PORT_DIRTY_HISTORY_SIZE];
+} lv_port_dirty_history_t;
+
+static void *lvgl_port_lcd_fbs[2] = {};
+static int lvgl_port_lcd_next_index = 1;
+static lv_port_dirty_history_t dirty_history[2];
+
+/**
+ * @brief Add an area to the dirty history of a frame buffer
+ *
+ * @note If the history is full, the area is merged into the one whose union grows the least.
+ */
+static void flush_history_add(lv_port_dirty_history_t *history, const lv_area_t *area)
+{
+    /* Skip the area if it is already covered, and drop the ones covered by it */
+    uint16_t num = 0;
+    for (int i = 0; i < history->num; i++) {
+        if (lv_area_is_in(area, &history->areas[i], 0)) {
+            return;
+        }
+        if (!lv_area_is_in(&history->areas[i], area, 0)) {
+            history->areas[num++] = history->areas[i];
+        }
+    }
+    history->num = num;
+
+    if (history->num < LVGL_PORT_DIRTY_HISTORY_SIZE) {
+        history->areas[history->num++] = *area;
+        return;
+    }
+
+    int merge_index = 0;
+    uint32_t merge_growth = UINT32_MAX;
+    lv_area_t merge_area;
+    for (int i = 0; i < history->num; i++) {
+        lv_area_join(&merge_area, &history->areas[i], area);
+        uint32_t growth = lv_area_get_size(&merge_area) - lv_area_get_size(&history->areas[i]);
+        if (growth < merge_growth) {
+            merge_growth = growth;
+            merge_index = i;
+        }
+    }
+    lv_area_join(&history->areas[merge_index], &history->areas[merge_index], area);
+}
+
+/**
+ * @brief Rotate the dirty history from the LVGL buffer to a frame buffer and clear it
+ */
+static void flush_history_copy(lv_display_t *disp, void *dst, const uint8_t *src, lv_port_dirty_history_t *history)
+{
+    lv_color_format_t cf = lv_display_get_color_format(disp);
+    uint32_t px_size = lv_color_format_get_size(cf);
+    uint32_t src_stride = lv_draw_buf_width_to_stride(lv_display_get_horizontal_resolution(disp), cf);
+    uint32_t dst_stride = lv_display_get_physical_horizontal_resolution(disp) * px_size;
+
+    for (int i = 0; i < history->num; i++) {
+        const lv_area_t *area = &history->areas[i];
+        lv_area_t rotated_area = *area;
+        lv_display_rotate_area(disp, &rotated_area);
+
+        lv_draw_sw_rotate(
+            src + area->y1 * src_stride + area->x1 * px_size,
+            (uint8_t *)dst + rotated_area.y1 * dst_stride + rotated_area.x1 * px_size,
+            lv_area_get_width(area), lv_area_get_height(area), src_stride, dst_stride, LVGL_PORT_DISPLAY_ROTATION, cf
+        );
+    }
+    history->num = 0;
+}
+
+static void flush_callback(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
+{
+    LCD *lcd = (LCD *)lv_display_get_user_data(disp);
+
+    /* Record the flushed area for both frame buffers */
+    flush_history_add(&dirty_history[0], area);
+    flush_history_add(&dirty_history[1], area);
+
+    /* Action after last area refresh */
+    if (lv_display_flush_is_last(disp)) {
+        /* Rotate and copy the areas which changed since `next_fb` was last displayed */
+        int next_index = lvgl_port_lcd_next_index;
+        void *next_fb = lvgl_port_lcd_fbs[next_index];
+        lvgl_port_lcd_next_index = !next_index;
+        flush_history_copy(disp, next_fb, px_map, &dirty_history[next_index]);
+
+        /* Switch the current LCD frame buffer to `next_fb` */
+        lcd->switchFrameBufferTo(next_fb);
+
+        /* Waiting for the current frame buffer to complete transmission */
+        ulTaskNotifyValueClear(NULL, ULONG_MAX);
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    }
+
+    lv_display_flush_ready(disp);
+}
+
+#elif LVGL_PORT_FULL_REFRESH && LVGL_PORT_DISP_BUFFER_NUM == 3
+
+/**
+ * LVGL swaps between its two draw buffers after each flush, so the data of the draw buffer which is not flushed is
+ * replaced with the frame buffer which is neither being scanned nor waiting to be scanned.
+ */
+static lv_draw_buf_t lvgl_draw_bufs[2];
+static void *lvgl_port_lcd_last_buf = NULL;
+static void *lvgl_port_lcd_next_buf = NULL;
+static void *lvgl_port_flush_next_buf = NULL;
+
+static void flush_callback(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
+{
+    LCD *lcd = (LCD *)lv_display_get_user_data(disp);
+
+    lv_draw_buf_t *render_buf = (lvgl_draw_bufs[0].data == px_map) ? &lvgl_draw_bufs[1] : &lvgl_draw_bufs[0];
+    render_buf->data = (uint8_t *)lvgl_port_flush_next_buf;
+    render_buf->unaligned_data = lvgl_port_flush_next_buf;
+    lvgl_port_flush_next_buf = px_map;
+
+    /* Switch the current LCD frame buffer to `px_map` */
+    lcd->switchFrameBufferTo(px_map);
+
+    lvgl_port_lcd_next_buf = px_map;
+
+    lv_display_flush_ready(disp);
+}
+
+#else
+
+static void flush_callback(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
+{
+    LCD *lcd = (LCD *)lv_display_get_user_data(disp);
+
+    /* Action after last area refresh */
+    if (lv_display_flush_is_last(disp)) {
+        /* Switch the current LCD frame buffer to `px_map` */
+        lcd->switchFrameBufferTo(px_map);
+
+        /* Waiting for the last frame buffer to complete transmission */
+        ulTaskNotifyValueClear(NULL, ULONG_MAX);
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    }
+
+    lv_display_flush_ready(disp);
+}
+#endif /* LVGL_PORT_ROTATION_DEGREE */
+
+IRAM_ATTR bool onLcdVsyncCallback(void *user_data)
+{
+    BaseType_t need_yield = pdFALSE;
+#if LVGL_PORT_FULL_REFRESH && (LVGL_PORT_DISP_BUFFER_NUM == 3) && (LVGL_PORT_ROTATION_DEGREE == 0)
+    if (lvgl_port_lcd_next_buf != lvgl_port_lcd_last_buf) {
+        lvgl_port_flush_next_buf = lvgl_port_lcd_last_buf;
+        lvgl_port_lcd_last_buf = lvgl_port_lcd_next_buf;
+    }
+#else
+    TaskHandle_t task_handle = (TaskHandle_t)user_data;
+    // Notify that the current LCD frame buffer has been transmitted
+    xTaskNotifyFromISR(task_handle, ULONG_MAX, eNoAction, &need_yield);
+#endif
+    return (need_yield == pdTRUE);
+}
+
+#else
+
+static void *lvgl_rotate_buf = nullptr;
+static bool lvgl_hw_rotate = false;
+
+static void flush_callback(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
+{
+    LCD *lcd = (LCD *)lv_display_get_user_data(disp);
+    lv_area_t flush_area = *area;
+
+#if LVGL_PORT_COLOR_16_SWAP
+    lv_draw_sw_rgb565_swap(px_map, lv_area_get_size(area));
+#endif
+
+    /* Rotate the area by software if the LCD can't swap and mirror the axes */
+    lv_display_rotation_t rotation = lv_display_get_rotation(disp);
+    if (!lvgl_hw_rotate && (rotation != LV_DISPLAY_ROTATION_0) && (lvgl_rotate_buf != nullptr)) {
+        lv_color_format_t cf = lv_display_get_color_format(disp);
+        lv_display_rotate_area(disp, &flush_area);
+        lv_draw_sw_rotate(
+            px_map, lvgl_rotate_buf, lv_area_get_width(area), lv_area_get_height(area),
+            lv_draw_buf_width_to_stride(lv_area_get_width(area), cf),
+            lv_draw_buf_width_to_stride(lv_area_get_width(&flush_area), cf), rotation, cf
+        );
+        px_map = (uint8_t *)lvgl_rotate_buf;
+    }
+
+    lcd->drawBitmap(
+        flush_area.x1, flush_area.y1, lv_area_get_width(&flush_area), lv_area_get_height(&flush_area),
+        (const uint8_t *)px_map
+    );
+    // For RGB LCD, directly notify LVGL that the buffer is ready
+    if (lcd->getBus()->getBasicAttributes().type == ESP_PANEL_BUS_TYPE_RGB) {
+        lv_display_flush_ready(disp);
+    }
+}
+
+static bool disp_init_mirror_x = false;
+static bool disp_init_mirror_y = false;
+static bool disp_init_swap_xy = false;
+
+static void resolution_changed_event_callback(lv_event_t *e)
+{
+    lv_display_t *disp = (lv_display_t *)lv_event_get_current_target(e);
+    LCD *lcd = (LCD *)lv_display_get_user_data(disp);
+    lv_display_rotation_t rotation = lv_display_get_rotation(disp);
+
+    if (!lvgl_hw_rotate) {
+        if ((rotation != LV_DISPLAY_ROTATION_0) && (lvgl_rotate_buf == nullptr)) {
+            lvgl_rotate_buf = heap_caps_malloc(
+                                  lcd->getFrameWidth() * LVGL_PORT_BUFFER_SIZE_HEIGHT *
+                                  lv_color_format_get_size(lv_display_get_color_format(disp)), LVGL_PORT_BUFFER_MALLOC_CAPS
+                              );
+            ESP_UTILS_CHECK_FALSE_EXIT(lvgl_rotate_buf != nullptr, "Malloc LVGL rotation buffer failed");
+        }
+        return;
+    }
+
+    switch (rotation) {
+    case LV_DISPLAY_ROTATION_0:
+        lcd->swapXY(disp_init_swap_xy);
+        lcd->mirrorX(disp_init_mirror_x);
+        lcd->mirrorY(disp_init_mirror_y);
+        break;
+    case LV_DISPLAY_ROTATION_90:
+        lcd->swapXY(!disp_init_swap_xy);
+        lcd->mirrorX(disp_init_mirror_x);
+        lcd->mirrorY(!disp_init_mirror_y);
+        break;
+    case LV_DISPLAY_ROTATION_180:
+        lcd->swapXY(disp_init_swap_xy);
+        lcd->mirrorX(!disp_init_mirror_x);
+        lcd->mirrorY(!disp_init_mirror_y);
+        break;
+    case LV_DISPLAY_ROTATION_270:
+        lcd->swapXY(!disp_init_swap_xy);
+        lcd->mirrorX(!disp_init_mirror_x);
+        lcd->mirrorY(disp_init_mirror_y);
+        break;
+    }
+
+    ESP_UTILS_LOGD("Update display rotation to %d", rotation);
+}
+
+#endif /* LVGL_PORT_AVOID_TEAR */
+
+static void invalidate_area_event_callback(lv_event_t *e)
+{
+    lv_display_t *disp = (lv_display_t *)lv_event_get_current_target(e);
+    LCD *lcd = (LCD *)lv_display_get_user_data(disp);
+    lv_area_t *area = (lv_area_t *)lv_event_get_param(e);
+    uint8_t x_align = lcd->getBasicAttributes().basic_bus_spec.x_coord_align;
+    uint8_t y_align = lcd->getBasicAttributes().basic_bus_spec.y_coord_align;
+
+    if (x_align > 1) {
+        // round the start of coordinate down to the nearest aligned value
+        area->x1 &= ~(x_align - 1);
+        // round the end of coordinate up to the nearest aligned value
+        area->x2 = (area->x2 & ~(x_align - 1)) + x_align - 1;
+    }
+
+    if (y_align > 1) {
+        // round the start of coordinate down to the nearest aligned value
+        area->y1 &= ~(y_align - 1);
+        // round the end of coordinate up to the nearest aligned value
+        area->y2 = (area->y2 & ~(y_align - 1)) + y_align - 1;
+    }
+
+    // Let `lvgl_port_unlock()` wake up the LVGL task
+    lvgl_invalidate_pending = true;
+}
+
+static lv_display_t *display_init(LCD *lcd)
+{
+    ESP_UTILS_CHECK_FALSE_RETURN(lcd != nullptr, nullptr, "Invalid LCD device");
+    ESP_UTILS_CHECK_FALSE_RETURN(lcd->getRefreshPanelHandle() != nullptr, nullptr, "LCD device is not initialized");
+
+    auto lcd_width = lcd->getFrameWidth();
+    auto lcd_height = lcd->getFrameHeight();
+
+    ESP_UTILS_LOGD("Create LVGL display");
+    lv_display_t *disp = lv_display_create(lcd_width, lcd_height);
+    ESP_UTILS_CHECK_NULL_RETURN(disp, nullptr, "Create LVGL display failed");
+    lv_display_set_user_data(disp, (void *)lcd);
+    lv_display_set_flush_cb(disp, flush_callback);
+
+    uint32_t px_size = lv_color_format_get_size(lv_display_get_color_format(disp));
+    uint32_t buffer_size = 0;
+
+    ESP_UTILS_LOGD("Malloc memory for LVGL buffer");
+#if !LVGL_PORT_AVOID_TEAR
+    // Avoid tearing function is disabled
+    buffer_size = lcd_width * LVGL_PORT_BUFFER_SIZE_HEIGHT * px_size;
+    for (int i = 0; (i < LVGL_PORT_BUFFER_NUM) && (i < LVGL_PORT_BUFFER_NUM_MAX); i++) {
+        lvgl_buf[i] = heap_caps_malloc(buffer_size, LVGL_PORT_BUFFER_MALLOC_CAPS);
+        ESP_UTILS_CHECK_NULL_RETURN(lvgl_buf[i], nullptr, "Malloc LVGL buffer(%d) failed", i);
+        ESP_UTILS_LOGD("Buffer[%d] address: %p, size: %d", i, lvgl_buf[i], static_cast<int>(buffer_size));
+    }
+    lv_display_set_buffers(disp, lvgl_buf[0], lvgl_buf[1], buffer_size, LV_DISPLAY_RENDER_MODE_PARTIAL);
+
+    // Rotate by the LCD itself if it supports swapping and mirroring the axes, otherwise rotate by software
+    auto &basic_bus_spec = lcd->getBasicAttributes().basic_bus_spec;
+    lvgl_hw_rotate = basic_bus_spec.isFunctionValid(LCD::BasicBusSpecification::FUNC_SWAP_XY) &&
+                     basic_bus_spec.isFunctionValid(LCD::BasicBusSpecification::FUNC_MIRROR_X) &&
+                     basic_bus_spec.isFunctionValid(LCD::BasicBusSpecification::FUNC_MIRROR_Y);
+    auto &transformation = lcd->getTransformation();
+    disp_init_mirror_x = transformation.mirror_x;
+    disp_init_mirror_y = transformation.mirror_y;
+    disp_init_swap_xy = transformation.swap_xy;
+    lv_display_add_event_cb(disp, resolution_changed_event_callback, LV_EVENT_RESOLUTION_CHANGED, nullptr);
+#else
+    // To avoid the tearing effect, we should use at least two frame buffers: one for LVGL rendering and another for LCD refresh
+    buffer_size = lcd_width * lcd_height * px_size;
+#if LVGL_PORT_FULL_REFRESH
+    lv_display_render_mode_t render_mode = LV_DISPLAY_RENDER_MODE_FULL;
+#else
+    lv_display_render_mode_t render_mode = LV_DISPLAY_RENDER_MODE_DIRECT;
+#endif
+#if LVGL_PORT_ROTATION_DEGREE != 0
+
+    lvgl_port_lcd_fbs[0] = lcd->getFrameBufferByIndex(0);
+    lvgl_port_lcd_fbs[1] = lcd->getFrameBufferByIndex(1);
+    lvgl_buf[0] = lcd->getFrameBufferByIndex(2);
+    lv_display_set_buffers(disp, lvgl_buf[0], nullptr, buffer_size, render_mode);
+    // LVGL handles the logical resolution and the touch coordinates, and the port rotates the rendered areas
+    lv_display_set_rotation(disp, LVGL_PORT_DISPLAY_ROTATION);
+
+#elif LVGL_PORT_FULL_REFRESH && (LVGL_PORT_DISP_BUFFER_NUM == 3)
+
+    // With the usage of three buffers and full-refresh, we always have one buffer available for rendering,
+    // eliminating the need to wait for the LCD's sync signal
+    lv_color_format_t cf = lv_display_get_color_format(disp);
+    lvgl_port_lcd_last_buf = lcd->getFrameBufferByIndex(0);
+    lvgl_port_lcd_next_buf = lvgl_port_lcd_last_buf;
+    for (int i = 0; i < 2; i++) {
+        lvgl_buf[i] = lcd->getFrameBufferByIndex(i + 1);
+        lv_draw_buf_init(
+            &lvgl_draw_bufs[i], lcd_width, lcd_height, cf, LV_STRIDE_AUTO, lvgl_buf[i], buffer_size
+        );
+    }
+    lvgl_port_flush_next_buf = lvgl_buf[1];
+    lv_display_set_draw_buffers(disp, &lvgl_draw_bufs[0], &lvgl_draw_bufs[1]);
+    lv_display_set_render_mode(disp, render_mode);
+
+#else
+
+    for (int i = 0; (i < LVGL_PORT_DISP_BUFFER_NUM) && (i < LVGL_PORT_BUFFER_NUM_MAX); i++) {
+        lvgl_buf[i] = lcd->getFrameBufferByIndex(i);
+    }
+    lv_display_set_buffers(disp, lvgl_buf[0], lvgl_buf[1], buffer_size, render_mode);
+
+#endif
+#endif /* LVGL_PORT_AVOID_TEAR */
+
+    lv_display_add_event_cb(disp, invalidate_area_event_callback, LV_EVENT_INVALIDATE_AREA, nullptr);
+
+    return disp;
+}
+
+static SemaphoreHandle_t touch_detected;
+
+static void touchpad_read(lv_indev_t *indev, lv_indev_data_t *data)
+{
+    Touch *tp = (Touch *)lv_indev_get_user_data(indev);
+    TouchPoint point;
+    data->state = LV_INDEV_STATE_RELEASED;
+
+    /* if we are interrupt driven wait for the ISR to fire */
+    if ( tp->isInterruptEnabled() && (xSemaphoreTake( touch_detected, 0 ) == pdFALSE) ) {
+        return;
+    }
+
+    /* Read data from touch controller */
+    int read_touch_result = tp->readPoints(&point, 1, 0);
+    if (read_touch_result > 0) {
+        data->point.x = point.x;
+        data->point.y = point.y;
+        data->state = LV_INDEV_STATE_PRESSED;
+    }
+}
+
+static bool onTouchInterruptCallback(void *user_data)
+{
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+    xSemaphoreGiveFromISR( touch_detected, &xHigherPriorityTaskWoken );
+    lvgl_touch_event_pending = true;
+    return lvgl_port_wake_up_from_isr() || (xHigherPriorityTaskWoken == pdTRUE);
+}
+
+static lv_indev_t *indev_init(Touch *tp, lv_display_t *disp)
+{
+    ESP_UTILS_CHECK_FALSE_RETURN(tp != nullptr, nullptr, "Invalid touch device");
+    ESP_UTILS_CHECK_FALSE_RETURN(tp->getPanelHandle() != nullptr, nullptr, "Touch device is not initialized");
+
+    if (tp->isInterruptEnabled()) {
+        touch_detected = xSemaphoreCreateBinary();
+        tp->attachInterruptCallback(onTouchInterruptCallback, tp);
+    }
+    ESP_UTILS_LOGD("Register input device to LVGL");
+    lv_indev_t *indev = lv_indev_create();
+    ESP_UTILS_CHECK_NULL_RETURN(indev, nullptr, "Create LVGL input device failed");
+    lv_indev_set_type(indev, LV_INDEV_TYPE_POINTER);
+    lv_indev_set_read_cb(indev, touchpad_read);
+    lv_indev_set_user_data(indev, (void *)tp);
+    lv_indev_set_display(indev, disp);
+
+    return indev;
+}
+
+static void lvgl_port_task(void *arg)
+{
+    ESP_UTILS_LOGD("Starting LVGL task");
+
+    uint32_t task_delay_ms = LVGL_PORT_TASK_MAX_DELAY_MS;
+    while (1) {
+        if (lvgl_port_lock(-1)) {
+            /* Read the touch immediately instead of waiting for the next input read period */
+            if (lvgl_touch_event_pending && (lvgl_touch_indev != nullptr)) {
+                lvgl_touch_event_pending = false;
+                lv_timer_ready(lv_indev_get_read_timer(lvgl_touch_indev));
+            }
+            lvgl_invalidate_pending = false;
+            task_delay_ms = lv_timer_handler();
+            lvgl_port_unlock();
+        }
+        if (task_delay_ms > LVGL_PORT_TASK_MAX_DELAY_MS) {
+            task_delay_ms = LVGL_PORT_TASK_MAX_DELAY_MS;
+        } else if (task_delay_ms < LVGL_PORT_TASK_MIN_DELAY_MS) {
+            task_delay_ms = LVGL_PORT_TASK_MIN_DELAY_MS;
+        }
+        /* Sleep until the next timer deadline, or be woken up earlier by an event */
+        xSemaphoreTake(lvgl_event_sem, pdMS_TO_TICKS(task_delay_ms));
+    }
+}
+
+IRAM_ATTR bool onDrawBitmapFinishCallback(void *user_data)
+{
+    lv_display_t *disp = (lv_display_t *)user_data;
+
+    lv_display_flush_ready(disp);
+
+    return lvgl_port_wake_up_from_isr();
+}
+
+bool lvgl_port_init(LCD *lcd, Touch *tp)
+{
+    ESP_UTILS_CHECK_FALSE_RETURN(lcd != nullptr, false, "Invalid LCD device");
+
+    auto bus_type = lcd->getBus()->getBasicAttributes().type;
+#if LVGL_PORT_AVOID_TEAR
+    ESP_UTILS_CHECK_FALSE_RETURN(
+        (bus_type == ESP_PANEL_BUS_TYPE_RGB) || (bus_type == ESP_PANEL_BUS_TYPE_MIPI_DSI), false,
+        "Avoid tearing function only works with RGB/MIPI-DSI LCD now"
+    );
+    ESP_UTILS_LOGI(
+        "Avoid tearing is enabled, mode: %d, rotation: %d", LVGL_PORT_AVOID_TEARING_MODE, LVGL_PORT_ROTATION_DEGREE
+    );
+#endif
+    ESP_UTILS_LOGI("LVGL software draw units: %d", LV_DRAW_SW_DRAW_UNIT_CNT);
+
+    lv_display_t *disp = nullptr;
+    lv_indev_t *indev = nullptr;
+
+    lv_init();
+    lv_tick_set_cb(tick_get_callback);
+
+    ESP_UTILS_LOGD("Create event semaphore for LVGL task");
+    lvgl_event_sem = xSemaphoreCreateBinary();
+    ESP_UTILS_CHECK_NULL_RETURN(lvgl_event_sem, false, "Create LVGL event semaphore failed");
+
+    ESP_UTILS_LOGI("Initializing LVGL display");
+    disp = display_init(lcd);
+    ESP_UTILS_CHECK_NULL_RETURN(disp, false, "Initialize LVGL display failed");
+
+    // For non-RGB LCD, need to notify LVGL that the buffer is ready when the refresh is finished
+    if (bus_type != ESP_PANEL_BUS_TYPE_RGB) {
+        ESP_UTILS_LOGD("Attach refresh finish callback to LCD");
+        lcd->attachDrawBitmapFinishCallback(onDrawBitmapFinishCallback, (void *)disp);
+    }
+
+    if (tp != nullptr) {
+        ESP_UTILS_LOGD("Initialize LVGL input device");
+        indev = indev_init(tp, disp);
+        ESP_UTILS_CHECK_NULL_RETURN(indev, false, "Initialize LVGL input device failed");
+        lvgl_touch_indev = indev;
+    }
+
+    ESP_UTILS_LOGD("Create mutex for LVGL");
+    lvgl_mux = xSemaphoreCreateRecursiveMutex();
+    ESP_UTILS_CHECK_NULL_RETURN(lvgl_mux, false, "Create LVGL mutex failed");
+
+    ESP_UTILS_LOGD("Create LVGL task");
+    BaseType_t core_id = (LVGL_PORT_TASK_CORE < 0) ? tskNO_AFFINITY : LVGL_PORT_TASK_CORE;
+    BaseType_t ret = xTaskCreatePinnedToCore(lvgl_port_task, "lvgl", LVGL_PORT_TASK_STACK_SIZE, NULL,
+                     LVGL_PORT_TASK_PRIORITY, &lvgl_task_handle, core_id);
+    ESP_UTILS_CHECK_FALSE_RETURN(ret == pdPASS, false, "Create LVGL task failed");
+
+#if LVGL_PORT_AVOID_TEAR
+    lcd->attachRefreshFinishCallback(onLcdVsyncCallback, (void *)lvgl_task_handle);
+#endif
+
+    return true;
+}
+
+bool lvgl_port_lock(int timeout_ms)
+{
+    ESP_UTILS_CHECK_NULL_RETURN(lvgl_mux, false, "LVGL mutex is not initialized");
+
+    const TickType_t timeout_ticks = (timeout_ms < 0) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+    return (xSemaphoreTakeRecursive(lvgl_mux, timeout_ticks) == pdTRUE);
+}
+
+bool lvgl_port_unlock(void)
+{
+    ESP_UTILS_CHECK_NULL_RETURN(lvgl_mux, false, "LVGL mutex is not initialized");
+
+    /* Wake up the LVGL task if other tasks have invalidated the display */
+    bool need_wake_up = (xTaskGetCurrentTaskHandle() != lvgl_task_handle) && lvgl_invalidate_pending;
+
+    xSemaphoreGiveRecursive(lvgl_mux);
+
+    if (need_wake_up) {
+        lvgl_port_wake_up();
+    }
+
+    return true;
+}
+
+bool lvgl_port_deinit(void)
+{
+    ESP_UTILS_CHECK_FALSE_RETURN(lvgl_port_lock(-1), false, "Lock LVGL failed");
+    if (lvgl_task_handle != nullptr) {
+        vTaskDelete(lvgl_task_handle);
+        lvgl_task_handle = nullptr;
+    }
+    ESP_UTILS_CHECK_FALSE_RETURN(lvgl_port_unlock(), false, "Unlock LVGL failed");
+
+    lv_deinit();
+#if !LVGL_PORT_AVOID_TEAR
+    for (int i = 0; i < LVGL_PORT_BUFFER_NUM_MAX; i++) {
+        if (lvgl_buf[i] != nullptr) {
+            free(lvgl_buf[i]);
+            lvgl_buf[i] = nullptr;
+        }
+    }
+    if (lvgl_rotate_buf != nullptr) {
+        free(lvgl_rotate_buf);
+        lvgl_rotate_buf = nullptr;
+    }
+#endif
+    if (lvgl_mux != nullptr) {
+        vSemaphoreDelete(lvgl_mux);
+        lvgl_mux = nullptr;
+    }
+    if (lvgl_event_sem != nullptr) {
+        vSemaphoreDelete(lvgl_event_sem);
+        lvgl_event_sem = nullptr;
+    }
+    lvgl_touch_indev = nullptr;
+    lvgl_touch_event_pending = false;
+    lvgl_invalidate_pending = false;
+
+    return true;
+}
@@ -162,3 +162,41 @@ CREATE_TEST_CASE(BOARD_ESPRESSIF_ESP32_S3_LCD_EV_BOARD_2_V1_5)
 #if CONFIG_BOARD_ESPRESSIF_ESP32_S3_LCD_EV_BOARD_V1_5
 CREATE_TEST_CASE(BOARD_ESPRESSIF_ESP32_S3_LCD_EV_BOARD_V1_5)
 #endif
+
+#if CONFIG_BOARD_ESPRESSIF_ESP32_S3_BOX_3
+// The touch (GT911) of the board is on I2C(0) with SCL(18) and SDA(8)
+#define TEST_PROBE_I2C_HOST_ID  (0)
+#define TEST_PROBE_I2C_IO_SCL   (18)
+#define TEST_PROBE_I2C_IO_SDA   (8)
+
+TEST_CASE("Test board probe to detect BOARD_ESPRESSIF_ESP32_S3_BOX_3", "[board][common][probe]")
+{
+    // The board is returned even without a name
+    BoardConfig unnamed_config = BOARD_ESPRESSIF_ESP32_S3_BOX_3_CONFIG;
+    unnamed_config.name = nullptr;
+
+    const BoardProbe::Entry entries[] = {
+        // Skipped since there is no configuration
+        {nullptr, BoardProbe::GT911(TEST_PROBE_I2C_HOST_ID, TEST_PROBE_I2C_IO_SCL, TEST_PROBE_I2C_IO_SDA)},
+        // No device at the address
+        {
+            &BOARD_ESPRESSIF_ESP32_S3_BOX_3_CONFIG,
+            BoardProbe::Address(TEST_PROBE_I2C_HOST_ID, TEST_PROBE_I2C_IO_SCL, TEST_PROBE_I2C_IO_SDA, 0x7F)
+        },
+        // The GT911 answers at 0x5D or 0x14, depending on the INT level during its last reset
+        {&unnamed_config, BoardProbe::GT911(TEST_PROBE_I2C_HOST_ID, TEST_PROBE_I2C_IO_SCL, TEST_PROBE_I2C_IO_SDA)},
+    };
+    TEST_ASSERT_EQUAL_PTR_MESSAGE(&unnamed_config, BoardProbe::detect(entries), "Detect board failed");
+
+    // The bus is released after the detection, so the board can use it. `Board::init()` requires a name, so give the
+    // detected configuration one before creating the board
+    BoardConfig detected_config = unnamed_config;
+    detected_config.name = "ESP32_S3_BOX_3 (probed)";
+    shared_ptr<Board> board = make_shared<Board>(detected_config);
+    TEST_ASSERT_NOT_NULL_MESSAGE(board, "Create board object failed");
+    TEST_ASSERT_TRUE_MESSAGE(board->init(), "Board init failed");
+    TEST_ASSERT_TRUE_MESSAGE(board->begin(), "Board begin failed");
+    TEST_ASSERT_NOT_NULL_MESSAGE(board->getTouch(), "Touch is not created");
+    gpio_uninstall_isr_service();
+}
+#endif
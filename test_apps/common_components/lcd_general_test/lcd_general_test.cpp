@@ -5,6 +5,7 @@
  */
 #include <memory>
 #include <thread>
+#include <vector>
 #include "esp_log.h"
 #include "esp_timer.h"
 #include "unity.h"
@@ -15,6 +16,7 @@
 #define TEST_LCD_ENABLE_DRAW_FINISH_CALLBACK    (1)
 #define TEST_LCD_ENABLE_DSI_PATTERN_TEST        (1)
 #define TEST_LCD_COLOR_BAR_SHOW_TIME_MS     (5000)
+#define TEST_LCD_ALIGNED_CANVAS_SIZE        (16)
 
 #define delay(x)     vTaskDelay(pdMS_TO_TICKS(x))
 
@@ -23,6 +25,15 @@ using namespace esp_panel::drivers;
 
 static const char *TAG = "lcd_general_test";
 
+// 16x16 image with red, green, blue and white quadrants, generated by `tools/image_converter.py`
+static const uint8_t test_image[] = {
+    0x45, 0x50, 0x49, 0x01, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x5a, 0xc6, 0x76, 0xc6, 0x12, 0xc6, 0x30, 0xc6, 0x12, 0xc6, 0x30, 0xc6, 0x12, 0xc6, 0x30, 0xc6,
+    0x12, 0xc6, 0x30, 0xc6, 0x12, 0xc6, 0x30, 0xc6, 0x12, 0xc6, 0x30, 0xc6, 0x12, 0xc6, 0x30, 0xc6,
+    0x6d, 0xc6, 0x56, 0xc6, 0x0e, 0xc6, 0x26, 0xc6, 0x0e, 0xc6, 0x26, 0xc6, 0x0e, 0xc6, 0x26, 0xc6,
+    0x0e, 0xc6, 0x26, 0xc6, 0x0e, 0xc6, 0x26, 0xc6, 0x0e, 0xc6, 0x26, 0xc6, 0x0e, 0xc6, 0x26, 0xc6,
+};
+
 #if TEST_LCD_ENABLE_PRINT_FPS
 #define TEST_LCD_PRINT_FPS_PERIOD_MS    (1000)
 #define TEST_LCD_PRINT_FPS_COUNT_MAX    (50)
@@ -63,6 +74,49 @@ IRAM_ATTR bool onLCD_DrawFinishCallback(void *user_data)
 }
 #endif
 
+static void test_aligned_region(LCD *lcd)
+{
+    const int canvas_size = TEST_LCD_ALIGNED_CANVAS_SIZE;
+    int x_align = lcd->getBasicAttributes().basic_bus_spec.x_coord_align;
+    int y_align = lcd->getBasicAttributes().basic_bus_spec.y_coord_align;
+    int max_x = lcd->getTransformation().swap_xy ? lcd->getFrameHeight() : lcd->getFrameWidth();
+    int max_y = lcd->getTransformation().swap_xy ? lcd->getFrameWidth() : lcd->getFrameHeight();
+
+    // The unaligned region is rounded outward
+    int x = 1, y = 1, w = canvas_size / 2 + 1, h = canvas_size / 2 + 1;
+    TEST_ASSERT_TRUE_MESSAGE(lcd->getAlignedRegion(x, y, w, h, canvas_size, canvas_size), "Get aligned region failed");
+    TEST_ASSERT_EQUAL(1 & ~(x_align - 1), x);
+    TEST_ASSERT_EQUAL(1 & ~(y_align - 1), y);
+    TEST_ASSERT_EQUAL(((canvas_size / 2 + 2 + x_align - 1) & ~(x_align - 1)) - x, w);
+    TEST_ASSERT_EQUAL(((canvas_size / 2 + 2 + y_align - 1) & ~(y_align - 1)) - y, h);
+
+    // The region over the canvas is clamped to it
+    x = canvas_size - 1, y = canvas_size - 1, w = canvas_size, h = canvas_size;
+    TEST_ASSERT_TRUE_MESSAGE(lcd->getAlignedRegion(x, y, w, h, canvas_size, canvas_size), "Get aligned region failed");
+    TEST_ASSERT_EQUAL(canvas_size, x + w);
+    TEST_ASSERT_EQUAL(canvas_size, y + h);
+
+    // The region over the frame is clamped to it even if the canvas is larger, then aligned again
+    x = max_x - x_align - 1, y = max_y - y_align - 1, w = canvas_size, h = canvas_size;
+    TEST_ASSERT_TRUE_MESSAGE(
+        lcd->getAlignedRegion(x, y, w, h, max_x + canvas_size, max_y + canvas_size), "Get aligned region failed"
+    );
+    TEST_ASSERT_EQUAL(max_x & ~(x_align - 1), x + w);
+    TEST_ASSERT_EQUAL(max_y & ~(y_align - 1), y + h);
+    TEST_ASSERT_EQUAL(0, x % x_align);
+    TEST_ASSERT_EQUAL(0, w % x_align);
+    TEST_ASSERT_EQUAL(0, y % y_align);
+    TEST_ASSERT_EQUAL(0, h % y_align);
+
+    // The empty regions are rejected
+    x = 0, y = 0, w = 0, h = 1;
+    TEST_ASSERT_FALSE(lcd->getAlignedRegion(x, y, w, h, canvas_size, canvas_size));
+    x = max_x, y = 0, w = 1, h = 1;
+    TEST_ASSERT_FALSE(lcd->getAlignedRegion(x, y, w, h, max_x + canvas_size, canvas_size));
+    x = canvas_size, y = 0, w = 1, h = 1;
+    TEST_ASSERT_FALSE(lcd->getAlignedRegion(x, y, w, h, canvas_size, canvas_size));
+}
+
 void lcd_general_test(LCD *lcd)
 {
     ESP_LOGI(TAG, "Run LCD general test");
@@ -111,6 +165,29 @@ void lcd_general_test(LCD *lcd)
         ESP_LOGI(TAG, "Draw color bar from top left to bottom right, the order is B - G - R");
         TEST_ASSERT_TRUE_MESSAGE(lcd->colorBarTest(), "LCD color bar test failed");
 
+        ESP_LOGI(TAG, "Draw an unaligned region from a canvas");
+        test_aligned_region(lcd);
+        int bytes_per_pixel = (lcd->getFrameColorBits() + 7) / 8;
+        vector<uint8_t> canvas(TEST_LCD_ALIGNED_CANVAS_SIZE * TEST_LCD_ALIGNED_CANVAS_SIZE * bytes_per_pixel, 0xff);
+        TEST_ASSERT_TRUE_MESSAGE(
+            lcd->drawBitmapAligned(
+                1, 1, TEST_LCD_ALIGNED_CANVAS_SIZE / 2 + 1, TEST_LCD_ALIGNED_CANVAS_SIZE / 2 + 1, canvas.data(),
+                TEST_LCD_ALIGNED_CANVAS_SIZE, TEST_LCD_ALIGNED_CANVAS_SIZE, -1
+            ), "LCD draw aligned bitmap failed"
+        );
+        TEST_ASSERT_FALSE_MESSAGE(
+            lcd->drawBitmapAligned(
+                0, 0, 0, 0, canvas.data(), TEST_LCD_ALIGNED_CANVAS_SIZE, TEST_LCD_ALIGNED_CANVAS_SIZE, -1
+            ), "LCD draw aligned bitmap should reject an empty region"
+        );
+
+        if (lcd->getFrameColorBits() == 16) {
+            ESP_LOGI(TAG, "Draw a compressed image");
+            TEST_ASSERT_TRUE_MESSAGE(
+                lcd->drawImage(0, 0, test_image, sizeof(test_image)), "LCD draw compressed image failed"
+            );
+        }
+
 #if TEST_LCD_ENABLE_PRINT_FPS
         ESP_LOGI(TAG, "Wait for %d ms to show the color bar", TEST_LCD_COLOR_BAR_SHOW_TIME_MS);
         int i = 0;
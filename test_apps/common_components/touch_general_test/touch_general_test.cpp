@@ -3,6 +3,7 @@
  *
  * SPDX-License-Identifier: CC0-1.0
  */
+#include <array>
 #include <memory>
 #include <thread>
 #include "esp_log.h"
@@ -14,6 +15,7 @@
 #define TEST_TOUCH_ENABLE_INTERRUPT_CALLBACK   (1)
 #define TEST_TOUCH_READ_PERIOD_MS           (30)
 #define TEST_TOUCH_READ_TIME_MS             (5000)
+#define TEST_TOUCH_NO_ALLOC_READ_NUM        (100)
 
 #define delay(x)     vTaskDelay(pdMS_TO_TICKS(x))
 
@@ -23,6 +25,18 @@ using namespace esp_panel::drivers;
 
 static const char *TAG = "touch_general_test";
 
+#if CONFIG_HEAP_USE_HOOKS
+static TaskHandle_t alloc_count_task = nullptr;
+static volatile int alloc_count = 0;
+
+extern "C" void esp_heap_trace_alloc_hook(void *ptr, size_t size, uint32_t caps)
+{
+    if ((alloc_count_task != nullptr) && (xTaskGetCurrentTaskHandle() == alloc_count_task)) {
+        alloc_count = alloc_count + 1;
+    }
+}
+#endif
+
 #if TEST_TOUCH_ENABLE_INTERRUPT_CALLBACK
 IRAM_ATTR static bool onTouchInterruptCallback(void *user_data)
 {
@@ -67,6 +81,19 @@ void touch_general_test(Touch *touch)
                 delay(TEST_TOUCH_READ_PERIOD_MS);
             }
         }
+
+#if CONFIG_HEAP_USE_HOOKS
+        ESP_LOGI(TAG, "Checking heap allocations of reading points...");
+
+        std::array<drivers::TouchPoint, Touch::POINTS_MAX_NUM> point_buffer;
+        alloc_count = 0;
+        alloc_count_task = xTaskGetCurrentTaskHandle();
+        for (int i = 0; i < TEST_TOUCH_NO_ALLOC_READ_NUM; i++) {
+            TEST_ASSERT_TRUE_MESSAGE(touch->readPoints(point_buffer, 0) >= 0, "Read touch points failed");
+        }
+        alloc_count_task = nullptr;
+        TEST_ASSERT_EQUAL_INT_MESSAGE(0, alloc_count, "Reading touch points should not allocate heap memory");
+#endif
     });
 
     if (touch_thread.joinable()) {
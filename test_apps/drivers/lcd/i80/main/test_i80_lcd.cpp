@@ -0,0 +1,197 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <memory>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "unity.h"
+#include "unity_test_runner.h"
+#include "esp_display_panel.hpp"
+#include "lcd_general_test.hpp"
+
+using namespace std;
+using namespace esp_panel::drivers;
+
+/* The following default configurations are for an 8-bit I80 module with 'ST7789' */
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////// Please update the following configuration according to your LCD spec //////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define TEST_LCD_WIDTH                  (240)
+#define TEST_LCD_HEIGHT                 (320)
+#define TEST_LCD_COLOR_BITS             (16)
+#define TEST_LCD_I80_FREQ_HZ            (20 * 1000 * 1000)
+#define TEST_LCD_RGB_ELE_REVERSE_ORDER  (0)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////// Please update the following configuration according to your board spec ////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define TEST_LCD_PIN_NUM_I80_CS      (5)     // Set to -1 if not used
+#define TEST_LCD_PIN_NUM_I80_DC      (4)
+#define TEST_LCD_PIN_NUM_I80_WR      (6)
+#define TEST_LCD_PIN_NUM_I80_DATA0   (9)
+#define TEST_LCD_PIN_NUM_I80_DATA1   (46)
+#define TEST_LCD_PIN_NUM_I80_DATA2   (3)
+#define TEST_LCD_PIN_NUM_I80_DATA3   (8)
+#define TEST_LCD_PIN_NUM_I80_DATA4   (18)
+#define TEST_LCD_PIN_NUM_I80_DATA5   (17)
+#define TEST_LCD_PIN_NUM_I80_DATA6   (16)
+#define TEST_LCD_PIN_NUM_I80_DATA7   (15)
+#define TEST_LCD_PIN_NUM_RST         (48)    // Set to -1 if not used
+#define TEST_LCD_RST_ACTIVE_LEVEL    (0)
+#define TEST_LCD_PIN_NUM_BK_LIGHT    (47)    // Set to -1 if not used
+#define TEST_LCD_BK_LIGHT_ON_LEVEL   (1)
+#define TEST_LCD_BK_LIGHT_OFF_LEVEL !TEST_LCD_BK_LIGHT_ON_LEVEL
+
+static const char *TAG = "test_i80_lcd";
+
+static BacklightPWM_LEDC::Config backlight_config = {
+    .ledc_channel = BacklightPWM_LEDC::LEDC_ChannelPartialConfig{
+        .io_num = TEST_LCD_PIN_NUM_BK_LIGHT,
+        .on_level = TEST_LCD_BK_LIGHT_ON_LEVEL,
+    },
+};
+
+static BusI80::Config bus_config = {
+    .host = BusI80::HostPartialConfig{
+        .dc_gpio_num = TEST_LCD_PIN_NUM_I80_DC,
+        .wr_gpio_num = TEST_LCD_PIN_NUM_I80_WR,
+        .data_gpio_nums = {
+            TEST_LCD_PIN_NUM_I80_DATA0, TEST_LCD_PIN_NUM_I80_DATA1, TEST_LCD_PIN_NUM_I80_DATA2,
+            TEST_LCD_PIN_NUM_I80_DATA3, TEST_LCD_PIN_NUM_I80_DATA4, TEST_LCD_PIN_NUM_I80_DATA5,
+            TEST_LCD_PIN_NUM_I80_DATA6, TEST_LCD_PIN_NUM_I80_DATA7,
+            -1, -1, -1, -1, -1, -1, -1, -1
+        },
+        .data_width = 8,
+    },
+    .control_panel = BusI80::ControlPanelPartialConfig{
+        .cs_gpio_num = TEST_LCD_PIN_NUM_I80_CS,
+        .pclk_hz = TEST_LCD_I80_FREQ_HZ,
+    },
+};
+
+static LCD::Config lcd_config = {
+    .device = LCD::DevicePartialConfig{
+        .reset_gpio_num = TEST_LCD_PIN_NUM_RST,
+        .rgb_ele_order = TEST_LCD_RGB_ELE_REVERSE_ORDER ? LCD_RGB_ELEMENT_ORDER_BGR : LCD_RGB_ELEMENT_ORDER_RGB,
+        .bits_per_pixel = TEST_LCD_COLOR_BITS,
+        .flags_reset_active_high = TEST_LCD_RST_ACTIVE_LEVEL,
+    },
+    .vendor = LCD::VendorPartialConfig{
+        .hor_res = TEST_LCD_WIDTH,
+        .ver_res = TEST_LCD_HEIGHT,
+    },
+};
+
+static shared_ptr<Backlight> init_backlight(BacklightPWM_LEDC::Config *config)
+{
+#if TEST_LCD_PIN_NUM_BK_LIGHT >= 0
+    std::shared_ptr<Backlight> backlight = nullptr;
+    if (config != nullptr) {
+        ESP_LOGI(TAG, "Initialize backlight with config");
+        backlight = make_shared<BacklightPWM_LEDC>(*config);
+    } else {
+        ESP_LOGI(TAG, "Initialize backlight with individual parameters");
+        backlight = make_shared<BacklightPWM_LEDC>(TEST_LCD_PIN_NUM_BK_LIGHT, TEST_LCD_BK_LIGHT_ON_LEVEL);
+    }
+    TEST_ASSERT_NOT_NULL_MESSAGE(backlight, "Create backlight object failed");
+
+    TEST_ASSERT_TRUE_MESSAGE(backlight->begin(), "Backlight begin failed");
+    TEST_ASSERT_TRUE_MESSAGE(backlight->on(), "Backlight on failed");
+
+    return backlight;
+#else
+    return nullptr;
+#endif
+}
+
+static shared_ptr<Bus> init_bus(BusI80::Config *config)
+{
+    ESP_LOGI(TAG, "Create LCD bus");
+    // *INDENT-OFF*
+    std::shared_ptr<BusI80> bus = nullptr;
+    if (config != nullptr) {
+        ESP_LOGI(TAG, "Initialize bus with config");
+        bus = make_shared<BusI80>(*config);
+    } else {
+        ESP_LOGI(TAG, "Initialize bus with individual parameters");
+        bus = make_shared<BusI80>(
+            TEST_LCD_PIN_NUM_I80_DC, TEST_LCD_PIN_NUM_I80_WR, TEST_LCD_PIN_NUM_I80_CS,
+            TEST_LCD_PIN_NUM_I80_DATA0, TEST_LCD_PIN_NUM_I80_DATA1, TEST_LCD_PIN_NUM_I80_DATA2,
+            TEST_LCD_PIN_NUM_I80_DATA3, TEST_LCD_PIN_NUM_I80_DATA4, TEST_LCD_PIN_NUM_I80_DATA5,
+            TEST_LCD_PIN_NUM_I80_DATA6, TEST_LCD_PIN_NUM_I80_DATA7
+        );
+    }
+    // *INDENT-ON*
+    TEST_ASSERT_NOT_NULL_MESSAGE(bus, "Create bus object failed");
+
+    TEST_ASSERT_TRUE_MESSAGE(bus->configI80_FreqHz(TEST_LCD_I80_FREQ_HZ), "Bus config frequency failed");
+    TEST_ASSERT_TRUE_MESSAGE(bus->begin(), "Bus begin failed");
+
+    return bus;
+}
+
+static void run_test(shared_ptr<LCD> lcd, bool use_config)
+{
+    if (!use_config) {
+        lcd->configResetActiveLevel(TEST_LCD_RST_ACTIVE_LEVEL);
+        lcd->configColorRGB_Order(TEST_LCD_RGB_ELE_REVERSE_ORDER);
+    }
+    TEST_ASSERT_TRUE_MESSAGE(lcd->init(), "LCD init failed");
+    TEST_ASSERT_TRUE_MESSAGE(lcd->reset(), "LCD reset failed");
+    TEST_ASSERT_TRUE_MESSAGE(lcd->begin(), "LCD begin failed");
+    if (lcd->getBasicAttributes().basic_bus_spec.isFunctionValid(LCD::BasicBusSpecification::FUNC_DISPLAY_ON_OFF)) {
+        TEST_ASSERT_TRUE_MESSAGE(lcd->setDisplayOnOff(true), "LCD display on failed");
+    }
+
+    lcd_general_test(lcd.get());
+}
+
+template<typename T>
+decltype(auto) create_lcd_impl(Bus *bus, const LCD::Config &config)
+{
+    ESP_LOGI(TAG, "Create LCD with config");
+    return make_shared<T>(bus, config);
+}
+
+template<typename T>
+decltype(auto) create_lcd_impl(Bus *bus, std::nullptr_t)
+{
+    ESP_LOGI(TAG, "Create LCD with default parameters");
+    return make_shared<T>(bus, TEST_LCD_WIDTH, TEST_LCD_HEIGHT, TEST_LCD_COLOR_BITS, TEST_LCD_PIN_NUM_RST);
+}
+
+#define CREATE_LCD(name, bus, config) \
+    ({ \
+        auto lcd = create_lcd_impl<LCD_##name>(bus, config); \
+        TEST_ASSERT_NOT_NULL_MESSAGE(lcd, "Create LCD object failed"); \
+        lcd; \
+    })
+
+#define CREATE_TEST_CASE(name) \
+    TEST_CASE("Test LCD (" #name ") to draw color bar", "[lcd][i80][" #name "]") \
+    { \
+        /* 1. Test with individual parameters */ \
+        auto backlight = init_backlight(nullptr); \
+        auto bus = init_bus(nullptr); \
+        auto lcd = CREATE_LCD(name, bus.get(), nullptr); \
+        run_test(lcd, false); \
+        backlight = nullptr; \
+        lcd = nullptr; \
+        bus = nullptr; \
+        /* 2. Test with config */ \
+        backlight = init_backlight(&backlight_config); \
+        bus = init_bus(&bus_config); \
+        lcd = CREATE_LCD(name, bus.get(), lcd_config); \
+        run_test(lcd, true); \
+    }
+
+/**
+ * Here to create test cases for the LCDs which support the I80 bus
+ */
+CREATE_TEST_CASE(AXS15231B)
+CREATE_TEST_CASE(ILI9341)
+CREATE_TEST_CASE(ST7789)
+CREATE_TEST_CASE(ST7796)
@@ -3,14 +3,20 @@
  *
  * SPDX-License-Identifier: CC0-1.0
  */
+#include <algorithm>
+#include <cstring>
 #include <memory>
 #include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
 #include "freertos/task.h"
 #include "esp_heap_caps.h"
 #include "esp_log.h"
+#include "esp_system.h"
+#include "esp_timer.h"
 #include "unity.h"
 #include "unity_test_runner.h"
 #include "esp_display_panel.hpp"
+#include "drivers/lcd/port/esp_lcd_ili9341.h"
 #include "lcd_general_test.hpp"
 
 using namespace std;
@@ -67,6 +73,7 @@ const esp_panel_lcd_vendor_init_cmd_t lcd_init_cmd[] = {
 #define TEST_LCD_PIN_NUM_SPI_DC      (4)
 #define TEST_LCD_PIN_NUM_SPI_SCK     (7)
 #define TEST_LCD_PIN_NUM_SPI_MOSI    (6)
+#define TEST_LCD_PIN_NUM_SPI_MISO    (-1)    // Set to -1 if not used, the warm start is only checked with it
 #define TEST_LCD_PIN_NUM_RST         (48)    // Set to -1 if not used
 #define TEST_LCD_RST_ACTIVE_LEVEL    (1)
 #define TEST_LCD_PIN_NUM_BK_LIGHT    (47)    // Set to -1 if not used
@@ -85,6 +92,7 @@ static BacklightPWM_LEDC::Config backlight_config = {
 static BusSPI::Config bus_config = {
     .host = BusSPI::HostPartialConfig{
         .mosi_io_num = TEST_LCD_PIN_NUM_SPI_MOSI,
+        .miso_io_num = TEST_LCD_PIN_NUM_SPI_MISO,
         .sclk_io_num = TEST_LCD_PIN_NUM_SPI_SCK,
     },
     .control_panel = BusSPI::ControlPanelPartialConfig{
@@ -228,3 +236,269 @@ CREATE_TEST_CASE(ST7789)
 CREATE_TEST_CASE(ST7796)
 CREATE_TEST_CASE(ST77916)
 CREATE_TEST_CASE(ST77922)
+
+#define TEST_SHADOW_TRANSFORM_WRITES    (3)
+
+static void shadow_transform(LCD *lcd)
+{
+    TEST_ASSERT_TRUE_MESSAGE(lcd->mirrorX(false), "LCD mirror X failed");
+    TEST_ASSERT_TRUE_MESSAGE(lcd->mirrorY(false), "LCD mirror Y failed");
+    TEST_ASSERT_TRUE_MESSAGE(lcd->swapXY(false), "LCD swap XY failed");
+}
+
+TEST_CASE("Test LCD (ILI9341) to skip the repeated register writes with the shadow", "[lcd][spi][shadow]")
+{
+    auto backlight = init_backlight(&backlight_config);
+    auto bus = init_bus(&bus_config);
+    // MADCTL (0x36) and COLMOD (0x3A)
+    TEST_ASSERT_TRUE_MESSAGE(bus->enableRegisterShadow({0x36, 0x3A}), "Enable register shadow failed");
+
+    auto lcd = CREATE_LCD(ILI9341, bus.get(), lcd_config);
+    TEST_ASSERT_TRUE_MESSAGE(lcd->init(), "LCD init failed");
+    TEST_ASSERT_TRUE_MESSAGE(lcd->reset(), "LCD reset failed");
+    TEST_ASSERT_TRUE_MESSAGE(lcd->begin(), "LCD begin failed");
+    const Bus::RegisterShadowStats &stats = bus->getRegisterShadowStats();
+    TEST_ASSERT_GREATER_THAN_MESSAGE(0, stats.invalidations, "The reset should invalidate the shadow");
+
+    // The first transformation may hit the device, since the init sequence ends with commands without parameters
+    Bus::RegisterShadowStats before = stats;
+    shadow_transform(lcd.get());
+    Bus::RegisterShadowStats first = stats;
+    TEST_ASSERT_EQUAL_MESSAGE(
+        TEST_SHADOW_TRANSFORM_WRITES,
+        (first.skipped_writes - before.skipped_writes) + (first.missed_writes - before.missed_writes),
+        "Each MADCTL write should be counted as a hit or a miss"
+    );
+
+    // The repeated one writes the same data, so all the writes are skipped
+    shadow_transform(lcd.get());
+    TEST_ASSERT_EQUAL_MESSAGE(
+        TEST_SHADOW_TRANSFORM_WRITES, stats.skipped_writes - first.skipped_writes, "The repeated writes are not skipped"
+    );
+    TEST_ASSERT_EQUAL_MESSAGE(first.missed_writes, stats.missed_writes, "The repeated writes hit the device");
+
+    // The data of MADCTL is in the shadow now, so the read doesn't need the MISO line
+    uint8_t madctl = 0xFF;
+    TEST_ASSERT_TRUE_MESSAGE(bus->readRegisterData(0x36, &madctl, sizeof(madctl)), "Read MADCTL failed");
+    TEST_ASSERT_EQUAL_MESSAGE(first.cached_reads + 1, stats.cached_reads, "The read is not served from the shadow");
+    TEST_ASSERT_EQUAL_MESSAGE(first.missed_reads, stats.missed_reads, "The read hits the device");
+    ESP_LOGI(
+        TAG, "Register shadow: skipped_writes(%d), missed_writes(%d), cached_reads(%d), missed_reads(%d)",
+        static_cast<int>(stats.skipped_writes), static_cast<int>(stats.missed_writes),
+        static_cast<int>(stats.cached_reads), static_cast<int>(stats.missed_reads)
+    );
+
+    lcd = nullptr;
+    bus = nullptr;
+    backlight = nullptr;
+}
+
+/**
+ * ILI9341 driver without a controller name, like a custom driver which leaves the name empty
+ */
+class TestLCD_Unnamed: public LCD {
+public:
+    TestLCD_Unnamed(Bus *bus, const Config &config):
+        LCD(BasicAttributes{.name = nullptr}, bus, config)
+    {
+    }
+
+    ~TestLCD_Unnamed() override
+    {
+        del();
+    }
+
+    bool init() override
+    {
+        static const BasicBusSpecificationMap bus_specifications = {
+            {
+                ESP_PANEL_BUS_TYPE_SPI, BasicBusSpecification{
+                    .color_bits = (1U << BasicBusSpecification::COLOR_BITS_RGB565_16),
+                    .functions = (1U << BasicBusSpecification::FUNC_DISPLAY_ON_OFF),
+                },
+            },
+        };
+        if (isOverState(State::INIT) || !processDeviceOnInit(bus_specifications)) {
+            return false;
+        }
+        if (esp_lcd_new_panel_ili9341(
+                    getBus()->getControlPanelHandle(), getConfig().getDeviceFullConfig(), &refresh_panel
+                ) != ESP_OK) {
+            return false;
+        }
+        setState(State::INIT);
+
+        return true;
+    }
+};
+
+TEST_CASE("Test LCD (ILI9341) to begin with warm start", "[lcd][spi][warm_start]")
+{
+    auto backlight = init_backlight(&backlight_config);
+    auto bus = init_bus(&bus_config);
+
+    ESP_LOGI(TAG, "Check the warm start configuration");
+    auto lcd = CREATE_LCD(ILI9341, bus.get(), lcd_config);
+    TEST_ASSERT_FALSE_MESSAGE(lcd->configWarmStart(true, 0x0A, 0x10, 0x30), "Value out of the mask is accepted");
+    TEST_ASSERT_TRUE_MESSAGE(lcd->configWarmStart(true), "Config warm start failed");
+    TEST_ASSERT_TRUE_MESSAGE(lcd->init(), "LCD init failed");
+    TEST_ASSERT_FALSE_MESSAGE(lcd->configWarmStart(false), "Config warm start after init is accepted");
+    TEST_ASSERT_TRUE_MESSAGE(lcd->begin(), "LCD begin failed");
+    ESP_LOGI(TAG, "First begin: %s", lcd->isWarmStarted() ? "warm" : "cold");
+    // Beginning again after an explicit reset always takes the cold path
+    TEST_ASSERT_TRUE_MESSAGE(lcd->reset(), "LCD reset failed");
+    TEST_ASSERT_TRUE_MESSAGE(lcd->begin(), "LCD begin failed");
+    TEST_ASSERT_FALSE_MESSAGE(lcd->isWarmStarted(), "Warm started after reset");
+    lcd = nullptr;
+
+    ESP_LOGI(TAG, "Begin an LCD without a controller name");
+    auto unnamed_lcd = make_shared<TestLCD_Unnamed>(bus.get(), lcd_config);
+    TEST_ASSERT_NOT_NULL_MESSAGE(unnamed_lcd, "Create LCD object failed");
+    TEST_ASSERT_TRUE_MESSAGE(unnamed_lcd->configWarmStart(true), "Config warm start failed");
+    TEST_ASSERT_TRUE_MESSAGE(unnamed_lcd->begin(), "LCD begin failed");
+    if (unnamed_lcd->getBasicAttributes().basic_bus_spec.isFunctionValid(
+                LCD::BasicBusSpecification::FUNC_DISPLAY_ON_OFF
+            )) {
+        TEST_ASSERT_TRUE_MESSAGE(unnamed_lcd->setDisplayOnOff(true), "LCD display on failed");
+    }
+    TEST_ASSERT_TRUE_MESSAGE(unnamed_lcd->colorBarTest(), "LCD color bar test failed");
+
+    unnamed_lcd = nullptr;
+    bus = nullptr;
+    backlight = nullptr;
+}
+
+static void warm_start_record_marker(void)
+{
+    auto backlight = init_backlight(&backlight_config);
+    auto bus = init_bus(&bus_config);
+    auto lcd = CREATE_LCD(ILI9341, bus.get(), lcd_config);
+    TEST_ASSERT_TRUE_MESSAGE(lcd->configWarmStart(true), "Config warm start failed");
+    TEST_ASSERT_TRUE_MESSAGE(lcd->init(), "LCD init failed");
+    // The explicit reset forces the cold path, which records the marker
+    TEST_ASSERT_TRUE_MESSAGE(lcd->reset(), "LCD reset failed");
+    TEST_ASSERT_TRUE_MESSAGE(lcd->begin(), "LCD begin failed");
+    TEST_ASSERT_FALSE_MESSAGE(lcd->isWarmStarted(), "Warm started after reset");
+    TEST_ASSERT_TRUE_MESSAGE(lcd->setDisplayOnOff(true), "LCD display on failed");
+
+    // Keep the panel as it is, only the chip is reset
+    esp_restart();
+}
+
+static void warm_start_check_skipped(void)
+{
+    TEST_ASSERT_EQUAL_MESSAGE(ESP_RST_SW, esp_reset_reason(), "Not started by the software reset");
+#if TEST_LCD_PIN_NUM_SPI_MISO < 0
+    TEST_IGNORE_MESSAGE("The warm start needs the MISO line to read the panel state");
+#else
+    auto backlight = init_backlight(&backlight_config);
+    auto bus = init_bus(&bus_config);
+    auto lcd = CREATE_LCD(ILI9341, bus.get(), lcd_config);
+    TEST_ASSERT_TRUE_MESSAGE(lcd->configWarmStart(true), "Config warm start failed");
+    TEST_ASSERT_TRUE_MESSAGE(lcd->begin(), "LCD begin failed");
+    TEST_ASSERT_TRUE_MESSAGE(lcd->isWarmStarted(), "Reset and initialization are not skipped");
+    // The panel should work without the skipped reset and initialization
+    TEST_ASSERT_TRUE_MESSAGE(lcd->colorBarTest(), "LCD color bar test failed");
+#endif
+}
+
+TEST_CASE_MULTIPLE_STAGES(
+    "Test LCD (ILI9341) to skip reset and initialization after a software reset", "[lcd][spi][warm_start]",
+    warm_start_record_marker, warm_start_check_skipped
+);
+
+#define TEST_ARBITRATION_CHUNK_BYTES    (4 * 1024)
+#define TEST_ARBITRATION_DRAW_LINES     (TEST_LCD_HEIGHT / 2)
+#define TEST_ARBITRATION_DRAW_TIMES     (20)
+#define TEST_ARBITRATION_READ_TIMES     (50)
+#define TEST_ARBITRATION_MARGIN_US      (2000)
+
+struct ArbitrationDrawContext {
+    LCD *lcd;
+    const uint8_t *color;
+    SemaphoreHandle_t done_sem;
+    bool is_ok;
+};
+
+static void arbitration_draw_task(void *arg)
+{
+    auto ctx = static_cast<ArbitrationDrawContext *>(arg);
+
+    ctx->is_ok = true;
+    for (int i = 0; (i < TEST_ARBITRATION_DRAW_TIMES) && ctx->is_ok; i++) {
+        ctx->is_ok = ctx->lcd->drawBitmap(0, 0, TEST_LCD_WIDTH, TEST_ARBITRATION_DRAW_LINES, ctx->color, -1);
+    }
+    xSemaphoreGive(ctx->done_sem);
+    vTaskDelete(nullptr);
+}
+
+TEST_CASE("Test LCD (ILI9341) to serve urgent reads during large color transfers", "[lcd][spi][arbitration]")
+{
+    auto backlight = init_backlight(&backlight_config);
+
+    ESP_LOGI(TAG, "Create the bulk bus of the LCD");
+    auto bulk_bus = make_shared<BusSPI>(bus_config);
+    TEST_ASSERT_NOT_NULL_MESSAGE(bulk_bus, "Create bus object failed");
+    TEST_ASSERT_TRUE_MESSAGE(
+        bulk_bus->configSPI_Priority(BusSPI::Priority::BULK, TEST_ARBITRATION_CHUNK_BYTES), "Config priority failed"
+    );
+    TEST_ASSERT_TRUE_MESSAGE(bulk_bus->begin(), "Bus begin failed");
+
+    auto lcd = CREATE_LCD(ILI9341, bulk_bus.get(), lcd_config);
+    TEST_ASSERT_TRUE_MESSAGE(lcd->init(), "LCD init failed");
+    TEST_ASSERT_TRUE_MESSAGE(lcd->reset(), "LCD reset failed");
+    TEST_ASSERT_TRUE_MESSAGE(lcd->begin(), "LCD begin failed");
+
+    ESP_LOGI(TAG, "Create an urgent bus without CS on the same host");
+    BusSPI::Config urgent_config = {
+        .control_panel = BusSPI::ControlPanelPartialConfig{
+            .pclk_hz = TEST_LCD_SPI_FREQ_HZ,
+        },
+    };
+    auto urgent_bus = make_shared<BusSPI>(urgent_config);
+    TEST_ASSERT_NOT_NULL_MESSAGE(urgent_bus, "Create bus object failed");
+    TEST_ASSERT_TRUE_MESSAGE(urgent_bus->configSPI_Priority(BusSPI::Priority::URGENT), "Config priority failed");
+    TEST_ASSERT_TRUE_MESSAGE(urgent_bus->begin(), "Bus begin failed");
+
+    size_t color_size = TEST_LCD_WIDTH * TEST_ARBITRATION_DRAW_LINES * TEST_LCD_COLOR_BITS / 8;
+    uint8_t *color = static_cast<uint8_t *>(heap_caps_malloc(color_size, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL));
+    TEST_ASSERT_NOT_NULL_MESSAGE(color, "Allocate color buffer failed");
+    memset(color, 0x5A, color_size);
+
+    ArbitrationDrawContext ctx = {
+        .lcd = lcd.get(),
+        .color = color,
+        .done_sem = xSemaphoreCreateBinary(),
+        .is_ok = false,
+    };
+    TEST_ASSERT_NOT_NULL_MESSAGE(ctx.done_sem, "Create semaphore failed");
+    TEST_ASSERT_EQUAL(pdPASS, xTaskCreate(arbitration_draw_task, "draw", 4096, &ctx, 5, nullptr));
+
+    // The read waits for the chunks already queued ahead of it, and the one being transmitted
+    int64_t chunk_time_us = static_cast<int64_t>(TEST_ARBITRATION_CHUNK_BYTES) * 8 * 1000000 / TEST_LCD_SPI_FREQ_HZ;
+    int64_t latency_limit_us = chunk_time_us * (BusSPI::ARBITRATION_INFLIGHT_CHUNKS_MAX + 1) +
+                               TEST_ARBITRATION_MARGIN_US;
+    int64_t latency_max_us = 0;
+    uint8_t id[3] = {};
+    for (int i = 0; i < TEST_ARBITRATION_READ_TIMES; i++) {
+        vTaskDelay(pdMS_TO_TICKS(3));
+        int64_t start_us = esp_timer_get_time();
+        TEST_ASSERT_TRUE_MESSAGE(urgent_bus->readRegisterData(0x04, id, sizeof(id)), "Urgent read failed");
+        latency_max_us = std::max(latency_max_us, esp_timer_get_time() - start_us);
+    }
+    ESP_LOGI(
+        TAG, "Urgent read latency: max(%d us), limit(%d us), chunk(%d us)", static_cast<int>(latency_max_us),
+        static_cast<int>(latency_limit_us), static_cast<int>(chunk_time_us)
+    );
+
+    TEST_ASSERT_EQUAL(pdTRUE, xSemaphoreTake(ctx.done_sem, pdMS_TO_TICKS(10000)));
+    TEST_ASSERT_TRUE_MESSAGE(ctx.is_ok, "Draw bitmap failed during urgent reads");
+    TEST_ASSERT_TRUE_MESSAGE(latency_max_us <= latency_limit_us, "Urgent read latency is over the limit");
+
+    vSemaphoreDelete(ctx.done_sem);
+    heap_caps_free(color);
+    urgent_bus = nullptr;
+    lcd = nullptr;
+    bulk_bus = nullptr;
+    backlight = nullptr;
+}
@@ -20,6 +20,7 @@ using namespace esp_panel::drivers;
 using namespace esp_panel::board;
 
 #define TEST_DISPLAY_SHOW_TIME_MS   (10000)
+#define TEST_ROTATION_SHOW_TIME_MS  (3000)
 
 #define delay(x)     vTaskDelay(pdMS_TO_TICKS(x))
 
@@ -69,3 +70,51 @@ TEST_CASE("Test board lvgl port to show demo", "[board][lvgl]")
 
     lvgl_port_deinit();
 }
+
+#if !LVGL_PORT_AVOID_TEARING_MODE
+TEST_CASE("Test board lvgl port to show demo with software rotation", "[board][lvgl][rotation]")
+{
+    shared_ptr<Board> board = make_shared<Board>();
+    TEST_ASSERT_NOT_NULL_MESSAGE(board, "Create board object failed");
+
+    ESP_LOGI(TAG, "Initialize display board");
+    TEST_ASSERT_TRUE_MESSAGE(board->init(), "Board init failed");
+    TEST_ASSERT_TRUE_MESSAGE(board->begin(), "Board begin failed");
+
+    ESP_LOGI(TAG, "Initialize LVGL");
+    TEST_ASSERT_TRUE_MESSAGE(lvgl_port_init(board->getLCD(), board->getTouch()), "LVGL port init failed");
+
+    ESP_LOGI(TAG, "Creating UI");
+    lvgl_port_lock(-1);
+
+    /**
+     * Force the software rotation even if the LCD supports the hardware transformation, then LVGL flushes the rotated
+     * areas from its temporary buffer, which should not be swapped into the draw buffers by the flush pipeline
+     */
+    lv_disp_drv_t *drv = lv_disp_get_default()->driver;
+    drv->drv_update_cb = nullptr;
+    drv->sw_rotate = 1;
+    lv_demo_widgets();
+
+    lvgl_port_unlock();
+
+    for (uint16_t degree : {90, 180, 270, 0}) {
+        ESP_LOGI(TAG, "Rotate to %d degree", degree);
+        lvgl_port_lock(-1);
+        TEST_ASSERT_TRUE_MESSAGE(lvgl_port_set_rotation(degree), "Set rotation failed");
+        lvgl_port_unlock();
+
+        delay(TEST_ROTATION_SHOW_TIME_MS);
+
+        lvgl_port_lock(-1);
+        lv_disp_draw_buf_t *draw_buf = drv->draw_buf;
+        TEST_ASSERT_NOT_NULL_MESSAGE(draw_buf->buf1, "Draw buffer 1 is lost");
+        TEST_ASSERT_TRUE_MESSAGE(
+            heap_caps_check_integrity_all(true), "Heap is corrupted after the flushes of the rotated areas"
+        );
+        lvgl_port_unlock();
+    }
+
+    lvgl_port_deinit();
+}
+#endif
@@ -0,0 +1,117 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <memory>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "unity.h"
+#include "unity_test_runner.h"
+#include "esp_display_panel.hpp"
+#include "lvgl.h"
+#include "lvgl_v9_port.h"
+#include "demos/lv_demos.h"
+
+using namespace std;
+using namespace esp_panel::drivers;
+using namespace esp_panel::board;
+
+#define TEST_DISPLAY_SHOW_TIME_MS   (10000)
+#define TEST_ROTATION_SHOW_TIME_MS  (3000)
+
+#define delay(x)     vTaskDelay(pdMS_TO_TICKS(x))
+
+static const char *TAG = "test_lvgl_port";
+
+TEST_CASE("Test board lvgl port to show demo", "[board][lvgl]")
+{
+    shared_ptr<Board> board = make_shared<Board>();
+    TEST_ASSERT_NOT_NULL_MESSAGE(board, "Create board object failed");
+
+    ESP_LOGI(TAG, "Initialize display board");
+    TEST_ASSERT_TRUE_MESSAGE(board->init(), "Board init failed");
+#if LVGL_PORT_AVOID_TEARING_MODE
+    auto lcd = board->getLCD();
+    // When avoid tearing function is enabled, the frame buffer number should be set in the board driver
+    lcd->configFrameBufferNumber(LVGL_PORT_DISP_BUFFER_NUM);
+#if ESP_PANEL_DRIVERS_BUS_ENABLE_RGB && CONFIG_IDF_TARGET_ESP32S3
+    auto lcd_bus = lcd->getBus();
+    /**
+     * As the anti-tearing feature typically consumes more PSRAM bandwidth, for the ESP32-S3, we need to utilize the
+     * "bounce buffer" functionality to enhance the RGB data bandwidth.
+     * This feature will consume `bounce_buffer_size * bytes_per_pixel * 2` of SRAM memory.
+     */
+    if (lcd_bus->getBasicAttributes().type == ESP_PANEL_BUS_TYPE_RGB) {
+        static_cast<BusRGB *>(lcd_bus)->configRGB_BounceBufferSize(lcd->getFrameWidth() * 10);
+    }
+#endif
+#endif
+    TEST_ASSERT_TRUE_MESSAGE(board->begin(), "Board begin failed");
+
+    ESP_LOGI(TAG, "Initialize LVGL");
+    TEST_ASSERT_TRUE_MESSAGE(lvgl_port_init(board->getLCD(), board->getTouch()), "LVGL port init failed");
+
+    ESP_LOGI(TAG, "Creating UI");
+    /* Lock the mutex due to the LVGL APIs are not thread-safe */
+    lvgl_port_lock(-1);
+
+    // lv_demo_widgets();
+    // lv_demo_benchmark();
+    lv_demo_music();
+    // lv_demo_stress();
+
+    /* Release the mutex */
+    lvgl_port_unlock();
+
+    delay(TEST_DISPLAY_SHOW_TIME_MS);
+
+    TEST_ASSERT_TRUE_MESSAGE(lvgl_port_deinit(), "LVGL port deinit failed");
+}
+
+#if !LVGL_PORT_AVOID_TEARING_MODE
+TEST_CASE("Test board lvgl port to show demo with rotation", "[board][lvgl][rotation]")
+{
+    shared_ptr<Board> board = make_shared<Board>();
+    TEST_ASSERT_NOT_NULL_MESSAGE(board, "Create board object failed");
+
+    ESP_LOGI(TAG, "Initialize display board");
+    TEST_ASSERT_TRUE_MESSAGE(board->init(), "Board init failed");
+    TEST_ASSERT_TRUE_MESSAGE(board->begin(), "Board begin failed");
+
+    ESP_LOGI(TAG, "Initialize LVGL");
+    TEST_ASSERT_TRUE_MESSAGE(lvgl_port_init(board->getLCD(), board->getTouch()), "LVGL port init failed");
+
+    ESP_LOGI(TAG, "Creating UI");
+    lvgl_port_lock(-1);
+    lv_demo_widgets();
+    lvgl_port_unlock();
+
+    /**
+     * The LCDs without the hardware transformation rotate the flushed areas into the rotation buffer of the port, so
+     * check the heap after each rotation
+     */
+    for (lv_display_rotation_t rotation : {
+                LV_DISPLAY_ROTATION_90, LV_DISPLAY_ROTATION_180, LV_DISPLAY_ROTATION_270, LV_DISPLAY_ROTATION_0
+            }) {
+        ESP_LOGI(TAG, "Rotate to %d degree", static_cast<int>(rotation) * 90);
+        lvgl_port_lock(-1);
+        lv_display_t *disp = lv_display_get_default();
+        lv_display_set_rotation(disp, rotation);
+        TEST_ASSERT_EQUAL_MESSAGE(rotation, lv_display_get_rotation(disp), "Set rotation failed");
+        lvgl_port_unlock();
+
+        delay(TEST_ROTATION_SHOW_TIME_MS);
+
+        lvgl_port_lock(-1);
+        TEST_ASSERT_TRUE_MESSAGE(
+            heap_caps_check_integrity_all(true), "Heap is corrupted after the flushes of the rotated areas"
+        );
+        lvgl_port_unlock();
+    }
+
+    TEST_ASSERT_TRUE_MESSAGE(lvgl_port_deinit(), "LVGL port deinit failed");
+}
+#endif
@@ -0,0 +1,110 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Host tool of `esp_panel::drivers::BusDSICalculator`, which checks the model and calculates the link of a panel.
+ *
+ * Build: g++ -std=gnu++17 -O2 -I src/drivers/bus tools/dsi_link_calculator.cpp -o dsi_link_calculator
+ * Usage: dsi_link_calculator <h_size> <v_size> <bpp> <hpw> <hbp> <hfp> <vpw> <vbp> <vfp> <lanes> <refresh_hz>
+ *        dsi_link_calculator (only run the checks)
+ * Output: `<dpi_clock_freq_mhz> <lane_bit_rate_mbps> <refresh_rate>`, `refresh_hz` = 0 means the highest one
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include "esp_panel_bus_dsi_calculator.hpp"
+
+using namespace esp_panel::drivers;
+
+// 1024x600 RGB565, the timing of `BOARD_ESPRESSIF_ESP32_P4_FUNCTION_EV_BOARD`
+static constexpr BusDSICalculator::Timing TIMING_1024_600 = {
+    .h_size = 1024,
+    .v_size = 600,
+    .hsync_pulse_width = 10,
+    .hsync_back_porch = 160,
+    .hsync_front_porch = 160,
+    .vsync_pulse_width = 1,
+    .vsync_back_porch = 23,
+    .vsync_front_porch = 12,
+    .bits_per_pixel = 16,
+};
+
+static constexpr BusDSICalculator::Timing with_bpp(BusDSICalculator::Timing timing, uint32_t bits_per_pixel)
+{
+    timing.bits_per_pixel = bits_per_pixel;
+    return timing;
+}
+
+static constexpr BusDSICalculator::Limits LIMITS = {};
+static constexpr BusDSICalculator::Plan PLAN_60HZ = BusDSICalculator::calculate(TIMING_1024_600, 2, 60, LIMITS);
+static constexpr BusDSICalculator::Plan PLAN_MAX_1_LANE =
+    BusDSICalculator::calculate(with_bpp(TIMING_1024_600, 24), 1, 0, LIMITS);
+
+// 1354 x 636 clocks per frame, so 52 MHz gives 60.38 Hz
+static_assert(BusDSICalculator::getRefreshRateX100(TIMING_1024_600, 52) == 6038);
+// 52 MHz x 16 bits x 110% / 2 lanes = 457.6 Mbps
+static_assert(BusDSICalculator::getMinLaneBitRateMbps(TIMING_1024_600, 2, 52, 10) == 458);
+// The DPI clock is rounded up to reach the target
+static_assert(PLAN_60HZ.is_valid && (PLAN_60HZ.dpi_clock_freq_mhz == 52));
+static_assert(PLAN_60HZ.lane_bit_rate_mbps == 458);
+static_assert(PLAN_60HZ.refresh_rate_x100 >= 6000);
+// The highest refresh rate of 1 lane with RGB888 is bound by the lane bandwidth: 1500 / 24 / 110% = 56.8 MHz
+static_assert(PLAN_MAX_1_LANE.is_valid && (PLAN_MAX_1_LANE.dpi_clock_freq_mhz == 56));
+static_assert(PLAN_MAX_1_LANE.lane_bit_rate_mbps <= LIMITS.lane_bit_rate_mbps_max);
+// The target over the limits is rejected
+static_assert(!BusDSICalculator::calculate(with_bpp(TIMING_1024_600, 24), 1, 120, LIMITS).is_valid);
+static_assert(!BusDSICalculator::calculate(BusDSICalculator::Timing{}, 2, 60, LIMITS).is_valid);
+// The configuration of the board is valid
+static_assert(BusDSICalculator::validate(TIMING_1024_600, 2, 1000, 52, LIMITS) == BusDSICalculator::Error::NONE);
+// The lanes can't carry 52 MHz x 16 bits with 1 lane at 800 Mbps
+static_assert(BusDSICalculator::validate(TIMING_1024_600, 1, 800, 52, LIMITS) ==
+              BusDSICalculator::Error::BANDWIDTH_NOT_ENOUGH);
+// Not carrying the pixel bits is reported even if the clocks also exceed the limits
+static_assert(BusDSICalculator::validate(TIMING_1024_600, 1, 2000, 200, LIMITS) ==
+              BusDSICalculator::Error::BANDWIDTH_NOT_ENOUGH);
+static_assert(BusDSICalculator::validate(TIMING_1024_600, 1, 840, 52, LIMITS) ==
+              BusDSICalculator::Error::BANDWIDTH_NO_MARGIN);
+static_assert(BusDSICalculator::validate(TIMING_1024_600, 2, 2000, 52, LIMITS) ==
+              BusDSICalculator::Error::LANE_RATE_OVER_LIMIT);
+static_assert(BusDSICalculator::validate(TIMING_1024_600, 2, 1000, 0, LIMITS) ==
+              BusDSICalculator::Error::INVALID_ARGUMENT);
+
+int main(int argc, char **argv)
+{
+    if (argc == 1) {
+        printf("All checks passed\n");
+        return 0;
+    }
+    if (argc != 12) {
+        fprintf(stderr, "Usage: %s <h_size> <v_size> <bpp> <hpw> <hbp> <hfp> <vpw> <vbp> <vfp> <lanes> <refresh_hz>\n",
+                argv[0]);
+        return 1;
+    }
+
+    BusDSICalculator::Timing timing = {};
+    timing.h_size = strtoul(argv[1], nullptr, 0);
+    timing.v_size = strtoul(argv[2], nullptr, 0);
+    timing.bits_per_pixel = strtoul(argv[3], nullptr, 0);
+    timing.hsync_pulse_width = strtoul(argv[4], nullptr, 0);
+    timing.hsync_back_porch = strtoul(argv[5], nullptr, 0);
+    timing.hsync_front_porch = strtoul(argv[6], nullptr, 0);
+    timing.vsync_pulse_width = strtoul(argv[7], nullptr, 0);
+    timing.vsync_back_porch = strtoul(argv[8], nullptr, 0);
+    timing.vsync_front_porch = strtoul(argv[9], nullptr, 0);
+    uint32_t lanes = strtoul(argv[10], nullptr, 0);
+    uint32_t refresh_rate_hz = strtoul(argv[11], nullptr, 0);
+
+    BusDSICalculator::Plan plan = BusDSICalculator::calculate(timing, lanes, refresh_rate_hz, LIMITS);
+    if (!plan.is_valid) {
+        fprintf(stderr, "The refresh rate is not supported by the link\n");
+        return 1;
+    }
+    printf("%u %u %u.%02u\n", static_cast<unsigned>(plan.dpi_clock_freq_mhz),
+           static_cast<unsigned>(plan.lane_bit_rate_mbps), static_cast<unsigned>(plan.refresh_rate_x100 / 100),
+           static_cast<unsigned>(plan.refresh_rate_x100 % 100));
+
+    return 0;
+}
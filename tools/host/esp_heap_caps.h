@@ -0,0 +1,47 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Host stand-in of the ESP-IDF header, only used to build the tools in `tools/` against the library sources */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+#define MALLOC_CAP_8BIT         (1 << 2)
+#define MALLOC_CAP_SPIRAM       (1 << 10)
+#define MALLOC_CAP_INTERNAL     (1 << 11)
+
+/**
+ * Address ranges of the blocks from `heap_caps_aligned_alloc()`, so a tool can tell the memory of an arena from the
+ * one of the general allocator
+ */
+struct HostHeapCapsBlock {
+    uintptr_t begin;
+    uintptr_t end;
+};
+inline HostHeapCapsBlock host_heap_caps_blocks[8] = {};
+inline size_t host_heap_caps_block_num = 0;
+
+inline void *heap_caps_aligned_alloc(size_t alignment, size_t size, uint32_t caps)
+{
+    (void)caps;
+    void *ptr = std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+    constexpr size_t max_num = sizeof(host_heap_caps_blocks) / sizeof(host_heap_caps_blocks[0]);
+    if ((ptr != nullptr) && (host_heap_caps_block_num < max_num)) {
+        host_heap_caps_blocks[host_heap_caps_block_num++] = {
+            reinterpret_cast<uintptr_t>(ptr), reinterpret_cast<uintptr_t>(ptr) + size
+        };
+    }
+
+    return ptr;
+}
+
+inline void heap_caps_free(void *ptr)
+{
+    std::free(ptr);
+}
@@ -0,0 +1,86 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Host stand-in of the `esp-lib-utils` header, only used to build the tools in `tools/` against the library sources */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <utility>
+
+#define ESP_UTILS_LOGD(format, ...)     do {} while (0)
+#define ESP_UTILS_LOGI(format, ...)     printf(format "\n", ##__VA_ARGS__)
+#define ESP_UTILS_LOGW(format, ...)     fprintf(stderr, "[W] " format "\n", ##__VA_ARGS__)
+#define ESP_UTILS_LOGE(format, ...)     fprintf(stderr, "[E] " format "\n", ##__VA_ARGS__)
+
+#define ESP_UTILS_CHECK_FALSE_RETURN(x, ret, format, ...) \
+    do { \
+        if (!(x)) { \
+            ESP_UTILS_LOGE(format, ##__VA_ARGS__); \
+            return ret; \
+        } \
+    } while (0)
+
+inline void *esp_utils_mem_gen_malloc(size_t size)
+{
+    return std::malloc(size);
+}
+
+inline void esp_utils_mem_gen_free(void *ptr)
+{
+    std::free(ptr);
+}
+
+namespace esp_utils {
+
+template <typename T>
+struct GeneralMemoryAllocator {
+    using value_type = T;
+
+    GeneralMemoryAllocator() = default;
+
+    template <typename U>
+    GeneralMemoryAllocator(const GeneralMemoryAllocator<U> &) {}
+
+    T *allocate(std::size_t n)
+    {
+        return (n == 0) ? nullptr : static_cast<T *>(esp_utils_mem_gen_malloc(n * sizeof(T)));
+    }
+
+    void deallocate(T *p, std::size_t n)
+    {
+        esp_utils_mem_gen_free(p);
+    }
+
+    template <typename U, typename... Args>
+    void construct(U *p, Args &&... args)
+    {
+        new (p) U(std::forward<Args>(args)...);
+    }
+
+    template <typename U>
+    void destroy(U *p)
+    {
+        p->~U();
+    }
+};
+
+template <typename T, typename U>
+bool operator==(const GeneralMemoryAllocator<T> &, const GeneralMemoryAllocator<U> &)
+{
+    return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const GeneralMemoryAllocator<T> &, const GeneralMemoryAllocator<U> &)
+{
+    return false;
+}
+
+} // namespace esp_utils
@@ -0,0 +1,18 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Host stand-in of the ESP-IDF header, only used to build the tools in `tools/` against the library sources */
+
+#pragma once
+
+#include <atomic>
+
+/* A spin lock stands for the critical section, which also masks the interrupts on the device */
+typedef std::atomic_flag portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED    ATOMIC_FLAG_INIT
+#define portENTER_CRITICAL(mux)         while ((mux)->test_and_set(std::memory_order_acquire)) {}
+#define portEXIT_CRITICAL(mux)          (mux)->clear(std::memory_order_release)
@@ -0,0 +1,9 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Host stand-in of the ESP-IDF header, only used to build the tools in `tools/` against the library sources */
+
+#pragma once
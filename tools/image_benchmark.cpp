@@ -0,0 +1,85 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Host benchmark of `esp_panel::utils::ImageDecoder`, built and run by `tools/image_converter.py benchmark`.
+ *
+ * Usage: image_benchmark <stripe_lines> <image.bin>...
+ * Output: one line per image, `<path> <fnv1a_of_pixels> <mpixel_per_s>`
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <vector>
+#include "esp_panel_utils_image.hpp"
+
+using namespace esp_panel::utils;
+
+static constexpr double BENCH_MIN_TIME_S = 0.2;
+
+static bool decode(ImageDecoder &decoder, std::vector<uint8_t> &image, std::vector<uint16_t> &stripe, int lines,
+                   uint32_t *hash)
+{
+    if (!decoder.begin(image.data(), image.size())) {
+        return false;
+    }
+    while (!decoder.isFinished()) {
+        int decoded = decoder.decodeLines(stripe.data(), lines);
+        if (decoded <= 0) {
+            return false;
+        }
+        if (hash != nullptr) {
+            for (size_t i = 0; i < static_cast<size_t>(decoded) * decoder.getHeader().width; i++) {
+                *hash = (*hash ^ stripe[i]) * 0x01000193;
+            }
+        }
+    }
+
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3) {
+        fprintf(stderr, "Usage: %s <stripe_lines> <image.bin>...\n", argv[0]);
+        return 1;
+    }
+    int lines = atoi(argv[1]);
+
+    for (int i = 2; i < argc; i++) {
+        std::ifstream file(argv[i], std::ios::binary);
+        std::vector<uint8_t> image((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        ImageDecoder decoder;
+        ImageDecoder::Header header;
+        if (!ImageDecoder::parseHeader(image.data(), image.size(), header)) {
+            fprintf(stderr, "%s: invalid image\n", argv[i]);
+            return 1;
+        }
+        std::vector<uint16_t> stripe(header.width * lines);
+
+        uint32_t hash = 0x811c9dc5;
+        if (!decode(decoder, image, stripe, lines, &hash)) {
+            fprintf(stderr, "%s: decode failed\n", argv[i]);
+            return 1;
+        }
+
+        int loops = 0;
+        double elapsed_s = 0;
+        auto start = std::chrono::steady_clock::now();
+        while (elapsed_s < BENCH_MIN_TIME_S) {
+            decode(decoder, image, stripe, lines, nullptr);
+            loops++;
+            elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+        double mpixel_per_s = static_cast<double>(header.width) * header.height * loops / elapsed_s / 1e6;
+
+        printf("%s %08x %.2f\n", argv[i], hash, mpixel_per_s);
+    }
+
+    return 0;
+}
@@ -0,0 +1,313 @@
+# SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Convert images to the compressed EPI format decoded by `esp_panel::utils::ImageDecoder`, and benchmark it.
+
+Supported inputs:
+    - LVGL v8 C arrays (`LV_IMG_CF_TRUE_COLOR` or `LV_IMG_CF_TRUE_COLOR_ALPHA` with `LV_COLOR_DEPTH` 16)
+    - PNG files (requires `Pillow`)
+
+Usage:
+    python tools/image_converter.py convert <input> -o <output.c|output.bin> [--name <array_name>]
+    python tools/image_converter.py benchmark <inputs...>
+"""
+
+import argparse
+import os
+import re
+import shutil
+import struct
+import subprocess
+import sys
+import tempfile
+
+MAGIC = b'EPI\x01'
+HEADER_SIZE = 16
+COLOR_FORMAT_RGB565 = 0
+COLOR_FORMAT_RGB565A8 = 1
+
+OP_INDEX = 0x00
+OP_DIFF = 0x40
+OP_LUMA = 0x80
+OP_RUN = 0xc0
+OP_RGB = 0xfe
+OP_RGBA = 0xff
+
+RUN_MAX = 62
+BENCH_STRIPE_LINES = 16
+
+ROOT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+BENCH_SOURCES = [
+    os.path.join(ROOT_DIR, 'tools', 'image_benchmark.cpp'),
+    os.path.join(ROOT_DIR, 'src', 'utils', 'esp_panel_utils_image.cpp'),
+]
+
+
+class Image:
+    def __init__(self, name, width, height, colors, alphas=None):
+        self.name = name
+        self.width = width
+        self.height = height
+        self.colors = colors    # RGB565 values
+        self.alphas = alphas    # 8-bit alpha values, or `None`
+
+    @property
+    def raw_size(self):
+        return self.width * self.height * (3 if self.alphas is not None else 2)
+
+
+def split_color(color):
+    return color >> 11, (color >> 5) & 0x3f, color & 0x1f
+
+
+def cache_index(color, alpha):
+    r, g, b = split_color(color)
+    return (r * 3 + g * 5 + b * 7 + alpha * 11) & 0x3f
+
+
+def encode(image):
+    has_alpha = image.alphas is not None
+    out = bytearray()
+    cache = [(0, 0)] * 64
+    prev = (0, 0xff)
+    run = 0
+    pixel_num = image.width * image.height
+
+    for i in range(pixel_num):
+        pixel = (image.colors[i], image.alphas[i] if has_alpha else 0xff)
+        if pixel == prev:
+            run += 1
+            if (run == RUN_MAX) or (i == pixel_num - 1):
+                out.append(OP_RUN | (run - 1))
+                run = 0
+            continue
+        if run > 0:
+            out.append(OP_RUN | (run - 1))
+            run = 0
+
+        index = cache_index(*pixel)
+        if cache[index] == pixel:
+            out.append(OP_INDEX | index)
+        elif pixel[1] != prev[1]:
+            out.append(OP_RGBA)
+            out += struct.pack('<HB', *pixel)
+        else:
+            pr, pg, pb = split_color(prev[0])
+            r, g, b = split_color(pixel[0])
+            # Wrap the differences, since the decoder works modulo the channel range
+            dr = ((r - pr + 16) & 0x1f) - 16
+            dg = ((g - pg + 32) & 0x3f) - 32
+            db = ((b - pb + 16) & 0x1f) - 16
+            dg_half = (dg + 32) // 2 - 16
+            dr_dg = dr - dg_half
+            db_dg = db - dg_half
+            if (-2 <= dr <= 1) and (-2 <= dg <= 1) and (-2 <= db <= 1):
+                out.append(OP_DIFF | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2))
+            elif (-8 <= dr_dg <= 7) and (-8 <= db_dg <= 7):
+                out.append(OP_LUMA | (dg + 32))
+                out.append(((dr_dg + 8) << 4) | (db_dg + 8))
+            else:
+                out.append(OP_RGB)
+                out += struct.pack('<H', pixel[0])
+        cache[index] = pixel
+        prev = pixel
+
+    color_format = COLOR_FORMAT_RGB565A8 if has_alpha else COLOR_FORMAT_RGB565
+    header = MAGIC + struct.pack('<HHB3xI', image.width, image.height, color_format, len(out))
+    return bytes(header + out)
+
+
+def blend(color, alpha, bg_color):
+    """Same as `ImageDecoder::getOutputColor()`, used to generate the reference output"""
+    if alpha == 0xff:
+        return color
+    if alpha == 0:
+        return bg_color
+    fg = (color | (color << 16)) & 0x07e0f81f
+    bg = (bg_color | (bg_color << 16)) & 0x07e0f81f
+    a = (alpha + 4) >> 3
+    result = ((bg + ((((fg - bg) & 0xffffffff) * a & 0xffffffff) >> 5)) & 0x07e0f81f)
+    return (result | (result >> 16)) & 0xffff
+
+
+def reference_hash(image, bg_color=0):
+    """FNV-1a hash of the decoded pixels, must match the one of `tools/image_benchmark.cpp`"""
+    h = 0x811c9dc5
+    for i in range(image.width * image.height):
+        color = image.colors[i]
+        if image.alphas is not None:
+            color = blend(color, image.alphas[i], bg_color)
+        h = ((h ^ color) * 0x01000193) & 0xffffffff
+    return h
+
+
+def load_lvgl_c_array(path, swap):
+    with open(path, 'r') as f:
+        content = f.read()
+    name = os.path.splitext(os.path.basename(path))[0]
+
+    width = int(re.search(r'\.header\.w\s*=\s*(\d+)', content).group(1))
+    height = int(re.search(r'\.header\.h\s*=\s*(\d+)', content).group(1))
+    cf = re.search(r'\.header\.cf\s*=\s*(LV_IMG_CF_\w+)', content).group(1)
+    if cf not in ('LV_IMG_CF_TRUE_COLOR', 'LV_IMG_CF_TRUE_COLOR_ALPHA'):
+        raise ValueError(f'{path}: unsupported color format {cf}')
+    has_alpha = cf == 'LV_IMG_CF_TRUE_COLOR_ALPHA'
+
+    body = content[content.index('{', content.index('[]')) + 1:]
+    body = body[:body.index('};')]
+    # Files exported with all color depths keep the 16-bit data in its own conditional block
+    block = re.search(
+        r'#if\s+LV_COLOR_DEPTH\s*==\s*16\s*&&\s*LV_COLOR_16_SWAP\s*' + ('!=' if swap else '==') + r'\s*0(.*?)#endif',
+        body, re.S
+    )
+    if block:
+        body = block.group(1)
+        swap = False
+    data = bytes(int(x, 16) for x in re.findall(r'0x([0-9a-fA-F]{2})', body))
+
+    pixel_size = 3 if has_alpha else 2
+    if len(data) < width * height * pixel_size:
+        raise ValueError(f'{path}: expected {width * height * pixel_size} bytes, got {len(data)}')
+    colors = []
+    alphas = [] if has_alpha else None
+    for i in range(width * height):
+        lo, hi = data[i * pixel_size], data[i * pixel_size + 1]
+        colors.append((lo << 8) | hi if swap else (hi << 8) | lo)
+        if has_alpha:
+            alphas.append(data[i * pixel_size + 2])
+    return Image(name, width, height, colors, alphas)
+
+
+def load_png(path):
+    try:
+        from PIL import Image as PILImage
+    except ImportError:
+        raise RuntimeError('Converting PNG files requires Pillow, please install it by `pip install Pillow`')
+
+    img = PILImage.open(path).convert('RGBA')
+    width, height = img.size
+    colors = []
+    alphas = []
+    for r, g, b, a in img.getdata():
+        colors.append(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3))
+        alphas.append(a)
+    if all(a == 0xff for a in alphas):
+        alphas = None
+    name = os.path.splitext(os.path.basename(path))[0]
+    return Image(name, width, height, colors, alphas)
+
+
+def load_image(path, swap=False):
+    if path.endswith('.c'):
+        return load_lvgl_c_array(path, swap)
+    if path.endswith('.png'):
+        return load_png(path)
+    raise ValueError(f'{path}: unsupported input, should be a LVGL C array (.c) or PNG (.png)')
+
+
+def write_c_array(path, name, data, image):
+    lines = [
+        '/*',
+        f' * Generated by tools/image_converter.py, {image.width}x{image.height}, '
+        f'{"RGB565A8" if image.alphas is not None else "RGB565"}',
+        ' */',
+        '',
+        '#include <stddef.h>',
+        '#include <stdint.h>',
+        '',
+        f'const uint8_t {name}[] = {{',
+    ]
+    for i in range(0, len(data), 16):
+        lines.append('    ' + ', '.join(f'0x{x:02x}' for x in data[i:i + 16]) + ',')
+    lines += ['};', '', f'const size_t {name}_size = sizeof({name});', '']
+    with open(path, 'w') as f:
+        f.write('\n'.join(lines))
+
+
+def cmd_convert(args):
+    image = load_image(args.input, args.swap)
+    data = encode(image)
+    if args.output.endswith('.bin'):
+        with open(args.output, 'wb') as f:
+            f.write(data)
+    else:
+        write_c_array(args.output, args.name or image.name, data, image)
+    print(f'{args.input}: {image.raw_size} -> {len(data)} bytes ({len(data) / image.raw_size:.1%})')
+
+
+def build_benchmark(work_dir):
+    compiler = os.environ.get('CXX') or shutil.which('c++') or shutil.which('g++') or shutil.which('clang++')
+    if compiler is None:
+        return None
+    binary = os.path.join(work_dir, 'image_benchmark')
+    subprocess.check_call(
+        [compiler, '-std=gnu++17', '-O2', '-I', os.path.join(ROOT_DIR, 'src', 'utils'), '-o', binary] + BENCH_SOURCES
+    )
+    return binary
+
+
+def cmd_benchmark(args):
+    images = [load_image(path, args.swap) for path in args.inputs]
+    with tempfile.TemporaryDirectory() as work_dir:
+        files = []
+        for i, image in enumerate(images):
+            path = os.path.join(work_dir, f'{i}.bin')
+            with open(path, 'wb') as f:
+                f.write(encode(image))
+            files.append(path)
+
+        binary = build_benchmark(work_dir)
+        results = {}
+        if binary is None:
+            print('No C++ compiler found, skip the decoding benchmark')
+        else:
+            output = subprocess.check_output([binary, str(BENCH_STRIPE_LINES)] + files, text=True)
+            for line in output.splitlines():
+                path, checksum, mpixel_per_s = line.split()
+                results[path] = (int(checksum, 16), float(mpixel_per_s))
+
+        print(f'{"Image":<32} {"Size":>9} {"Raw":>8} {"EPI":>8} {"Ratio":>7} {"MPixel/s":>9}')
+        total_raw = total_epi = 0
+        is_ok = True
+        for image, path in zip(images, files):
+            epi_size = os.path.getsize(path)
+            total_raw += image.raw_size
+            total_epi += epi_size
+            speed = ''
+            if path in results:
+                checksum, mpixel_per_s = results[path]
+                speed = f'{mpixel_per_s:.1f}'
+                if checksum != reference_hash(image):
+                    speed += ' (mismatch!)'
+                    is_ok = False
+            print(
+                f'{image.name:<32} {f"{image.width}x{image.height}":>9} {image.raw_size:>8} {epi_size:>8} '
+                f'{epi_size / image.raw_size:>7.1%} {speed:>9}'
+            )
+        print(f'{"Total":<32} {"":>9} {total_raw:>8} {total_epi:>8} {total_epi / total_raw:>7.1%}')
+    return 0 if is_ok else 1
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert images to the compressed EPI format, and benchmark it')
+    subparsers = parser.add_subparsers(dest='command', required=True)
+
+    convert = subparsers.add_parser('convert', help='Convert an image')
+    convert.add_argument('input', help='LVGL C array (.c) or PNG (.png)')
+    convert.add_argument('-o', '--output', required=True, help='Output file, C array (.c) or binary (.bin)')
+    convert.add_argument('--name', help='Name of the C array, default is the input file name')
+    convert.add_argument('--swap', action='store_true', help='The LVGL C array is exported with `LV_COLOR_16_SWAP`')
+    convert.set_defaults(func=cmd_convert)
+
+    benchmark = subparsers.add_parser('benchmark', help='Report compression ratio and host decoding speed')
+    benchmark.add_argument('inputs', nargs='+', help='LVGL C arrays (.c) or PNGs (.png)')
+    benchmark.add_argument('--swap', action='store_true', help='The LVGL C arrays are exported with `LV_COLOR_16_SWAP`')
+    benchmark.set_defaults(func=cmd_benchmark)
+
+    args = parser.parse_args()
+    return args.func(args) or 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,141 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Host model of the flush pipeline of the LVGL v8 port (`LVGL_PORT_FLUSH_PIPELINE`), which measures the frame time with
+ * the pipeline on and off for an asynchronous LCD bus.
+ *
+ * The model follows `lv_refr.c` and `flush_callback()`: LVGL renders a stripe, waits for the ready signal of the
+ * previous flush and calls the flush callback. Without the pipeline, the ready signal comes when the transmission
+ * finishes. With the pipeline, it comes at once if a free buffer exists, otherwise when the oldest stripe in flight
+ * finishes. The render time of each stripe is jittered, since the pipeline only helps when it is uneven.
+ *
+ * Build: g++ -std=gnu++17 -O2 tools/lvgl_flush_pipeline_benchmark.cpp -o lvgl_flush_pipeline_benchmark
+ * Usage: lvgl_flush_pipeline_benchmark <width> <height> <stripe_lines> <render_ns_per_px> <bus_mbps> <jitter_percent>
+ *        lvgl_flush_pipeline_benchmark (run the presets)
+ * Output: one line per buffer number, `<buffer_num> <pipeline_off_frame_us> <pipeline_on_frame_us> <speedup>`
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+
+static constexpr int BENCH_FRAMES = 200;
+static constexpr int BYTES_PER_PIXEL = 2;
+
+struct Scenario {
+    const char *name;
+    uint32_t width;
+    uint32_t height;
+    uint32_t stripe_lines;
+    uint32_t render_ns_per_px;
+    uint32_t bus_mbps;
+    uint32_t jitter_percent;
+};
+
+/* Deterministic render cost in [1 - jitter, 1 + jitter], so the two modes see the same sequence */
+static uint64_t next_render_ns(uint32_t &seed, uint64_t base_ns, uint32_t jitter_percent)
+{
+    seed = seed * 1664525 + 1013904223;
+    int64_t offset = static_cast<int64_t>((seed >> 8) % (2 * jitter_percent + 1)) - jitter_percent;
+
+    return base_ns * (100 + offset) / 100;
+}
+
+/* Return the average frame time in ns */
+static uint64_t run(const Scenario &scenario, int buffer_num, bool use_pipeline)
+{
+    uint32_t stripes = (scenario.height + scenario.stripe_lines - 1) / scenario.stripe_lines;
+    uint64_t stripe_px = static_cast<uint64_t>(scenario.width) * scenario.stripe_lines;
+    uint64_t render_ns = stripe_px * scenario.render_ns_per_px;
+    uint64_t send_ns = stripe_px * BYTES_PER_PIXEL * 8 * 1000 / scenario.bus_mbps;
+    int free_num = use_pipeline ? std::max(buffer_num - 2, 0) : 0;
+    std::deque<uint64_t> inflight_finish;
+    uint64_t cpu_ns = 0;
+    uint64_t ready_ns = 0;
+    uint64_t bus_ns = 0;
+    uint32_t seed = 1;
+
+    for (uint32_t i = 0; i < stripes * BENCH_FRAMES; i++) {
+        // Render into the active draw buffer, then wait for the previous flush to be ready
+        cpu_ns += next_render_ns(seed, render_ns, scenario.jitter_percent);
+        cpu_ns = std::max(cpu_ns, ready_ns);
+
+        // The panel IO transmits in submission order
+        bus_ns = std::max(bus_ns, cpu_ns) + send_ns;
+        if (!use_pipeline) {
+            ready_ns = bus_ns;
+            continue;
+        }
+
+        // Recycle the stripes finished before this flush
+        while (!inflight_finish.empty() && (inflight_finish.front() <= cpu_ns)) {
+            inflight_finish.pop_front();
+            free_num++;
+        }
+        inflight_finish.push_back(bus_ns);
+        if (free_num > 0) {
+            free_num--;
+            ready_ns = cpu_ns;
+        } else {
+            ready_ns = inflight_finish.front();
+            inflight_finish.pop_front();
+        }
+    }
+
+    return bus_ns / BENCH_FRAMES;
+}
+
+static void report(const Scenario &scenario)
+{
+    if (scenario.name != nullptr) {
+        printf("%s\n", scenario.name);
+    }
+    for (int buffer_num = 2; buffer_num <= 4; buffer_num++) {
+        uint64_t off_ns = run(scenario, buffer_num, false);
+        uint64_t on_ns = run(scenario, buffer_num, true);
+        printf("%d %llu %llu %.2f\n", buffer_num, static_cast<unsigned long long>(off_ns / 1000),
+               static_cast<unsigned long long>(on_ns / 1000), static_cast<double>(off_ns) / on_ns);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    if (argc == 1) {
+        static const Scenario presets[] = {
+            {"240x320 SPI 80 MHz, 20 lines, 200 ns/px, 80% jitter", 240, 320, 20, 200, 80, 80},
+            {"320x480 QSPI 40 MHz, 20 lines, 100 ns/px, 50% jitter", 320, 480, 20, 100, 160, 50},
+            {"320x480 QSPI 40 MHz, 20 lines, 100 ns/px, 0% jitter", 320, 480, 20, 100, 160, 0},
+            {"320x480 QSPI 40 MHz, 20 lines, 30 ns/px, 50% jitter (bus bound)", 320, 480, 20, 30, 160, 50},
+        };
+        for (const auto &scenario : presets) {
+            report(scenario);
+        }
+        return 0;
+    }
+    if (argc != 7) {
+        fprintf(stderr, "Usage: %s <width> <height> <stripe_lines> <render_ns_per_px> <bus_mbps> <jitter_percent>\n",
+                argv[0]);
+        return 1;
+    }
+
+    Scenario scenario = {};
+    scenario.width = strtoul(argv[1], nullptr, 0);
+    scenario.height = strtoul(argv[2], nullptr, 0);
+    scenario.stripe_lines = strtoul(argv[3], nullptr, 0);
+    scenario.render_ns_per_px = strtoul(argv[4], nullptr, 0);
+    scenario.bus_mbps = strtoul(argv[5], nullptr, 0);
+    scenario.jitter_percent = std::min<uint32_t>(strtoul(argv[6], nullptr, 0), 100);
+    if ((scenario.width == 0) || (scenario.height == 0) || (scenario.stripe_lines == 0) || (scenario.bus_mbps == 0)) {
+        fprintf(stderr, "Invalid arguments\n");
+        return 1;
+    }
+    report(scenario);
+
+    return 0;
+}
@@ -0,0 +1,217 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Host benchmark of the fixed-block memory pool (`esp_panel::utils::MemoryPool`), which compares the allocator used by
+ * `utils::make_shared()` and `utils::vector` when the pool is enabled (`utils::PoolMemoryAllocator`) with the general
+ * one (`esp_utils::GeneralMemoryAllocator`) for a churn of small objects.
+ *
+ * The tool is built against `src/utils/esp_panel_utils_pool.cpp`, with the ESP-IDF headers replaced by the stand-ins
+ * of `tools/host/`. The pool is configured at build time like on the device, pass the `ESP_PANEL_DRIVERS_MEM_POOL_*`
+ * macros to try another one. The workload keeps `live_num` objects alive and replaces a random one at each step, with
+ * the sizes of the objects created by the drivers (`shared_ptr` control blocks, touch points, small vectors). It
+ * reports the time of an allocation and release pair, the hit rate of the pool, and how far the addresses of the
+ * general allocator spread, which is the room the heap loses to fragmentation.
+ *
+ * The host `malloc()` keeps per-thread caches of small blocks and takes no lock, so it is much faster than the heap of
+ * ESP-IDF, which walks a TLSF under a lock. The time columns only compare the pool with that best case, the hit rate
+ * and the spans are the figures that carry over to the device.
+ *
+ * Build: g++ -std=gnu++17 -O2 -I tools/host -I src -I src/utils -DESP_PANEL_DRIVERS_FILE_SKIP
+ *            -DESP_PANEL_DRIVERS_MEM_POOL_ENABLE=1 [-DESP_PANEL_DRIVERS_MEM_POOL_BLOCK_SIZE=<size>]
+ *            [-DESP_PANEL_DRIVERS_MEM_POOL_INTERNAL_BLOCK_NUM=<num>]
+ *            tools/memory_pool_benchmark.cpp src/utils/esp_panel_utils_pool.cpp -o memory_pool_benchmark
+ * Usage: memory_pool_benchmark <live_num> <max_size>
+ *        memory_pool_benchmark (run the presets)
+ * Output: `<malloc_ns_per_pair> <pool_ns_per_pair> <pool_hit_percent> <malloc_span_bytes> <pool_fallback_span_bytes>`
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "esp_heap_caps.h"
+#include "esp_panel_utils_pool.hpp"
+
+#if !ESP_PANEL_DRIVERS_MEM_POOL_ENABLE
+#error "Build with `-DESP_PANEL_DRIVERS_MEM_POOL_ENABLE=1`, see the header of this file"
+#endif
+
+using esp_panel::utils::MemoryPool;
+using esp_panel::utils::PoolMemoryAllocator;
+using GeneralAllocator = esp_utils::GeneralMemoryAllocator<uint8_t>;
+using PoolAllocator = PoolMemoryAllocator<uint8_t>;
+
+static constexpr int BENCH_STEPS = 2000000;
+
+struct Scenario {
+    const char *name;
+    size_t live_num;
+    size_t max_size;
+};
+
+/* Deterministic sequence, so both allocators see the same workload */
+static uint32_t next_random(uint32_t &seed)
+{
+    seed = seed * 1664525 + 1013904223;
+    return seed >> 8;
+}
+
+/* Most objects are small, a few are up to `max_size` */
+static size_t next_size(uint32_t &seed, size_t max_size)
+{
+    static const size_t common_sizes[] = {16, 24, 32, 40, 48, 64};
+    uint32_t value = next_random(seed);
+
+    if ((value % 8) == 0) {
+        return 1 + (next_random(seed) % max_size);
+    }
+    return std::min(common_sizes[value % (sizeof(common_sizes) / sizeof(common_sizes[0]))], max_size);
+}
+
+/* The arenas of the pool are the only blocks taken through `heap_caps_aligned_alloc()` */
+static bool is_in_arena(const void *ptr)
+{
+    auto addr = reinterpret_cast<uintptr_t>(ptr);
+    for (size_t i = 0; i < host_heap_caps_block_num; i++) {
+        if ((addr >= host_heap_caps_blocks[i].begin) && (addr < host_heap_caps_blocks[i].end)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+struct Object {
+    uint8_t *ptr;
+    size_t size;
+};
+
+struct Result {
+    double ns_per_pair = 0;
+    size_t span_bytes = 0;
+};
+
+/* Address range of the live blocks from the general allocator, after the churn */
+static size_t get_span(const std::vector<Object> &live)
+{
+    uintptr_t low = UINTPTR_MAX;
+    uintptr_t high = 0;
+    for (auto &object : live) {
+        if (is_in_arena(object.ptr)) {
+            continue;
+        }
+        low = std::min(low, reinterpret_cast<uintptr_t>(object.ptr));
+        high = std::max(high, reinterpret_cast<uintptr_t>(object.ptr));
+    }
+
+    return (high > low) ? (high - low) : 0;
+}
+
+template <typename Allocator>
+static Result run(const Scenario &scenario)
+{
+    Allocator allocator;
+    std::vector<Object> live(scenario.live_num);
+    uint32_t seed = 1;
+    for (auto &object : live) {
+        object.size = next_size(seed, scenario.max_size);
+        object.ptr = allocator.allocate(object.size);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < BENCH_STEPS; i++) {
+        auto &object = live[next_random(seed) % live.size()];
+        allocator.deallocate(object.ptr, object.size);
+        object.size = next_size(seed, scenario.max_size);
+        object.ptr = allocator.allocate(object.size);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    Result result = {
+        .ns_per_pair = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) /
+                       BENCH_STEPS,
+        .span_bytes = get_span(live),
+    };
+    for (auto &object : live) {
+        allocator.deallocate(object.ptr, object.size);
+    }
+
+    return result;
+}
+
+/* Number of allocations served by the arenas of the pool */
+static size_t get_hit_count()
+{
+    size_t count = 0;
+    for (int tier = 0; tier < static_cast<int>(MemoryPool::Tier::MAX); tier++) {
+        MemoryPool::Stats stats;
+        MemoryPool::getStats(static_cast<MemoryPool::Tier>(tier), stats);
+        count += stats.alloc_count;
+    }
+
+    return count;
+}
+
+static void report(const Scenario &scenario)
+{
+    if (scenario.name != nullptr) {
+        printf("%s\n", scenario.name);
+    }
+
+    Result malloc_result = run<GeneralAllocator>(scenario);
+
+    // The pool is global, so only count the allocations of this scenario
+    size_t hit_count = get_hit_count();
+    size_t fallback_count = MemoryPool::getFallbackCount();
+    Result pool_result = run<PoolAllocator>(scenario);
+    hit_count = get_hit_count() - hit_count;
+    fallback_count = MemoryPool::getFallbackCount() - fallback_count;
+    size_t total = hit_count + fallback_count;
+
+    printf("%.1f %.1f %.1f %zu %zu\n", malloc_result.ns_per_pair, pool_result.ns_per_pair,
+           (total == 0) ? 0.0 : 100.0 * hit_count / total, malloc_result.span_bytes, pool_result.span_bytes);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc == 1) {
+        static const Scenario presets[] = {
+            {"24 live objects up to 128 B", 24, 128},
+            {"Live objects as many as the blocks, up to 128 B", ESP_PANEL_DRIVERS_MEM_POOL_INTERNAL_BLOCK_NUM, 128},
+            {"Twice as many live objects as the blocks, up to 128 B (pool exhausted)",
+             2 * ESP_PANEL_DRIVERS_MEM_POOL_INTERNAL_BLOCK_NUM, 128},
+            {"24 live objects up to the block size", 24, ESP_PANEL_DRIVERS_MEM_POOL_BLOCK_SIZE},
+        };
+        printf(
+            "Pool: %d B x %d (internal) + %d (PSRAM)\n", ESP_PANEL_DRIVERS_MEM_POOL_BLOCK_SIZE,
+            ESP_PANEL_DRIVERS_MEM_POOL_INTERNAL_BLOCK_NUM, ESP_PANEL_DRIVERS_MEM_POOL_PSRAM_BLOCK_NUM
+        );
+        for (const auto &scenario : presets) {
+            report(scenario);
+        }
+        MemoryPool::printStats();
+        return 0;
+    }
+    if (argc != 3) {
+        fprintf(stderr, "Usage: %s <live_num> <max_size>\n", argv[0]);
+        return 1;
+    }
+
+    Scenario scenario = {};
+    scenario.live_num = strtoul(argv[1], nullptr, 0);
+    scenario.max_size = strtoul(argv[2], nullptr, 0);
+    if ((scenario.live_num == 0) || (scenario.max_size == 0)) {
+        fprintf(stderr, "Invalid arguments\n");
+        return 1;
+    }
+    report(scenario);
+
+    return 0;
+}
@@ -0,0 +1,122 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Host tool of `esp_panel::drivers::BusRGBPlanner`, which checks the model and plans the bounce buffer of a panel.
+ *
+ * Build: g++ -std=gnu++17 -O2 -I src/drivers/bus tools/rgb_bounce_planner.cpp -o rgb_bounce_planner
+ * Usage: rgb_bounce_planner <h_res> <v_res> <bpp> <pclk_hz> <hpw> <hbp> <hfp> <vpw> <vbp> <vfp> [<psram_bytes_per_s>]
+ *        rgb_bounce_planner (only run the checks)
+ * Output: `<bounce_buffer_size_px> <max_pclk_hz> <fill_time_ns> <send_time_ns> <refresh_rate> <stable|unstable>`
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include "esp_panel_bus_rgb_planner.hpp"
+
+using namespace esp_panel::drivers;
+
+// 800x480 RGB565, the timing of the most ESP32-S3 4.3" boards
+static constexpr BusRGBPlanner::Timing TIMING_800_480 = {
+    .pclk_hz = 16 * 1000 * 1000,
+    .h_res = 800,
+    .v_res = 480,
+    .hsync_pulse_width = 4,
+    .hsync_back_porch = 8,
+    .hsync_front_porch = 8,
+    .vsync_pulse_width = 4,
+    .vsync_back_porch = 8,
+    .vsync_front_porch = 8,
+    .bits_per_pixel = 16,
+};
+
+static constexpr BusRGBPlanner::Timing with_pclk(BusRGBPlanner::Timing timing, uint32_t pclk_hz)
+{
+    timing.pclk_hz = pclk_hz;
+    return timing;
+}
+
+static constexpr BusRGBPlanner::Plan PLAN_16M = BusRGBPlanner::plan(TIMING_800_480, BusRGBPlanner::Budget{});
+static constexpr BusRGBPlanner::Plan PLAN_30M =
+    BusRGBPlanner::plan(with_pclk(TIMING_800_480, 30 * 1000 * 1000), BusRGBPlanner::Budget{});
+static constexpr BusRGBPlanner::Plan PLAN_5MB =
+    BusRGBPlanner::plan(TIMING_800_480, BusRGBPlanner::Budget{.psram_bandwidth = 5 * 1000 * 1000});
+static constexpr BusRGBPlanner::Plan PLAN_1KB =
+    BusRGBPlanner::plan(TIMING_800_480, BusRGBPlanner::Budget{.sram_budget_bytes = 1024});
+
+// The sending time of a line (820 clocks at 16 MHz) is 51.25 us
+static_assert(BusRGBPlanner::getSendTimeNs(TIMING_800_480, 16 * 1000 * 1000, 800) == 51250);
+// The filling time of a line (1600 bytes at 40 MB/s) is 40 us plus the overhead
+static_assert(BusRGBPlanner::getFillTimeNs(TIMING_800_480, BusRGBPlanner::Budget{}, 800) == 45000);
+// The size should divide half of the frame and be aligned to the DMA
+static_assert(BusRGBPlanner::isBounceBufferSizeValid(TIMING_800_480, 800 * 10));
+static_assert(!BusRGBPlanner::isBounceBufferSizeValid(TIMING_800_480, 800 * 7));
+static_assert(!BusRGBPlanner::isBounceBufferSizeValid(TIMING_800_480, 1000));
+// A larger bounce buffer amortizes the overhead, so it supports a higher PCLK
+static_assert(BusRGBPlanner::getMaxStablePclkHz(TIMING_800_480, BusRGBPlanner::Budget{}, 800 * 10) >
+              BusRGBPlanner::getMaxStablePclkHz(TIMING_800_480, BusRGBPlanner::Budget{}, 800));
+// The planned size is the smallest stable one
+static_assert(PLAN_16M.is_valid && PLAN_16M.is_stable);
+static_assert(PLAN_16M.max_pclk_hz >= TIMING_800_480.pclk_hz);
+static_assert(PLAN_16M.fill_time_ns * 100 <= PLAN_16M.send_time_ns * (100 - BusRGBPlanner::MARGIN_PERCENT_DEFAULT));
+static_assert(BusRGBPlanner::getMaxStablePclkHz(TIMING_800_480, BusRGBPlanner::Budget{},
+              PLAN_16M.bounce_buffer_size_px / 2) < TIMING_800_480.pclk_hz);
+// The PSRAM can't feed 30 MHz, so the largest size within the budget is picked with a lower PCLK
+static_assert(PLAN_30M.is_valid && !PLAN_30M.is_stable);
+static_assert(PLAN_30M.max_pclk_hz < 30 * 1000 * 1000);
+static_assert(PLAN_30M.bounce_buffer_size_px * 2 * 2 <= BusRGBPlanner::SRAM_BUDGET_BYTES_DEFAULT);
+// The PSRAM can't feed even 16 MHz at 5 MB/s, so the refresh rate follows the lower PCLK
+static_assert(PLAN_5MB.is_valid && !PLAN_5MB.is_stable);
+static_assert(PLAN_5MB.max_pclk_hz < TIMING_800_480.pclk_hz);
+static_assert(PLAN_5MB.fill_time_ns > PLAN_5MB.send_time_ns);
+static_assert(PLAN_5MB.refresh_rate_x100 == BusRGBPlanner::getRefreshRateX100(TIMING_800_480, PLAN_5MB.max_pclk_hz));
+// Invalid inputs
+static_assert(!BusRGBPlanner::plan(BusRGBPlanner::Timing{}, BusRGBPlanner::Budget{}).is_valid);
+static_assert(!BusRGBPlanner::plan(TIMING_800_480, BusRGBPlanner::Budget{.psram_bandwidth = 0}).is_valid);
+static_assert(!BusRGBPlanner::plan(TIMING_800_480, BusRGBPlanner::Budget{.margin_percent = 100}).is_valid);
+// The SRAM budget (1 KB) can't hold two bounce buffers of one line (2 x 1600 bytes)
+static_assert(!PLAN_1KB.is_valid && (PLAN_1KB.bounce_buffer_size_px == 0));
+
+int main(int argc, char **argv)
+{
+    if (argc == 1) {
+        printf("All checks passed\n");
+        return 0;
+    }
+    if ((argc != 11) && (argc != 12)) {
+        fprintf(stderr, "Usage: %s <h_res> <v_res> <bpp> <pclk_hz> <hpw> <hbp> <hfp> <vpw> <vbp> <vfp> "
+                "[<psram_bytes_per_s>]\n", argv[0]);
+        return 1;
+    }
+
+    BusRGBPlanner::Timing timing = {};
+    timing.h_res = strtoul(argv[1], nullptr, 0);
+    timing.v_res = strtoul(argv[2], nullptr, 0);
+    timing.bits_per_pixel = strtoul(argv[3], nullptr, 0);
+    timing.pclk_hz = strtoul(argv[4], nullptr, 0);
+    timing.hsync_pulse_width = strtoul(argv[5], nullptr, 0);
+    timing.hsync_back_porch = strtoul(argv[6], nullptr, 0);
+    timing.hsync_front_porch = strtoul(argv[7], nullptr, 0);
+    timing.vsync_pulse_width = strtoul(argv[8], nullptr, 0);
+    timing.vsync_back_porch = strtoul(argv[9], nullptr, 0);
+    timing.vsync_front_porch = strtoul(argv[10], nullptr, 0);
+    BusRGBPlanner::Budget budget = {};
+    if (argc == 12) {
+        budget.psram_bandwidth = strtoul(argv[11], nullptr, 0);
+    }
+
+    BusRGBPlanner::Plan plan = BusRGBPlanner::plan(timing, budget);
+    if (!plan.is_valid) {
+        fprintf(stderr, "No valid bounce buffer size within the budget\n");
+        return 1;
+    }
+    printf("%u %u %u %u %u.%02u %s\n", static_cast<unsigned>(plan.bounce_buffer_size_px),
+           static_cast<unsigned>(plan.max_pclk_hz), static_cast<unsigned>(plan.fill_time_ns),
+           static_cast<unsigned>(plan.send_time_ns), static_cast<unsigned>(plan.refresh_rate_x100 / 100),
+           static_cast<unsigned>(plan.refresh_rate_x100 % 100), plan.is_stable ? "stable" : "unstable");
+
+    return 0;
+}
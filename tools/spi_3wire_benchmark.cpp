@@ -0,0 +1,259 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Host benchmark of the software 3-wire SPI (`src/drivers/bus/port/esp_lcd_panel_io_3wire_spi.c`) with all the lines
+ * on a simulated IO expander.
+ *
+ * The vendor initialization commands are parsed from the given LCD port sources, then sent by both the legacy
+ * per-line writes and the packed state writes. The waveform seen by the simulated expander is decoded and checked
+ * against the commands, and the number of expander writes is counted.
+ *
+ * Build: g++ -std=gnu++17 -O2 -I src/drivers/bus/port tools/spi_3wire_benchmark.cpp -o spi_3wire_benchmark
+ * Usage: spi_3wire_benchmark [--write-us <us>] <esp_lcd_xxx.c>...
+ * Output: one line per source and SPI mode, `<path> <mode> <commands> <legacy_writes> <packed_writes> <legacy_ms> <packed_ms>`
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "esp_lcd_panel_io_3wire_spi_encoder.h"
+
+// A write of an 8-bit output register over I2C at 400 KHz: START + 3 bytes with ACK + STOP
+static constexpr double EXPANDER_WRITE_US_DEFAULT = (2 + 3 * 9) * 2.5;
+
+static constexpr uint32_t EXPANDER_PIN_CS = 1 << 1;
+static constexpr uint32_t EXPANDER_PIN_SCL = 1 << 2;
+static constexpr uint32_t EXPANDER_PIN_SDA = 1 << 3;
+
+struct Command {
+    int cmd;
+    std::vector<uint8_t> params;
+};
+
+/**
+ * Simulated IO expander, which decodes the 3-wire SPI waveform from its output register
+ */
+class SimulatedExpander {
+public:
+    SimulatedExpander(const panel_io_3wire_encoder_config_t &config): _config(config)
+    {
+        _output = toOutput(panel_io_3wire_get_idle_state(&config));
+    }
+
+    static uint32_t toOutput(uint8_t state)
+    {
+        return ((state & PANEL_IO_3WIRE_LINE_CS) ? EXPANDER_PIN_CS : 0) |
+               ((state & PANEL_IO_3WIRE_LINE_SCL) ? EXPANDER_PIN_SCL : 0) |
+               ((state & PANEL_IO_3WIRE_LINE_SDA) ? EXPANDER_PIN_SDA : 0);
+    }
+
+    uint32_t readOutput() const
+    {
+        return _output;
+    }
+
+    void writeOutput(uint32_t value)
+    {
+        bool cs_active = ((value & EXPANDER_PIN_CS) != 0) == _config.cs_high_active;
+        bool scl = (value & EXPANDER_PIN_SCL) != 0;
+        bool last_scl = (_output & EXPANDER_PIN_SCL) != 0;
+
+        if (cs_active && (scl != last_scl) && (scl == _config.scl_active_rising_edge)) {
+            _bits.push_back((value & EXPANDER_PIN_SDA) ? 1 : 0);
+        }
+        if (!cs_active && _is_cs_active) {
+            _packages.push_back(_bits);
+            _bits.clear();
+        }
+        _is_cs_active = cs_active;
+        _output = value;
+        _writes++;
+    }
+
+    const std::vector<std::vector<uint8_t>> &getPackages() const
+    {
+        return _packages;
+    }
+
+    size_t getWrites() const
+    {
+        return _writes;
+    }
+
+private:
+    panel_io_3wire_encoder_config_t _config;
+    uint32_t _output = 0;
+    bool _is_cs_active = false;
+    std::vector<uint8_t> _bits;
+    std::vector<std::vector<uint8_t>> _packages;
+    size_t _writes = 0;
+};
+
+/**
+ * Same as `esp_io_expander_set_level()`, which writes the output register on every call
+ */
+static void set_level(SimulatedExpander &expander, uint32_t pin, bool level)
+{
+    uint32_t value = expander.readOutput();
+    expander.writeOutput(level ? (value | pin) : (value & ~pin));
+}
+
+/**
+ * Same sequence as the original `spi_write_package()`, with one `set_line_level()` per line change
+ */
+static void write_package_legacy(SimulatedExpander &expander, const panel_io_3wire_encoder_config_t &config,
+                                 int dc_bit, uint32_t data, uint32_t data_bytes)
+{
+    bool cs_idle_level = !config.cs_high_active;
+    bool sda_scl_idle_level = config.sda_scl_idle_high;
+    bool scl_active_before_level = !config.scl_active_rising_edge;
+
+    set_level(expander, EXPANDER_PIN_CS, !cs_idle_level);
+    set_level(expander, EXPANDER_PIN_SCL, scl_active_before_level);
+    for (uint32_t i = 0; i < data_bytes; i++) {
+        uint8_t byte = (data >> ((data_bytes - 1 - i) * 8)) & 0xff;
+        int byte_dc_bit = (i == 0) ? dc_bit : PANEL_IO_3WIRE_NO_DC_BIT;
+        int bits = (byte_dc_bit != PANEL_IO_3WIRE_NO_DC_BIT) ? 9 : 8;
+        for (int j = 0; j < bits; j++) {
+            bool level = false;
+            if (bits == 9 && j == 0) {
+                level = byte_dc_bit;
+            } else {
+                int k = (bits == 9) ? (j - 1) : j;
+                level = (byte >> (config.lsb_first ? k : (7 - k))) & 0x1;
+            }
+            set_level(expander, EXPANDER_PIN_SDA, level);
+            set_level(expander, EXPANDER_PIN_SCL, scl_active_before_level);
+            set_level(expander, EXPANDER_PIN_SCL, !scl_active_before_level);
+        }
+    }
+    set_level(expander, EXPANDER_PIN_SCL, sda_scl_idle_level);
+    set_level(expander, EXPANDER_PIN_SDA, sda_scl_idle_level);
+    set_level(expander, EXPANDER_PIN_CS, cs_idle_level);
+}
+
+/**
+ * Same sequence as the current `spi_write_package()`, with one write per line state
+ */
+static void write_package_packed(SimulatedExpander &expander, const panel_io_3wire_encoder_config_t &config,
+                                 int dc_bit, uint32_t data, uint32_t data_bytes)
+{
+    uint8_t states[PANEL_IO_3WIRE_PACKAGE_STATES_MAX];
+    size_t num = panel_io_3wire_encode_package(&config, dc_bit, data, data_bytes, states);
+    for (size_t i = 0; i < num; i++) {
+        expander.writeOutput(SimulatedExpander::toOutput(states[i]));
+    }
+}
+
+static std::vector<uint8_t> expect_bits(const panel_io_3wire_encoder_config_t &config, int dc_bit, uint8_t data)
+{
+    std::vector<uint8_t> bits;
+    if (dc_bit != PANEL_IO_3WIRE_NO_DC_BIT) {
+        bits.push_back(dc_bit);
+    }
+    for (int i = 0; i < 8; i++) {
+        bits.push_back((data >> (config.lsb_first ? i : (7 - i))) & 0x1);
+    }
+
+    return bits;
+}
+
+/**
+ * Send the commands like an ST7701 over 3-wire SPI (9-bit, DC bit = 1 on data), return the writes or -1 if mismatch
+ */
+template <typename WriteFunc>
+static long run(const std::vector<Command> &commands, const panel_io_3wire_encoder_config_t &config, WriteFunc func)
+{
+    SimulatedExpander expander(config);
+    std::vector<std::vector<uint8_t>> expected;
+
+    for (const auto &command : commands) {
+        func(expander, config, PANEL_IO_3WIRE_DC_BIT_0, command.cmd, 1);
+        expected.push_back(expect_bits(config, PANEL_IO_3WIRE_DC_BIT_0, command.cmd));
+        for (auto param : command.params) {
+            func(expander, config, PANEL_IO_3WIRE_DC_BIT_1, param, 1);
+            expected.push_back(expect_bits(config, PANEL_IO_3WIRE_DC_BIT_1, param));
+        }
+    }
+    if (expander.getPackages() != expected) {
+        return -1;
+    }
+
+    return expander.getWrites();
+}
+
+static std::vector<Command> parse_commands(const std::string &path)
+{
+    std::ifstream file(path);
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    std::string source = buffer.str();
+
+    // {0xFF, (uint8_t []){0x77, 0x01, 0x00, 0x00, 0x13}, 5, 0},
+    std::regex row(R"(^\s*\{\s*(0x[0-9A-Fa-f]+)\s*,\s*\(uint8_t\s*\[\]\)\s*\{([^}]*)\}\s*,\s*(\d+)\s*,)");
+    std::vector<Command> commands;
+    std::istringstream lines(source);
+    std::string line;
+    while (std::getline(lines, line)) {
+        std::smatch match;
+        if (!std::regex_search(line, match, row)) {
+            continue;
+        }
+        Command command = {static_cast<int>(strtol(match[1].str().c_str(), nullptr, 16)), {}};
+        size_t size = strtoul(match[3].str().c_str(), nullptr, 10);
+        std::istringstream params(match[2].str());
+        std::string param;
+        while (std::getline(params, param, ',') && (command.params.size() < size)) {
+            command.params.push_back(static_cast<uint8_t>(strtol(param.c_str(), nullptr, 16)));
+        }
+        commands.push_back(command);
+    }
+
+    return commands;
+}
+
+int main(int argc, char **argv)
+{
+    double write_us = EXPANDER_WRITE_US_DEFAULT;
+    int first = 1;
+    if ((argc > 2) && (strcmp(argv[1], "--write-us") == 0)) {
+        write_us = atof(argv[2]);
+        first = 3;
+    }
+    if (argc <= first) {
+        fprintf(stderr, "Usage: %s [--write-us <us>] <esp_lcd_xxx.c>...\n", argv[0]);
+        return 1;
+    }
+
+    for (int i = first; i < argc; i++) {
+        std::vector<Command> commands = parse_commands(argv[i]);
+        if (commands.empty()) {
+            fprintf(stderr, "%s: no initialization command found\n", argv[i]);
+            return 1;
+        }
+        for (int mode = 0; mode < 4; mode++) {
+            panel_io_3wire_encoder_config_t config = {};
+            config.sda_scl_idle_high = mode & 0x1;
+            config.scl_active_rising_edge = config.sda_scl_idle_high ? ((mode & 0x2) != 0) : ((mode & 0x2) == 0);
+            long legacy = run(commands, config, write_package_legacy);
+            long packed = run(commands, config, write_package_packed);
+            if ((legacy < 0) || (packed < 0)) {
+                fprintf(stderr, "%s: waveform mismatch in SPI mode %d\n", argv[i], mode);
+                return 1;
+            }
+            printf("%s %d %zu %ld %ld %.1f %.1f\n", argv[i], mode, commands.size(), legacy, packed,
+                   legacy * write_us / 1000, packed * write_us / 1000);
+        }
+    }
+
+    return 0;
+}